@@ -48,7 +48,8 @@
 //#define SUPPORT_EVENTS_WAITING      1
 // Allow automatic screen capture of current screen pressing F12, defined in KeyCallback()
 #define SUPPORT_SCREEN_CAPTURE      1
-// Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
+// Allow screen recording (StartScreenRecording()) and automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
+// NOTE: Frames are encoded on a dedicated thread if SUPPORT_THREADS is defined (utils module)
 #define SUPPORT_GIF_RECORDING       1
 // Support CompressData() and DecompressData() functions
 #define SUPPORT_COMPRESSION_API     1
@@ -73,6 +74,9 @@
 
 #define MAX_DECOMPRESSION_SIZE        64        // Max size allocated for decompression in MB
 
+#define SCREEN_RECORDING_FPS          10        // Default screen recording frames per second
+#define MAX_RECORDING_QUEUE_FRAMES     8        // Max screen recording frames waiting to be encoded (frames dropped if full)
+
 
 //------------------------------------------------------------------------------------
 // Module: rlgl - Configuration Flags
@@ -90,6 +94,7 @@
 
 #define DEFAULT_BATCH_BUFFERS            1      // Default number of batch buffers (multi-buffering)
 #define DEFAULT_BATCH_DRAWCALLS        256      // Default number of batch draw calls (by state changes: mode, texture)
+#define DEFAULT_BATCH_VERTEX_FORMAT      0      // Default render batch vertex format: 0-Default (24 bytes/vertex), 1-Compact 2D (16 bytes/vertex)
 
 #define MAX_MATRIX_STACK_SIZE           32      // Maximum size of internal Matrix stack
 #define MAX_SHADER_LOCATIONS            32      // Maximum number of shader locations supported
@@ -116,6 +121,9 @@
 // Use QUADS instead of TRIANGLES for drawing when possible
 // Some lines-based shapes could still use lines
 #define SUPPORT_QUADS_DRAW_MODE     1
+// Use indexed vertex data (rlIndex()) for fans and strips (circles, rings, polygons, rounded rectangles)
+// Shared vertex are submitted only once, not supported on OpenGL 1.1
+#define SUPPORT_INDEXED_DRAW_MODE   1
 
 
 //------------------------------------------------------------------------------------
@@ -143,6 +151,12 @@
 // If not defined, still some functions are supported: ImageFormat(), ImageCrop(), ImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION  1
 
+// textures: Configuration values
+//------------------------------------------------------------------------------------
+#define ASYNC_TEXTURE_UPLOAD_BUDGET_MS     4.0f     // Default per-frame time budget for async textures upload (milliseconds)
+#define ASYNC_TEXTURE_UPLOAD_BUDGET_BYTES 16777216  // Default per-frame data budget for async textures upload (bytes)
+#define IMAGE_STREAM_BUFFER_FRAMES         3        // Image stream frames decoded ahead of current frame (LoadImageStream())
+
 
 //------------------------------------------------------------------------------------
 // Module: text - Configuration Flags
@@ -153,6 +167,9 @@
 // Selected desired font fileformats to be supported for loading
 #define SUPPORT_FILEFORMAT_FNT      1
 #define SUPPORT_FILEFORMAT_TTF      1
+// Generate SDF fonts glyphs using a linear-time distance transform of an oversampled glyph bitmap,
+// a lot faster than stb_truetype exact SDF generation on big charsets, with slightly lower precision
+//#define SUPPORT_FONT_SDF_DISTANCE_TRANSFORM 1
 
 // Support text management functions
 // If not defined, still some functions are supported: TextLength(), TextFormat()
@@ -164,6 +181,8 @@
                                                 // TextFormat(), TextSubtext(), TextToUpper(), TextToLower(), TextToPascal(), TextSplit()
 #define MAX_TEXT_UNICODE_CHARS       512        // Maximum number of unicode codepoints: GetCodepoints()
 #define MAX_TEXTSPLIT_COUNT          128        // Maximum number of substrings to split: TextSplit()
+#define FONT_CACHE_ATLAS_SIZE       1024        // Dynamic font glyphs cache atlas default size: LoadFontDynamic()
+#define FONT_CACHE_ATLAS_PAGES         4        // Dynamic font glyphs cache atlas pages per side, glyphs evicted by page
 
 
 //------------------------------------------------------------------------------------
@@ -206,8 +225,16 @@
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG            1
 //#define SUPPORT_TRACELOG_DEBUG      1
+// Support multi-threading utilities, required by parallel image processing (SetImageProcessingThreads())
+// NOTE: Uses Win32 threads on Windows and POSIX threads on other platforms
+#define SUPPORT_THREADS             1
+// Support memory mapped files, used by LoadImageMapped() to load container formats without data copies
+// NOTE: Not available on Android, Web and UWP platforms, file data is loaded instead
+#define SUPPORT_FILE_MAPPING        1
 
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH          128    // Max length of one trace-log message
 #define MAX_UWP_MESSAGES                 512    // Max UWP messages to process
+#define MAX_PARALLEL_THREADS              32    // Max threads used to run a parallel job
+#define ASYNC_JOB_THREADS                  2    // Worker threads used to run async jobs (LoadTextureAsync())
@@ -72,7 +72,8 @@
 *       Allow automatic screen capture of current screen pressing F12, defined in KeyCallback()
 *
 *   #define SUPPORT_GIF_RECORDING
-*       Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
+*       Allow screen recording as animated gif or frames sequence (StartScreenRecording()), frames are encoded
+*       on a dedicated thread, gif recording of current screen is also toggled pressing CTRL+F12, defined in KeyCallback()
 *
 *   #define SUPPORT_COMPRESSION_API
 *       Support CompressData() and DecompressData() functions, those functions use zlib implementation
@@ -148,6 +149,10 @@
 
     #define MSF_GIF_IMPL
     #include "external/msf_gif.h"   // Support GIF recording
+
+    #if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+        #include "external/stb_image_write.h"   // Required for: stbi_write_png() [Used in PNG frames recording]
+    #endif
 #endif
 
 #if defined(SUPPORT_COMPRESSION_API)
@@ -312,6 +317,12 @@
 #ifndef MAX_CHAR_PRESSED_QUEUE
     #define MAX_CHAR_PRESSED_QUEUE        16        // Max number of characters in the char input queue
 #endif
+#ifndef SCREEN_RECORDING_FPS
+    #define SCREEN_RECORDING_FPS          10        // Default screen recording frames per second
+#endif
+#ifndef MAX_RECORDING_QUEUE_FRAMES
+    #define MAX_RECORDING_QUEUE_FRAMES     8        // Max screen recording frames waiting to be encoded (frames dropped if full)
+#endif
 
 #if defined(SUPPORT_DATA_STORAGE)
     #ifndef STORAGE_DATA_FILE
@@ -474,6 +485,22 @@ typedef struct CoreData {
     } Time;
 } CoreData;
 
+#if defined(SUPPORT_GIF_RECORDING)
+// Screen recording output format, defined by recording file extension
+typedef enum {
+    RECORDING_GIF = 0,          // Animated GIF file (.gif)
+    RECORDING_PNG,              // PNG frames sequence (.png), lossless
+    RECORDING_RAW               // RAW frames sequence (.raw), RGBA pixel data without header
+} RecordingFormat;
+
+// Screen recording frame, encoded on recording encoder thread
+typedef struct RecordingFrame {
+    Image image;                // Frame image (RGBA), owned by frame
+    int delay;                  // Frame delay in centiseconds (GIF only)
+    char *fileName;             // Frame file name (frames sequence only)
+} RecordingFrame;
+#endif
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -487,9 +514,18 @@ static int screenshotCounter = 0;           // Screenshots counter
 #endif
 
 #if defined(SUPPORT_GIF_RECORDING)
-static int gifFramesCounter = 0;            // GIF frames counter
-static bool gifRecording = false;           // GIF recording state
-static MsfGifState gifState = { 0 };        // MSGIF context state
+static bool recording = false;              // Screen recording state
+static int recordingFormat = RECORDING_GIF; // Screen recording output format
+static char recordingPath[MAX_FILEPATH_LENGTH] = { 0 };    // Screen recording file path
+static int recordingWidth = 0;              // Screen recording frames width
+static int recordingHeight = 0;             // Screen recording frames height
+static int recordingFPS = SCREEN_RECORDING_FPS;     // Screen recording frames per second
+static double recordingNextTime = 0.0;      // Screen recording next frame time
+static int recordingFramesCounter = 0;      // Screen recording game frames counter (RECORDING message blinking)
+static int recordingFrames = 0;             // Screen recording frames queued to encoder
+static int recordingDropped = 0;            // Screen recording frames dropped (encoder queue full)
+static JobsQueue *recordingQueue = NULL;    // Screen recording encoder queue (dedicated thread)
+static MsfGifState gifState = { 0 };        // MSGIF context state (only accessed by encoder thread while recording)
 #endif
 //-----------------------------------------------------------------------------------
 
@@ -500,6 +536,11 @@ static MsfGifState gifState = { 0 };        // MSGIF context state
 extern void LoadFontDefault(void);          // [Module: text] Loads default font on InitWindow()
 extern void UnloadFontDefault(void);        // [Module: text] Unloads default font from GPU memory
 #endif
+extern void UpdateTexturesAsync(void);      // [Module: textures] Uploads decoded async textures on BeginDrawing()
+extern void UnloadTexturesAsync(void);      // [Module: textures] Unloads async textures requests on CloseWindow()
+extern void ReadScreenDataAsync(int width, int height, ImageReadCallback callback, void *userData);   // [Module: textures] Requests screen pixels readback
+extern void UpdateTextureReadbacks(void);   // [Module: textures] Retrieves available pixels readbacks on BeginDrawing()
+extern void FlushTextureReadbacks(void);    // [Module: textures] Retrieves all pending pixels readbacks
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
@@ -514,6 +555,12 @@ static void Wait(float ms);                             // Wait for some millise
 
 static void PollInputEvents(void);                      // Register user events
 
+static void ScreenshotCallback(Image image, void *userData);    // Save screenshot image once retrieved (TakeScreenshot())
+#if defined(SUPPORT_GIF_RECORDING)
+static void RecordingFrameCallback(Image image, void *userData);    // Queue screen recording frame once retrieved
+static void EncodeRecordingFrame(void *data);                       // Encode screen recording frame (encoder thread)
+#endif
+
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
 static void ErrorCallback(int error, const char *description);                             // GLFW3 Error Callback, runs on GLFW3 error
 // Window callbacks events
@@ -798,15 +845,16 @@ void InitWindow(int width, int height, const char *title)
 // Close window and unload OpenGL context
 void CloseWindow(void)
 {
+    FlushTextureReadbacks();    // Retrieve pending pixels readbacks (screenshots, recording frames)
+
 #if defined(SUPPORT_GIF_RECORDING)
-    if (gifRecording)
-    {
-        MsfGifResult result = msf_gif_end(&gifState);
-        msf_gif_free(result);
-        gifRecording = false;
-    }
+    if (recording) StopScreenRecording();   // Save running screen recording, waiting for encoder thread
 #endif
 
+    CloseAsyncJobs();           // Close async jobs workers (not started jobs cancelled, i.e. unloaded image streams data released)
+    CloseParallelJobs();        // Close parallel jobs pool threads
+    UnloadTexturesAsync();      // Unload async textures requests
+
 #if defined(SUPPORT_DEFAULT_FONT)
     UnloadFontDefault();
 #endif
@@ -1797,6 +1845,10 @@ void BeginDrawing(void)
     CORE.Time.update = CORE.Time.current - CORE.Time.previous;
     CORE.Time.previous = CORE.Time.current;
 
+    UpdateAsyncJobs();                  // Finish processed async jobs (i.e. decoded async textures)
+    UpdateTexturesAsync();              // Upload decoded async textures (per-frame budget)
+    UpdateTextureReadbacks();           // Retrieve available pixels readbacks (screenshots, GIF frames)
+
     rlLoadIdentity();                   // Reset current matrix (modelview)
     rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale)); // Apply screen scaling
 
@@ -1819,24 +1871,24 @@ void EndDrawing(void)
     rlglDraw();                     // Draw Buffers (Only OpenGL 3+ and ES2)
 
 #if defined(SUPPORT_GIF_RECORDING)
-    #define GIF_RECORD_FRAMERATE    10
-
-    if (gifRecording)
+    if (recording)
     {
-        gifFramesCounter++;
+        recordingFramesCounter++;
+
+        // NOTE: We record frames at recording frame rate, missed frames are skipped if game runs slower
+        double time = GetTime();
 
-        // NOTE: We record one gif frame every 10 game frames
-        if ((gifFramesCounter%GIF_RECORD_FRAMERATE) == 0)
+        if (time >= recordingNextTime)
         {
-            // Get image data for the current frame (from backbuffer)
-            // NOTE: This process is quite slow... :(
-            unsigned char *screenData = rlReadScreenPixels(CORE.Window.screen.width, CORE.Window.screen.height);
-            msf_gif_frame(&gifState, screenData, 10, 16, CORE.Window.screen.width*4);
+            // Request image data for the current frame (from backbuffer)
+            // NOTE: Pixels are retrieved asynchronously, frame is queued to encoder thread some frames later (RecordingFrameCallback())
+            ReadScreenDataAsync(CORE.Window.screen.width, CORE.Window.screen.height, RecordingFrameCallback, NULL);
 
-            RL_FREE(screenData);   // Free image data
+            recordingNextTime += 1.0/recordingFPS;
+            if (recordingNextTime < time) recordingNextTime = time + 1.0/recordingFPS;
         }
 
-        if (((gifFramesCounter/15)%2) == 1)
+        if (((recordingFramesCounter/15)%2) == 1)
         {
             DrawCircle(30, CORE.Window.screen.height - 20, 10, RED);
             DrawText("RECORDING", 50, CORE.Window.screen.height - 25, 10, MAROON);
@@ -1846,6 +1898,8 @@ void EndDrawing(void)
     }
 #endif
 
+    rlResetFrameStats();            // Keep current frame rendering statistics and reset counters
+
     SwapBuffers();                  // Copy back buffer to front buffer
 
     // Frame time control system
@@ -2246,11 +2300,9 @@ void SetConfigFlags(unsigned int flags)
 // Takes a screenshot of current screen (saved a .png)
 // NOTE: This function could work in any platform but some platforms: PLATFORM_ANDROID and PLATFORM_WEB
 // have their own internal file-systems, to dowload image to user file-system some additional mechanism is required
+// NOTE: Screen pixels are retrieved asynchronously, file is saved some frames later (ScreenshotCallback())
 void TakeScreenshot(const char *fileName)
 {
-    unsigned char *imgData = rlReadScreenPixels(CORE.Window.render.width, CORE.Window.render.height);
-    Image image = { imgData, CORE.Window.render.width, CORE.Window.render.height, 1, UNCOMPRESSED_R8G8B8A8 };
-
     char path[512] = { 0 };
 #if defined(PLATFORM_ANDROID)
     strcpy(path, CORE.Android.internalDataPath);
@@ -2264,17 +2316,113 @@ void TakeScreenshot(const char *fileName)
     strcpy(path, fileName);
 #endif
 
-    ExportImage(image, path);
-    RL_FREE(imgData);
+    char *pathCopy = (char *)RL_MALLOC(strlen(path) + 1);
+    strcpy(pathCopy, path);
 
-#if defined(PLATFORM_WEB)
-    // Download file from MEMFS (emscripten memory filesystem)
-    // saveFileFromMEMFSToDisk() function is defined in raylib/src/shell.html
-    emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", GetFileName(path), GetFileName(path)));
+    ReadScreenDataAsync(CORE.Window.render.width, CORE.Window.render.height, ScreenshotCallback, pathCopy);
+}
+
+// Start screen recording, returns true on success
+// NOTE: Output format depends on fileName extension: .gif (animated GIF) or .png/.raw (frames sequence, saved as fileName_00000.png),
+// screen frames are retrieved asynchronously and encoded on a dedicated thread, frames are dropped if encoder can not keep up
+bool StartScreenRecording(const char *fileName)
+{
+#if defined(SUPPORT_GIF_RECORDING)
+    if (recording)
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Screen recording already running");
+        return false;
+    }
+
+    if ((fileName == NULL) || (strlen(fileName) >= (MAX_FILEPATH_LENGTH - 8)))
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Screen recording file name provided is not valid");
+        return false;
+    }
+
+    // NOTE: Format is chosen here, encoder thread must not use file name helpers (not thread-safe)
+    if (IsFileExtension(fileName, ".gif")) recordingFormat = RECORDING_GIF;
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+    else if (IsFileExtension(fileName, ".png")) recordingFormat = RECORDING_PNG;
 #endif
+    else if (IsFileExtension(fileName, ".raw")) recordingFormat = RECORDING_RAW;
+    else
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: [%s] Screen recording file format not supported", fileName);
+        return false;
+    }
+
+    strcpy(recordingPath, fileName);
+    recordingWidth = CORE.Window.screen.width;
+    recordingHeight = CORE.Window.screen.height;
+    recordingNextTime = GetTime();
+    recordingFramesCounter = 0;
+    recordingFrames = 0;
+    recordingDropped = 0;
+
+    if (recordingFormat == RECORDING_GIF) msf_gif_begin(&gifState, recordingWidth, recordingHeight);
+
+    recordingQueue = LoadJobsQueue(MAX_RECORDING_QUEUE_FRAMES);
+    recording = true;
+
+    TRACELOG(LOG_INFO, "SYSTEM: [%s] Screen recording started (%ix%i, %i fps)", recordingPath, recordingWidth, recordingHeight, recordingFPS);
+
+    return true;
+#else
+    TRACELOG(LOG_WARNING, "SYSTEM: Screen recording not supported");
+
+    return false;
+#endif
+}
+
+// Stop screen recording
+// NOTE: Pending frames are retrieved and calling thread waits for encoder thread to process queued frames
+void StopScreenRecording(void)
+{
+#if defined(SUPPORT_GIF_RECORDING)
+    if (!recording) return;
+
+    FlushTextureReadbacks();        // Queue pending frames
+    recording = false;
+
+    UnloadJobsQueue(recordingQueue);
+    recordingQueue = NULL;
 
-    // TODO: Verification required for log
-    TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", path);
+    if (recordingFormat == RECORDING_GIF)
+    {
+        MsfGifResult result = msf_gif_end(&gifState);
+
+        SaveFileData(recordingPath, result.data, (unsigned int)result.dataSize);
+        msf_gif_free(result);
+
+    #if defined(PLATFORM_WEB)
+        // Download file from MEMFS (emscripten memory filesystem)
+        // saveFileFromMEMFSToDisk() function is defined in raylib/templates/web_shel/shell.html
+        emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", GetFileName(recordingPath), GetFileName(recordingPath)));
+    #endif
+    }
+
+    TRACELOG(LOG_INFO, "SYSTEM: [%s] Screen recording finished (%i frames, %i dropped)", recordingPath, recordingFrames, recordingDropped);
+#endif
+}
+
+// Check if screen recording is running
+bool IsScreenRecording(void)
+{
+#if defined(SUPPORT_GIF_RECORDING)
+    return recording;
+#else
+    return false;
+#endif
+}
+
+// Set screen recording frame rate (frames recorded per second)
+// NOTE: GIF frames delay is defined in centiseconds, so GIF recording is limited to 100 fps
+void SetScreenRecordingFPS(int fps)
+{
+#if defined(SUPPORT_GIF_RECORDING)
+    recordingFPS = (fps < 1)? 1 : fps;
+#endif
 }
 
 // Returns a random value between min and max (both included)
@@ -4527,6 +4675,95 @@ static void PollInputEvents(void)
 #endif
 }
 
+// Save screenshot image once retrieved, userData is the file path (owned)
+static void ScreenshotCallback(Image image, void *userData)
+{
+    char *path = (char *)userData;
+
+    if (image.data != NULL)
+    {
+        ExportImage(image, path);
+
+#if defined(PLATFORM_WEB)
+        // Download file from MEMFS (emscripten memory filesystem)
+        // saveFileFromMEMFSToDisk() function is defined in raylib/src/shell.html
+        emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", GetFileName(path), GetFileName(path)));
+#endif
+
+        // TODO: Verification required for log
+        TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", path);
+    }
+    else TRACELOG(LOG_WARNING, "SYSTEM: [%s] Failed to take screenshot", path);
+
+    UnloadImage(image);
+    RL_FREE(path);
+}
+
+#if defined(SUPPORT_GIF_RECORDING)
+// Queue screen recording frame once retrieved, frame is dropped if encoder queue is full
+// NOTE: GIF frames must match recording size, frames retrieved after a window resize are dropped
+static void RecordingFrameCallback(Image image, void *userData)
+{
+    if (!recording || (image.data == NULL))
+    {
+        UnloadImage(image);
+        return;
+    }
+
+    RecordingFrame *frame = (RecordingFrame *)RL_CALLOC(1, sizeof(RecordingFrame));
+    bool queued = false;
+
+    frame->image = image;
+    frame->delay = (recordingFPS < 100)? 100/recordingFPS : 1;
+
+    if (recordingFormat == RECORDING_GIF) queued = (image.width == recordingWidth) && (image.height == recordingHeight) && PushJobsQueue(recordingQueue, EncodeRecordingFrame, frame);
+    else
+    {
+        // Frame file name: recording file name with frame index appended (dropped frames leave index gaps)
+        const char *ext = strrchr(recordingPath, '.');
+        int length = (int)(ext - recordingPath);
+
+        int size = length + (int)strlen(ext) + 16;
+
+        frame->fileName = (char *)RL_MALLOC(size);
+        snprintf(frame->fileName, size, "%.*s_%05i%s", length, recordingPath, recordingFrames + recordingDropped, ext);
+
+        queued = PushJobsQueue(recordingQueue, EncodeRecordingFrame, frame);
+    }
+
+    if (queued) recordingFrames++;
+    else
+    {
+        recordingDropped++;
+
+        UnloadImage(image);
+        RL_FREE(frame->fileName);
+        RL_FREE(frame);
+    }
+}
+
+// Encode screen recording frame (encoder thread)
+// NOTE: Frames are processed in queue order, GIF palette quantization is done here,
+// frames files are written directly (ExportImage() relies on not thread-safe file name helpers)
+static void EncodeRecordingFrame(void *data)
+{
+    RecordingFrame *frame = (RecordingFrame *)data;
+
+    if (recordingFormat == RECORDING_GIF) msf_gif_frame(&gifState, (unsigned char *)frame->image.data, frame->delay, 16, frame->image.width*4);
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+    else if (recordingFormat == RECORDING_PNG)
+    {
+        if (!stbi_write_png(frame->fileName, frame->image.width, frame->image.height, 4, frame->image.data, frame->image.width*4)) TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to save recording frame", frame->fileName);
+    }
+#endif
+    else if (recordingFormat == RECORDING_RAW) SaveFileData(frame->fileName, frame->image.data, frame->image.width*frame->image.height*4);
+
+    RL_FREE(frame->image.data);     // Screen readback data is never file mapped, no need for UnloadImage()
+    RL_FREE(frame->fileName);
+    RL_FREE(frame);
+}
+#endif
+
 // Copy back buffer to front buffers
 static void SwapBuffers(void)
 {
@@ -4653,12 +4890,9 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
 #if defined(SUPPORT_GIF_RECORDING)
         if (mods == GLFW_MOD_CONTROL)
         {
-            if (gifRecording)
+            if (recording) StopScreenRecording();
+            else
             {
-                gifRecording = false;
-
-                MsfGifResult result = msf_gif_end(&gifState);
-
                 char path[512] = { 0 };
             #if defined(PLATFORM_ANDROID)
                 strcpy(path, CORE.Android.internalDataPath);
@@ -4667,26 +4901,8 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
                 strcpy(path, TextFormat("./screenrec%03i.gif", screenshotCounter));
             #endif
 
-                SaveFileData(path, result.data, (unsigned int)result.dataSize);
-                msf_gif_free(result);
-
-            #if defined(PLATFORM_WEB)
-                // Download file from MEMFS (emscripten memory filesystem)
-                // saveFileFromMEMFSToDisk() function is defined in raylib/templates/web_shel/shell.html
-                emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", TextFormat("screenrec%03i.gif", screenshotCounter - 1), TextFormat("screenrec%03i.gif", screenshotCounter - 1)));
-            #endif
-
-                TRACELOG(LOG_INFO, "SYSTEM: Finish animated GIF recording");
-            }
-            else
-            {
-                gifRecording = true;
-                gifFramesCounter = 0;
-
-                msf_gif_begin(&gifState, CORE.Window.screen.width, CORE.Window.screen.height);
+                StartScreenRecording(path);
                 screenshotCounter++;
-
-                TRACELOG(LOG_INFO, "SYSTEM: Start animated GIF recording: %s", TextFormat("screenrec%03i.gif", screenshotCounter));
             }
         }
         else
@@ -6044,31 +6260,11 @@ void UWPKeyDownEvent(int key, bool down, bool controlKey)
 #if defined(SUPPORT_GIF_RECORDING)
         if (controlKey)
         {
-            if (gifRecording)
-            {
-                gifRecording = false;
-
-                MsfGifResult result = msf_gif_end(&gifState);
-
-                SaveFileData(TextFormat("%s/screenrec%03i.gif", CORE.UWP.internalDataPath, screenshotCounter), result.data, result.dataSize);
-                msf_gif_free(result);
-
-#if defined(PLATFORM_WEB)
-                // Download file from MEMFS (emscripten memory filesystem)
-                // saveFileFromMEMFSToDisk() function is defined in raylib/templates/web_shel/shell.html
-                emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", TextFormat("screenrec%03i.gif", screenshotCounter - 1), TextFormat("screenrec%03i.gif", screenshotCounter - 1)));
-#endif
-                TRACELOG(LOG_INFO, "SYSTEM: Finish animated GIF recording");
-            }
+            if (recording) StopScreenRecording();
             else
             {
-                gifRecording = true;
-                gifFramesCounter = 0;
-
-                msf_gif_begin(&gifState, CORE.Window.screen.width, CORE.Window.screen.height);
+                StartScreenRecording(TextFormat("%s/screenrec%03i.gif", CORE.UWP.internalDataPath, screenshotCounter));
                 screenshotCounter++;
-
-                TRACELOG(LOG_INFO, "SYSTEM: Start animated GIF recording: %s", TextFormat("screenrec%03i.gif", screenshotCounter));
             }
         }
         else
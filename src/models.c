@@ -138,7 +138,7 @@ void DrawLine3D(Vector3 startPos, Vector3 endPos, Color color)
 // Draw a point in 3D space, actually a small line
 void DrawPoint3D(Vector3 position, Color color)
 {
-    if (rlCheckBufferLimit(8)) rlglDraw();
+    rlCheckRenderBatchLimit(8);
 
     rlPushMatrix();
         rlTranslatef(position.x, position.y, position.z);
@@ -153,7 +153,7 @@ void DrawPoint3D(Vector3 position, Color color)
 // Draw a circle in 3D world space
 void DrawCircle3D(Vector3 center, float radius, Vector3 rotationAxis, float rotationAngle, Color color)
 {
-    if (rlCheckBufferLimit(2*36)) rlglDraw();
+    rlCheckRenderBatchLimit(2*36);
 
     rlPushMatrix();
         rlTranslatef(center.x, center.y, center.z);
@@ -174,7 +174,7 @@ void DrawCircle3D(Vector3 center, float radius, Vector3 rotationAxis, float rota
 // Draw a color-filled triangle (vertex in counter-clockwise order!)
 void DrawTriangle3D(Vector3 v1, Vector3 v2, Vector3 v3, Color color)
 {
-    if (rlCheckBufferLimit(3)) rlglDraw();
+    rlCheckRenderBatchLimit(3);
 
     rlBegin(RL_TRIANGLES);
         rlColor4ub(color.r, color.g, color.b, color.a);
@@ -189,7 +189,7 @@ void DrawTriangleStrip3D(Vector3 *points, int pointsCount, Color color)
 {
     if (pointsCount >= 3)
     {
-        if (rlCheckBufferLimit(3*(pointsCount - 2))) rlglDraw();
+        rlCheckRenderBatchLimit(3*(pointsCount - 2));
 
         rlBegin(RL_TRIANGLES);
             rlColor4ub(color.r, color.g, color.b, color.a);
@@ -221,7 +221,7 @@ void DrawCube(Vector3 position, float width, float height, float length, Color c
     float y = 0.0f;
     float z = 0.0f;
 
-    if (rlCheckBufferLimit(36)) rlglDraw();
+    rlCheckRenderBatchLimit(36);
 
     rlPushMatrix();
         // NOTE: Transformation is applied in inverse order (scale -> rotate -> translate)
@@ -302,7 +302,7 @@ void DrawCubeWires(Vector3 position, float width, float height, float length, Co
     float y = 0.0f;
     float z = 0.0f;
 
-    if (rlCheckBufferLimit(36)) rlglDraw();
+    rlCheckRenderBatchLimit(36);
 
     rlPushMatrix();
         rlTranslatef(position.x, position.y, position.z);
@@ -379,7 +379,7 @@ void DrawCubeTexture(Texture2D texture, Vector3 position, float width, float hei
     float y = position.y;
     float z = position.z;
 
-    if (rlCheckBufferLimit(36)) rlglDraw();
+    rlCheckRenderBatchLimit(36);
 
     rlEnableTexture(texture.id);
 
@@ -443,7 +443,7 @@ void DrawSphere(Vector3 centerPos, float radius, Color color)
 void DrawSphereEx(Vector3 centerPos, float radius, int rings, int slices, Color color)
 {
     int numVertex = (rings + 2)*slices*6;
-    if (rlCheckBufferLimit(numVertex)) rlglDraw();
+    rlCheckRenderBatchLimit(numVertex);
 
     rlPushMatrix();
         // NOTE: Transformation is applied in inverse order (scale -> translate)
@@ -486,7 +486,7 @@ void DrawSphereEx(Vector3 centerPos, float radius, int rings, int slices, Color
 void DrawSphereWires(Vector3 centerPos, float radius, int rings, int slices, Color color)
 {
     int numVertex = (rings + 2)*slices*6;
-    if (rlCheckBufferLimit(numVertex)) rlglDraw();
+    rlCheckRenderBatchLimit(numVertex);
 
     rlPushMatrix();
         // NOTE: Transformation is applied in inverse order (scale -> translate)
@@ -533,7 +533,7 @@ void DrawCylinder(Vector3 position, float radiusTop, float radiusBottom, float h
     if (sides < 3) sides = 3;
 
     int numVertex = sides*6;
-    if (rlCheckBufferLimit(numVertex)) rlglDraw();
+    rlCheckRenderBatchLimit(numVertex);
 
     rlPushMatrix();
         rlTranslatef(position.x, position.y, position.z);
@@ -592,7 +592,7 @@ void DrawCylinderWires(Vector3 position, float radiusTop, float radiusBottom, fl
     if (sides < 3) sides = 3;
 
     int numVertex = sides*8;
-    if (rlCheckBufferLimit(numVertex)) rlglDraw();
+    rlCheckRenderBatchLimit(numVertex);
 
     rlPushMatrix();
         rlTranslatef(position.x, position.y, position.z);
@@ -621,7 +621,7 @@ void DrawCylinderWires(Vector3 position, float radiusTop, float radiusBottom, fl
 // Draw a plane
 void DrawPlane(Vector3 centerPos, Vector2 size, Color color)
 {
-    if (rlCheckBufferLimit(4)) rlglDraw();
+    rlCheckRenderBatchLimit(4);
 
     // NOTE: Plane is always created on XZ ground
     rlPushMatrix();
@@ -659,7 +659,7 @@ void DrawGrid(int slices, float spacing)
 {
     int halfSlices = slices/2;
 
-    if (rlCheckBufferLimit((slices + 2)*4)) rlglDraw();
+    rlCheckRenderBatchLimit((slices + 2)*4);
 
     rlBegin(RL_LINES);
         for (int i = -halfSlices; i <= halfSlices; i++)
@@ -864,6 +864,27 @@ void UnloadMesh(Mesh mesh)
     RL_FREE(mesh.vboId);
 }
 
+// Load instance buffer with per-instance attributes (VRAM)
+// NOTE: Attributes are interleaved in the provided order, defined by shader location and size in floats
+// (1 to 4, or 16 for a matrix that uses 4 consecutive locations), i.e. { transform (16), color (4) }
+InstanceBuffer LoadInstanceBuffer(int capacity, int *attribLocs, int *attribSizes, int attribsCount)
+{
+    return rlLoadInstanceBuffer(capacity, attribLocs, attribSizes, attribsCount);
+}
+
+// Update instance buffer data (interleaved attributes, grows if required)
+// NOTE: Matrix attributes must be provided as float16, use MatrixToFloatV()
+void UpdateInstanceBuffer(InstanceBuffer *buffer, const void *data, int count)
+{
+    rlUpdateInstanceBuffer(buffer, data, count);
+}
+
+// Unload instance buffer from memory (RAM and VRAM)
+void UnloadInstanceBuffer(InstanceBuffer buffer)
+{
+    rlUnloadInstanceBuffer(buffer);
+}
+
 // Export mesh data to file
 bool ExportMesh(Mesh mesh, const char *fileName)
 {
@@ -2411,6 +2432,13 @@ void DrawModelWiresEx(Model model, Vector3 position, Vector3 rotationAxis, float
     rlDisableWireMode();
 }
 
+// Draw a mesh multiple times with per-instance attributes (transform, color...)
+// NOTE: Material shader must read instance attributes from the locations defined in the instance buffer
+void DrawMeshInstanced(Mesh mesh, Material material, InstanceBuffer instances)
+{
+    rlDrawMeshInstancedBuffer(mesh, material, instances);
+}
+
 // Draw a billboard
 void DrawBillboard(Camera camera, Texture2D texture, Vector3 center, float size, Color tint)
 {
@@ -2450,7 +2478,7 @@ void DrawBillboardRec(Camera camera, Texture2D texture, Rectangle source, Vector
     Vector3 c = Vector3Add(center, p2);
     Vector3 d = Vector3Subtract(center, p1);
 
-    if (rlCheckBufferLimit(4)) rlglDraw();
+    rlCheckRenderBatchLimit(4);
 
     rlEnableTexture(texture.id);
 
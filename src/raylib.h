@@ -253,6 +253,15 @@ typedef struct RenderTexture {
 // RenderTexture2D type, same as RenderTexture
 typedef RenderTexture RenderTexture2D;
 
+// ImageStream type, animated image frames decoded progressively into one texture
+typedef struct ImageStream {
+    Texture2D texture;      // Current frame texture (updated on UpdateImageStream())
+    int frameCount;         // Total number of frames
+    bool looping;           // Animation looping enable
+
+    void *ctxData;          // Stream context data (decoder state and decoded frames)
+} ImageStream;
+
 // N-Patch layout info
 typedef struct NPatchInfo {
     Rectangle source;   // Region in the texture
@@ -280,10 +289,25 @@ typedef struct Font {
     Texture2D texture;      // Characters texture atlas
     Rectangle *recs;        // Characters rectangles in texture
     CharInfo *chars;        // Characters info data
+    void *glyphLookup;      // Codepoints to characters index lookup (built on font loading, glyphs cache on dynamic fonts)
 } Font;
 
 #define SpriteFont Font     // SpriteFont type fallback, defaults to Font
 
+// TextLayout type, text glyphs positioned once to be drawn many times
+typedef struct TextLayout {
+    Font font;              // Font used for layout
+    char *text;             // Text used for layout (copy, NULL if empty)
+    float fontSize;         // Font size used for layout
+    float spacing;          // Characters spacing used for layout
+    float wrapWidth;        // Lines wrap width used for layout (0 for no wrapping)
+    int glyphsCount;        // Number of positioned glyphs
+    int *codepoints;        // Glyphs codepoints
+    Rectangle *srcRecs;     // Glyphs rectangles in font texture (including padding)
+    Rectangle *dstRecs;     // Glyphs rectangles relative to layout position (including padding)
+    Vector2 size;           // Layout measured size
+} TextLayout;
+
 // Camera type, defines a camera position/orientation in 3d space
 typedef struct Camera3D {
     Vector3 position;       // Camera position
@@ -329,6 +353,17 @@ typedef struct Mesh {
     unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (default vertex data)
 } Mesh;
 
+// Instance buffer, per-instance attributes data for instanced drawing
+typedef struct InstanceBuffer {
+    int capacity;           // Number of instances that fit in the buffer (grows on update if required)
+    int count;              // Number of instances to draw
+    int stride;             // Instance data size in bytes (all attributes interleaved)
+    int attribsCount;       // Number of per-instance attributes
+    int *attribLocs;        // Attributes shader locations (matrix attributes use 4 consecutive locations)
+    int *attribSizes;       // Attributes size in floats (1 to 4, 16 for matrix)
+    unsigned int vboId;     // OpenGL Vertex Buffer Object id (instance data)
+} InstanceBuffer;
+
 // Shader type (generic)
 typedef struct Shader {
     unsigned int id;        // Shader program id
@@ -879,6 +914,8 @@ typedef void *(*MemReallocCallback)(int size);
 typedef void (*MemFreeCallback)(void *ptr);
 typedef unsigned char* (*LoadFileDataCallback)(const char* fileName, unsigned int* bytesRead);       // Load file data as byte array (read)
 typedef char* (*LoadFileTextCallback)(const char* fileName);                                        // Load text data from file (read), returns a '\0' terminated string
+typedef void (*TextureLoadCallback)(int request, Texture2D texture, void *userData);                // Async texture loading completed (texture id 0 on failure)
+typedef void (*ImageReadCallback)(Image image, void *userData);                                     // Async image retrieval completed (image owned by callback)
 
 #if defined(__cplusplus)
 extern "C" {            // Prevents name mangling of functions
@@ -973,6 +1010,10 @@ RLAPI double GetTime(void);                                       // Returns ela
 // Misc. functions
 RLAPI int GetRandomValue(int min, int max);                       // Returns a random value between min and max (both included)
 RLAPI void TakeScreenshot(const char *fileName);                  // Takes a screenshot of current screen (filename extension defines format)
+RLAPI bool StartScreenRecording(const char *fileName);            // Start screen recording (.gif animation or .png/.raw frames sequence), frames encoded on a background thread
+RLAPI void StopScreenRecording(void);                             // Stop screen recording, waits for queued frames to be encoded and saved
+RLAPI bool IsScreenRecording(void);                               // Check if screen recording is running
+RLAPI void SetScreenRecordingFPS(int fps);                        // Set screen recording frame rate (frames recorded per second)
 RLAPI void SetConfigFlags(unsigned int flags);                    // Setup init configuration flags (view FLAGS)
 
 RLAPI void TraceLog(int logType, const char *text, ...);          // Show trace log messages (LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR)
@@ -1152,7 +1193,8 @@ RLAPI Image LoadImage(const char *fileName);
 RLAPI Image LoadImageRaw(const char *fileName, int width, int height, int format, int headerSize);       // Load image from RAW file data
 RLAPI Image LoadImageAnim(const char *fileName, int *frames);                                            // Load image sequence from file (frames appended to image.data)
 RLAPI Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize);      // Load image from memory buffer, fileType refers to extension: i.e. "png"
-RLAPI void UnloadImage(Image image);                                                                     // Unload image from CPU memory (RAM)
+RLAPI Image LoadImageMapped(const char *fileName);                                                       // Load image from container file (DDS, KTX, PVR, ASTC), compressed data points to file memory mapping (read-only)
+RLAPI void UnloadImage(Image image);                                                                     // Unload image from CPU memory (RAM), mapped image data is unmapped
 RLAPI bool ExportImage(Image image, const char *fileName);                                               // Export image data to file, returns true on success
 RLAPI bool ExportImageAsCode(Image image, const char *fileName);                                         // Export image as code file defining an array of bytes, returns true on success
 
@@ -1172,6 +1214,7 @@ RLAPI Image ImageFromImage(Image image, Rectangle rec);
 RLAPI Image ImageText(const char *text, int fontSize, Color color);                                      // Create an image from text (default font)
 RLAPI Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Color tint);         // Create an image from text (custom sprite font)
 RLAPI void ImageFormat(Image *image, int newFormat);                                                     // Convert image data to desired format
+RLAPI void ImageCompress(Image *image, int newFormat, int quality);                                      // Compress image data to block compressed format (DXT, ETC), quality: 0 (fastest) to 2 (best)
 RLAPI void ImageToPOT(Image *image, Color fill);                                                         // Convert image to POT (power-of-two)
 RLAPI void ImageCrop(Image *image, Rectangle crop);                                                      // Crop an image to a defined rectangle
 RLAPI void ImageAlphaCrop(Image *image, float threshold);                                                // Crop image depending on alpha value
@@ -1183,6 +1226,7 @@ RLAPI void ImageResizeNN(Image *image, int newWidth,int newHeight);
 RLAPI void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill);  // Resize canvas and fill with color
 RLAPI void ImageMipmaps(Image *image);                                                                   // Generate all mipmap levels for a provided image
 RLAPI void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp);                            // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
+RLAPI void ImageQuantize(Image *image, int maxPaletteSize, bool dither);                                // Quantize image colors to a palette (median-cut), optionally dithered (Floyd-Steinberg)
 RLAPI void ImageFlipVertical(Image *image);                                                              // Flip image vertically
 RLAPI void ImageFlipHorizontal(Image *image);                                                            // Flip image horizontally
 RLAPI void ImageRotateCW(Image *image);                                                                  // Rotate image clockwise 90deg
@@ -1193,10 +1237,14 @@ RLAPI void ImageColorGrayscale(Image *image);
 RLAPI void ImageColorContrast(Image *image, float contrast);                                             // Modify image color: contrast (-100 to 100)
 RLAPI void ImageColorBrightness(Image *image, int brightness);                                           // Modify image color: brightness (-255 to 255)
 RLAPI void ImageColorReplace(Image *image, Color color, Color replace);                                  // Modify image color: replace color
+RLAPI void SetImageProcessingThreads(int count);                                                         // Set threads used by image processing functions (1 = serial)
 RLAPI Color *LoadImageColors(Image image);                                                               // Load color data from image as a Color array (RGBA - 32bit)
 RLAPI Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorsCount);                        // Load colors palette from image as a Color array (RGBA - 32bit)
+RLAPI Color *LoadImagePaletteQuantized(Image image, int maxPaletteSize, int *colorsCount);               // Load quantized colors palette from image (median-cut, 256 colors max)
+RLAPI unsigned char *LoadImagePaletteIndices(Image image, Color *palette, int colorsCount, bool dither);   // Load image pixels as palette colors indices (8bit), optionally dithered
 RLAPI void UnloadImageColors(Color *colors);                                                             // Unload color data loaded with LoadImageColors()
 RLAPI void UnloadImagePalette(Color *colors);                                                            // Unload colors palette loaded with LoadImagePalette()
+RLAPI void UnloadImagePaletteIndices(unsigned char *indices);                                            // Unload palette colors indices loaded with LoadImagePaletteIndices()
 RLAPI Rectangle GetImageAlphaBorder(Image image, float threshold);                                       // Get image alpha border rectangle
 
 // Image drawing functions
@@ -1220,6 +1268,15 @@ RLAPI void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 posi
 // NOTE: These functions require GPU access
 RLAPI Texture2D LoadTexture(const char *fileName);                                                       // Load texture from file into GPU memory (VRAM)
 RLAPI Texture2D LoadTextureFromImage(Image image);                                                       // Load texture from image data
+RLAPI int LoadTextureAsync(const char *fileName, bool mipmaps, int format);                              // Load texture from file asynchronously (format 0 keeps file format), returns request id (not reused once released)
+RLAPI void SetTextureAsyncCallback(int request, TextureLoadCallback callback, void *userData);           // Set async texture request completion callback (texture owned by callback)
+RLAPI bool IsTextureAsyncReady(int request);                                                            // Check if async texture request is completed (loaded or failed)
+RLAPI Texture2D GetTextureAsync(int request);                                                            // Get texture from completed async request (request released)
+RLAPI ImageStream LoadImageStream(const char *fileName);                                                  // Load animated image stream (GIF), frames decoded on demand into stream texture
+RLAPI void UnloadImageStream(ImageStream stream);                                                        // Unload animated image stream
+RLAPI void UpdateImageStream(ImageStream stream);                                                        // Update animated image stream playback (stream texture updated with current frame)
+RLAPI void SeekImageStream(ImageStream stream, int frame);                                               // Seek animated image stream to frame
+RLAPI int GetImageStreamFrame(ImageStream stream);                                                       // Get animated image stream current frame
 RLAPI TextureCubemap LoadTextureCubemap(Image image, int layoutType);                                    // Load cubemap from image, multiple image cubemap layouts supported
 RLAPI RenderTexture2D LoadRenderTexture(int width, int height);                                          // Load texture for rendering (framebuffer)
 RLAPI void UnloadTexture(Texture2D texture);                                                             // Unload texture from GPU memory (VRAM)
@@ -1228,11 +1285,14 @@ RLAPI void UpdateTexture(Texture2D texture, const void *pixels);
 RLAPI void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels);                       // Update GPU texture rectangle with new data
 RLAPI Image GetTextureData(Texture2D texture);                                                           // Get pixel data from GPU texture and return an Image
 RLAPI Image GetScreenData(void);                                                                         // Get pixel data from screen buffer and return an Image (screenshot)
+RLAPI void GetTextureDataAsync(Texture2D texture, ImageReadCallback callback, void *userData);          // Get pixel data from GPU texture asynchronously (image provided to callback some frames later)
+RLAPI void GetScreenDataAsync(ImageReadCallback callback, void *userData);                               // Get pixel data from screen buffer asynchronously (image provided to callback some frames later)
 
 // Texture configuration functions
 RLAPI void GenTextureMipmaps(Texture2D *texture);                                                        // Generate GPU mipmaps for a texture
 RLAPI void SetTextureFilter(Texture2D texture, int filterMode);                                          // Set texture scaling filter mode
 RLAPI void SetTextureWrap(Texture2D texture, int wrapMode);                                              // Set texture wrapping mode
+RLAPI void SetTextureUploadBudget(float milliseconds, int bytes);                                        // Set per-frame async textures upload budget (0 = unlimited)
 
 // Texture drawing functions
 RLAPI void DrawTexture(Texture2D texture, int posX, int posY, Color tint);                               // Draw a Texture2D
@@ -1266,8 +1326,12 @@ RLAPI int GetPixelDataSize(int width, int height, int format);              // G
 RLAPI Font GetFontDefault(void);                                                            // Get the default Font
 RLAPI Font LoadFont(const char *fileName);                                                  // Load font from file into GPU memory (VRAM)
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int charsCount);  // Load font from file with extended parameters
+RLAPI Font LoadFontCached(const char *fileName, int fontSize, int *fontChars, int charsCount, const char *cacheFileName); // Load font from file using a font cache file (generated if not valid)
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int charsCount); // Load font from memory buffer, fileType refers to extension: i.e. "ttf"
+RLAPI Font LoadFontDynamic(const char *fileName, int fontSize, int atlasSize);                 // Load font with glyphs rasterized on demand into a glyphs cache atlas (TTF data kept loaded, main thread only)
+RLAPI Font LoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int atlasSize); // Load dynamic font from memory buffer, fileType refers to extension: i.e. "ttf"
+RLAPI void SetFontLoadingThreads(int count);                                                  // Set threads used to rasterize font glyphs on loading (default 1 = serial, opt-in)
 RLAPI CharInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int charsCount, int type);      // Load font data for further use
 RLAPI Image GenImageFontAtlas(const CharInfo *chars, Rectangle **recs, int charsCount, int fontSize, int padding, int packMethod);      // Generate image font atlas using chars info
 RLAPI void UnloadFontData(CharInfo *chars, int charsCount);                                 // Unload font chars info data (RAM)
@@ -1275,6 +1339,7 @@ RLAPI void UnloadFont(Font font);
 
 // Text drawing functions
 RLAPI void DrawFPS(int posX, int posY);                                                     // Shows current FPS
+RLAPI void DrawFrameStats(int posX, int posY);                                              // Shows last frame rendering statistics (draw calls, vertices, flushes...)
 RLAPI void DrawText(const char *text, int posX, int posY, int fontSize, Color color);       // Draw text (using default font)
 RLAPI void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint);                // Draw text using font and additional parameters
 RLAPI void DrawTextRec(Font font, const char *text, Rectangle rec, float fontSize, float spacing, bool wordWrap, Color tint);   // Draw text using font inside rectangle limits
@@ -1282,10 +1347,16 @@ RLAPI void DrawTextRecEx(Font font, const char *text, Rectangle rec, float fontS
                          int selectStart, int selectLength, Color selectTint, Color selectBackTint);    // Draw text using font inside rectangle limits with support for text selection
 RLAPI void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint);   // Draw one character (codepoint)
 
+// Text layout functions (text positioned once, drawn many times)
+RLAPI TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing, float wrapWidth);                      // Load text layout, lines wrapped at wrapWidth (0 for no wrapping)
+RLAPI bool UpdateTextLayout(TextLayout *layout, Font font, const char *text, float fontSize, float spacing, float wrapWidth);      // Update text layout if any input changed, returns true if layout was rebuilt
+RLAPI void UnloadTextLayout(TextLayout layout);                                              // Unload text layout data
+RLAPI void DrawTextLayout(TextLayout layout, Vector2 position, Color tint);                  // Draw text layout
+
 // Text misc. functions
 RLAPI int MeasureText(const char *text, int fontSize);                                      // Measure string width for default font
 RLAPI Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing);    // Measure string size for Font
-RLAPI int GetGlyphIndex(Font font, int codepoint);                                          // Get index position for a unicode character on font
+RLAPI int GetGlyphIndex(Font font, int codepoint);                                          // Get index position for a unicode character on font (dynamic fonts: main thread with GL context, index valid until next lookup)
 
 // Text strings management functions (no utf8 strings, only byte chars)
 // NOTE: Some strings allocate memory internally for returned strings, just be careful!
@@ -1353,6 +1424,11 @@ RLAPI void UploadMesh(Mesh *mesh);
 RLAPI void UnloadMesh(Mesh mesh);                                                                       // Unload mesh from memory (RAM and/or VRAM)
 RLAPI bool ExportMesh(Mesh mesh, const char *fileName);                                                 // Export mesh data to file, returns true on success
 
+// Instance buffer loading/unloading functions
+RLAPI InstanceBuffer LoadInstanceBuffer(int capacity, int *attribLocs, int *attribSizes, int attribsCount); // Load instance buffer with per-instance attributes (VRAM)
+RLAPI void UpdateInstanceBuffer(InstanceBuffer *buffer, const void *data, int count);                   // Update instance buffer data (interleaved attributes, grows if required)
+RLAPI void UnloadInstanceBuffer(InstanceBuffer buffer);                                                 // Unload instance buffer from memory (RAM and VRAM)
+
 // Material loading/unloading functions
 RLAPI Material *LoadMaterials(const char *fileName, int *materialCount);                                // Load materials from model file
 RLAPI Material LoadMaterialDefault(void);                                                               // Load default material (Supports: DIFFUSE, SPECULAR, NORMAL maps)
@@ -1388,6 +1464,7 @@ RLAPI void DrawModel(Model model, Vector3 position, float scale, Color tint);
 RLAPI void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint); // Draw a model with extended parameters
 RLAPI void DrawModelWires(Model model, Vector3 position, float scale, Color tint);                      // Draw a model wires (with texture if set)
 RLAPI void DrawModelWiresEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint); // Draw a model wires (with texture if set) with extended parameters
+RLAPI void DrawMeshInstanced(Mesh mesh, Material material, InstanceBuffer instances);                   // Draw a mesh multiple times with per-instance attributes (transform, color...)
 RLAPI void DrawBoundingBox(BoundingBox box, Color color);                                               // Draw bounding box (wires)
 RLAPI void DrawBillboard(Camera camera, Texture2D texture, Vector3 center, float size, Color tint);     // Draw a billboard texture
 RLAPI void DrawBillboardRec(Camera camera, Texture2D texture, Rectangle source, Vector3 center, float size, Color tint); // Draw a billboard texture defined by source
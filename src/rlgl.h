@@ -146,6 +146,23 @@
 #ifndef DEFAULT_BATCH_BUFFERS
     #define DEFAULT_BATCH_BUFFERS            1      // Default number of batch buffers (multi-buffering)
 #endif
+#ifndef DEFAULT_BATCH_VERTEX_FORMAT
+    #define DEFAULT_BATCH_VERTEX_FORMAT      0      // Default render batch vertex format (BatchVertexFormat), compact format only for 2D drawing
+#endif
+#ifndef MAX_BATCH_BUFFERS
+    #define MAX_BATCH_BUFFERS                8      // Maximum number of batch buffers supported on rlSetRenderBatchBuffers()
+#endif
+#ifndef BATCH_ELEMENT_INDICES
+    #define BATCH_ELEMENT_INDICES           12      // Draw indices (rlIndex()) per batch buffer element, 3 per vertex (enough for fans and strips)
+#endif
+#define UNIFORM_MATRIX                    100      // Shader uniform data type for matrices (only used by uniforms cache)
+
+#ifndef MAX_STATE_TEXTURE_UNITS
+    #define MAX_STATE_TEXTURE_UNITS         16      // Maximum number of texture units tracked by GL state cache
+#endif
+#ifndef MAX_READBACK_BUFFERS
+    #define MAX_READBACK_BUFFERS             8      // Maximum number of pending pixels readbacks (rlReadScreenPixelsAsync(), rlReadTexturePixelsAsync())
+#endif
 #ifndef DEFAULT_BATCH_DRAWCALLS
     #define DEFAULT_BATCH_DRAWCALLS        256      // Default number of batch draw calls (by state changes: mode, texture)
 #endif
@@ -208,6 +225,52 @@
 //----------------------------------------------------------------------------------
 typedef enum { OPENGL_11 = 1, OPENGL_21, OPENGL_33, OPENGL_ES_20 } GlVersion;
 
+// Render batch draw calls sorting modes
+typedef enum {
+    RL_BATCH_SORT_NONE = 0,     // Draw calls are processed in submission order (default)
+    RL_BATCH_SORT_LAYERED,      // Draw calls are sorted by layer and grouped by texture and mode inside every layer
+    RL_BATCH_SORT_DEPTH         // Same as layered, drawn with depth test enabled (opaque content)
+} BatchSortMode;
+
+// Render batch vertex formats (vertex data layout on GPU)
+typedef enum {
+    RL_VERTEX_FORMAT_DEFAULT = 0,   // Position (3 float), texcoord (2 float) and color (4 ubyte) buffers, 24 bytes per vertex
+    RL_VERTEX_FORMAT_COMPACT_2D     // Interleaved position (2 float), texcoord (2 ushort normalized) and color (4 ubyte), 16 bytes per vertex
+} BatchVertexFormat;
+
+// GL state cache statistics (redundant state changes skipped)
+typedef struct StateCacheStats {
+    unsigned int programCalls;      // Shader program changes issued (glUseProgram())
+    unsigned int programSkipped;    // Shader program changes skipped
+    unsigned int vertexArrayCalls;  // Vertex array changes issued (glBindVertexArray())
+    unsigned int vertexArraySkipped;    // Vertex array changes skipped
+    unsigned int textureCalls;      // Texture unit and binding changes issued (glActiveTexture(), glBindTexture())
+    unsigned int textureSkipped;    // Texture unit and binding changes skipped
+    unsigned int stateCalls;        // Capabilities, blending and scissor changes issued (glEnable(), glBlendFunc()...)
+    unsigned int stateSkipped;      // Capabilities, blending and scissor changes skipped
+    unsigned int uniformCalls;      // Shader uniform values uploaded (glUniform*())
+    unsigned int uniformSkipped;    // Shader uniform values skipped (same value already uploaded)
+} StateCacheStats;
+
+// Render batch flush reasons
+typedef enum {
+    RL_FLUSH_EXPLICIT = 0,      // Draw requested (rlglDraw(), end of frame, shader/blend mode/render target changes...)
+    RL_FLUSH_BUFFER_FULL,       // Vertex buffer limit reached
+    RL_FLUSH_DRAWCALLS_LIMIT,   // Draw calls limit reached
+    RL_FLUSH_TEXTURE_CHANGE     // Additional active texture required and all batch active textures slots were in use
+} FlushReason;
+
+// Frame rendering statistics
+typedef struct FrameStats {
+    unsigned int drawCalls;         // GPU draw calls issued (render batch draw calls, meshes, instanced meshes)
+    unsigned int vertices;          // Vertices drawn (render batch and meshes, considering instances)
+    unsigned int flushes[4];        // Render batch flushes by reason (FlushReason)
+    unsigned int bytesUploaded;     // Bytes uploaded to GPU buffers (render batch, instance and uniform buffers)
+    unsigned int meshDraws;         // Meshes drawn (instanced draws count once)
+    unsigned int textureBinds;      // Texture bindings issued (glBindTexture())
+    unsigned int shaderSwitches;    // Shader program changes issued (glUseProgram())
+} FrameStats;
+
 typedef enum {
     RL_ATTACHMENT_COLOR_CHANNEL0 = 0,
     RL_ATTACHMENT_COLOR_CHANNEL1,
@@ -293,6 +356,17 @@ typedef enum {
         unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (7 types of vertex data)
     } Mesh;
 
+    // Instance buffer, per-instance attributes data for instanced drawing
+    typedef struct InstanceBuffer {
+        int capacity;           // Number of instances that fit in the buffer (grows on update if required)
+        int count;              // Number of instances to draw
+        int stride;             // Instance data size in bytes (all attributes interleaved)
+        int attribsCount;       // Number of per-instance attributes
+        int *attribLocs;        // Attributes shader locations (matrix attributes use 4 consecutive locations)
+        int *attribSizes;       // Attributes size in floats (1 to 4, 16 for matrix)
+        unsigned int vboId;     // OpenGL Vertex Buffer Object id (instance data)
+    } InstanceBuffer;
+
     // Shader type (generic)
     typedef struct Shader {
         unsigned int id;        // Shader program id
@@ -467,6 +541,72 @@ typedef enum {
     #define MAP_SPECULAR     MAP_METALNESS
 #endif
 
+// Dynamic vertex buffers (position + texcoords + colors + indices arrays)
+typedef struct VertexBuffer {
+    int elementsCount;          // Number of elements in the buffer (QUADS)
+
+    int vCounter;               // Vertex position counter to process (and draw) from full buffer
+    int tcCounter;              // Vertex texcoord counter to process (and draw) from full buffer
+    int cCounter;               // Vertex color counter to process (and draw) from full buffer
+
+    float *vertices;            // Vertex position (XYZ - 3 components per vertex) (shader-location = 0)
+    float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
+    unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
+#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
+    unsigned int *indices;      // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned short *indices;    // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
+#endif
+#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
+    unsigned int *drawIndices;  // Draw indices provided with rlIndex() (vertex positions in the buffer)
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned short *drawIndices;    // Draw indices provided with rlIndex() (vertex positions in the buffer)
+#endif
+    unsigned char *interleaved; // Interleaved vertex data to be uploaded (compact vertex format only)
+    int iCounter;               // Draw indices counter to process (and draw) from full buffer
+    int indexUploadCounter;     // Draw indices counter already uploaded to GPU buffer
+    unsigned int vaoId;         // OpenGL Vertex Array Object id
+    unsigned int vboId[5];      // OpenGL Vertex Buffer Objects id (4 types of vertex data + draw indices)
+    void *fence;                // OpenGL fence sync object (GLsync), signaled when GPU finished drawing this buffer
+    int busyCount;              // Number of times buffer was still in use by GPU when required for update
+    int uploadCounter;          // Vertex counter already uploaded to GPU buffers (only new data is uploaded on retained batches)
+} VertexBuffer;
+
+// Draw call type
+// NOTE: Only texture, mode, layer and per-draw transform changes register a new draw, other state-change-related elements are not
+// used at this moment (vaoId, shaderId, matrices), raylib just forces a batch draw call if any
+// of those state-change happens (this is done in core module)
+typedef struct DrawCall {
+    int mode;                   // Drawing mode: LINES, TRIANGLES, QUADS
+    int vertexCount;            // Number of vertex of the draw
+    int vertexAlignment;        // Number of vertex required for index alignment (LINES, TRIANGLES)
+    int indexCount;             // Number of draw indices (indexed draw, vertex are drawn only through rlIndex() indices)
+    //unsigned int vaoId;       // Vertex array id to be used on the draw -> Using RLGL.currentBatch->vertexBuffer.vaoId
+    //unsigned int shaderId;    // Shader id to be used on the draw -> Using RLGL.currentShader.id
+    unsigned int textureId;     // Texture id to be used on the draw -> Use to create new draw call if changes
+    int layer;                  // Draw layer, used as sorting key on sorted batches -> Use to create new draw call if changes
+    Matrix transform;           // Draw transform matrix, applied on shader (identity if vertex are transformed on CPU)
+
+    //Matrix projection;        // Projection matrix for this draw -> Using RLGL.projection
+    //Matrix modelview;         // Modelview matrix for this draw -> Using RLGL.modelview
+} DrawCall;
+
+// RenderBatch type
+typedef struct RenderBatch {
+    int buffersCount;           // Number of vertex buffers (multi-buffering support)
+    int currentBuffer;          // Current buffer tracking in case of multi-buffering
+    VertexBuffer *vertexBuffer; // Dynamic buffer(s) for vertex data
+
+    DrawCall *draws;            // Draw calls array, depends on textureId
+    int drawsCounter;           // Draw calls counter
+    int drawsCapacity;          // Draw calls array size (maximum draw calls before a forced flush)
+    float currentDepth;         // Current depth value for next draw
+    int sortMode;               // Draw calls sorting mode (BatchSortMode)
+    int vertexFormat;           // Vertex data format on GPU (BatchVertexFormat)
+
+    bool retained;              // Retained batch: vertex data is kept after drawing, to be re-submitted every frame
+} RenderBatch;
+
 #if defined(__cplusplus)
 extern "C" {            // Prevents name mangling of functions
 #endif
@@ -494,6 +634,7 @@ RLAPI void rlEnd(void);                               // Finish vertex providing
 RLAPI void rlVertex2i(int x, int y);                  // Define one vertex (position) - 2 int
 RLAPI void rlVertex2f(float x, float y);              // Define one vertex (position) - 2 float
 RLAPI void rlVertex3f(float x, float y, float z);     // Define one vertex (position) - 3 float
+RLAPI void rlIndex(int index);                        // Define one vertex index (relative to first vertex after rlBegin())
 RLAPI void rlTexCoord2f(float x, float y);            // Define one vertex (texture coordinate) - 2 float
 RLAPI void rlNormal3f(float x, float y, float z);     // Define one vertex (normal) - 3 float
 RLAPI void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a);  // Define one vertex (color) - 4 byte
@@ -542,10 +683,54 @@ RLAPI void rlCheckErrors(void);                       // Check and log OpenGL er
 
 RLAPI int rlGetVersion(void);                         // Returns current OpenGL version
 RLAPI bool rlCheckBufferLimit(int vCount);            // Check internal buffer overflow for a given number of vertex
+RLAPI bool rlCheckRenderBatchLimit(int vCount);       // Check internal buffer overflow for a given number of vertex and force a render batch draw if required
+RLAPI bool rlCheckBufferLimitEx(int vCount, int iCount);        // Check internal buffer overflow for a given number of vertex and draw indices
+RLAPI bool rlCheckRenderBatchLimitEx(int vCount, int iCount);   // Check internal buffer overflow for a given number of vertex and draw indices and force a render batch draw if required
 RLAPI void rlSetDebugMarker(const char *text);        // Set debug marker for analysis
 RLAPI void rlSetBlendMode(int glSrcFactor, int glDstFactor, int glEquation);    // // Set blending mode factor and equation (using OpenGL factors)
 RLAPI void rlLoadExtensions(void *loader);            // Load OpenGL extensions
 
+// Render batch management
+// NOTE: rlgl provides a default render batch to behave like OpenGL 1.1 immediate mode
+// but this render batch API is exposed in case of custom batches are required.
+// Setting batch.retained = true keeps its vertex data after drawing, so static geometry
+// can be filled once (while batch is active) and re-submitted every frame with rlDrawRenderBatch(),
+// retained batches grow their buffers if vertex data or draw calls exceed batch capacity
+RLAPI RenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements, int drawsCapacity);  // Load a render batch system
+RLAPI RenderBatch rlLoadRenderBatchEx(int numBuffers, int bufferElements, int drawsCapacity, int vertexFormat);  // Load a render batch system with vertex format (BatchVertexFormat)
+RLAPI void rlUnloadRenderBatch(RenderBatch batch);    // Unload render batch system
+RLAPI void rlDrawRenderBatch(RenderBatch *batch);     // Draw render batch data (Update->Draw->Reset)
+RLAPI void rlResetRenderBatch(RenderBatch *batch);    // Reset render batch data (required to refill a retained batch)
+RLAPI void rlSetRenderBatchActive(RenderBatch *batch);  // Set the active render batch for rlgl (NULL for default internal)
+RLAPI void rlSetRenderBatchBuffers(int count);        // Set default render batch buffers count (multi-buffering ring depth)
+RLAPI void rlSetRenderBatchSortMode(int mode);        // Set active render batch draw calls sorting mode (BatchSortMode)
+RLAPI void rlSetDrawLayer(int layer);                 // Set draw layer for next vertex data (sorting key on sorted batches)
+RLAPI void rlEnableDrawTransform(void);               // Enable per-draw transform (rlPushMatrix() transform applied on shader, one draw call per transform)
+RLAPI void rlDisableDrawTransform(void);              // Disable per-draw transform (rlPushMatrix() transform applied to every vertex on CPU)
+RLAPI int rlGetRenderBatchBusyCount(void);            // Get number of times a batch buffer was still in use by GPU when re-uploaded
+
+// GL state cache
+// NOTE: rlgl keeps a shadow copy of bound program, VAO, textures and enabled capabilities,
+// external OpenGL calls changing that state require rlInvalidateStateCache()
+RLAPI StateCacheStats rlGetStateCacheStats(void);     // Get GL state cache statistics
+RLAPI void rlResetStateCacheStats(void);              // Reset GL state cache statistics
+RLAPI void rlInvalidateStateCache(void);              // Invalidate GL state cache (next state changes are always issued)
+
+// Frame statistics
+// NOTE: Counters are accumulated during the frame, rlResetFrameStats() must be called at frame end
+// (raylib does it on EndDrawing()), rlGetFrameStats() returns the last finished frame counters
+RLAPI FrameStats rlGetFrameStats(void);               // Get rendering statistics of last frame
+RLAPI void rlResetFrameStats(void);                   // Reset frame statistics (current counters become last frame statistics)
+
+// Uniform buffers management (OpenGL 3.3 only)
+// NOTE: Useful to share per-frame data (view, projection, time, lights) between many shaders
+// with a single upload, uniform block data must follow std140 layout
+RLAPI unsigned int rlLoadUniformBuffer(const void *data, int size);   // Load uniform buffer object (data can be NULL)
+RLAPI void rlUpdateUniformBuffer(unsigned int id, const void *data, int size, int offset);  // Update uniform buffer data
+RLAPI void rlBindUniformBuffer(unsigned int id, int bindingPoint);    // Bind uniform buffer to a binding point
+RLAPI void rlSetShaderUniformBlock(Shader shader, const char *blockName, int bindingPoint);  // Set shader uniform block binding point
+RLAPI void rlUnloadUniformBuffer(unsigned int id);                    // Unload uniform buffer object
+
 // Textures data management
 RLAPI unsigned int rlLoadTexture(void *data, int width, int height, int format, int mipmapCount); // Load texture in GPU
 RLAPI unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer);               // Load depth texture/renderbuffer (to be attached to fbo)
@@ -557,6 +742,10 @@ RLAPI void rlUnloadTexture(unsigned int id);                              // Unl
 RLAPI void rlGenerateMipmaps(Texture2D *texture);                         // Generate mipmap data for selected texture
 RLAPI void *rlReadTexturePixels(Texture2D texture);                       // Read texture pixel data
 RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
+RLAPI int rlReadScreenPixelsAsync(int width, int height);                 // Request screen pixel data read (no stall on OpenGL 3.3), returns readback id
+RLAPI int rlReadTexturePixelsAsync(Texture2D texture);                    // Request texture pixel data read (no stall on OpenGL 3.3), returns readback id
+RLAPI bool rlIsReadPixelsReady(int readback);                             // Check if readback pixel data can be retrieved without stall
+RLAPI void *rlGetReadPixels(int readback);                                // Get readback pixel data (readback released)
 
 // Framebuffer management (fbo)
 RLAPI unsigned int rlLoadFramebuffer(int width, int height);              // Load an empty framebuffer
@@ -570,6 +759,10 @@ RLAPI void rlUpdateMesh(Mesh mesh, int buffer, int count);                // Upd
 RLAPI void rlUpdateMeshAt(Mesh mesh, int buffer, int count, int index);   // Update vertex or index data on GPU, at index
 RLAPI void rlDrawMesh(Mesh mesh, Material material, Matrix transform);    // Draw a 3d mesh with material and transform
 RLAPI void rlDrawMeshInstanced(Mesh mesh, Material material, Matrix *transforms, int count);    // Draw a 3d mesh with material and transform
+RLAPI void rlDrawMeshInstancedBuffer(Mesh mesh, Material material, InstanceBuffer instances);    // Draw a 3d mesh with material and per-instance attributes buffer
+RLAPI InstanceBuffer rlLoadInstanceBuffer(int capacity, int *attribLocs, int *attribSizes, int attribsCount);   // Load instance buffer (per-instance attributes)
+RLAPI void rlUpdateInstanceBuffer(InstanceBuffer *buffer, const void *data, int count);  // Update instance buffer data (grows buffer if required)
+RLAPI void rlUnloadInstanceBuffer(InstanceBuffer buffer);                 // Unload instance buffer from CPU and GPU
 RLAPI void rlUnloadMesh(Mesh mesh);                                       // Unload mesh data from CPU and GPU
 
 // NOTE: There is a set of shader related functions that are available to end user,
@@ -793,53 +986,6 @@ RLAPI int GetPixelDataSize(int width, int height, int format);// Get pixel data
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 
-// Dynamic vertex buffers (position + texcoords + colors + indices arrays)
-typedef struct VertexBuffer {
-    int elementsCount;          // Number of elements in the buffer (QUADS)
-
-    int vCounter;               // Vertex position counter to process (and draw) from full buffer
-    int tcCounter;              // Vertex texcoord counter to process (and draw) from full buffer
-    int cCounter;               // Vertex color counter to process (and draw) from full buffer
-
-    float *vertices;            // Vertex position (XYZ - 3 components per vertex) (shader-location = 0)
-    float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
-    unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
-#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    unsigned int *indices;      // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned short *indices;    // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
-#endif
-    unsigned int vaoId;         // OpenGL Vertex Array Object id
-    unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (4 types of vertex data)
-} VertexBuffer;
-
-// Draw call type
-// NOTE: Only texture changes register a new draw, other state-change-related elements are not
-// used at this moment (vaoId, shaderId, matrices), raylib just forces a batch draw call if any
-// of those state-change happens (this is done in core module)
-typedef struct DrawCall {
-    int mode;                   // Drawing mode: LINES, TRIANGLES, QUADS
-    int vertexCount;            // Number of vertex of the draw
-    int vertexAlignment;        // Number of vertex required for index alignment (LINES, TRIANGLES)
-    //unsigned int vaoId;       // Vertex array id to be used on the draw -> Using RLGL.currentBatch->vertexBuffer.vaoId
-    //unsigned int shaderId;    // Shader id to be used on the draw -> Using RLGL.currentShader.id
-    unsigned int textureId;     // Texture id to be used on the draw -> Use to create new draw call if changes
-
-    //Matrix projection;        // Projection matrix for this draw -> Using RLGL.projection
-    //Matrix modelview;         // Modelview matrix for this draw -> Using RLGL.modelview
-} DrawCall;
-
-// RenderBatch type
-typedef struct RenderBatch {
-    int buffersCount;           // Number of vertex buffers (multi-buffering support)
-    int currentBuffer;          // Current buffer tracking in case of multi-buffering
-    VertexBuffer *vertexBuffer; // Dynamic buffer(s) for vertex data
-
-    DrawCall *draws;            // Draw calls array, depends on textureId
-    int drawsCounter;           // Draw calls counter
-    float currentDepth;         // Current depth value for next draw
-} RenderBatch;
-
 #if defined(SUPPORT_VR_SIMULATOR) && !defined(RLGL_STANDALONE)
 // VR Stereo rendering configuration for simulator
 typedef struct VrStereoConfig {
@@ -852,6 +998,58 @@ typedef struct VrStereoConfig {
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Shader uniform value shadow copy
+typedef struct ShaderUniformValue {
+    int location;               // Uniform location
+    int type;                   // Uniform data type (ShaderUniformDataType or UNIFORM_MATRIX)
+    int count;                  // Uniform elements count (arrays)
+    int size;                   // Uniform data size in bytes
+    bool dirty;                 // Uniform value changed but not uploaded yet (shader not in use)
+    unsigned char *data;        // Uniform data (last value set)
+} ShaderUniformValue;
+
+// Shader uniforms shadow store
+typedef struct ShaderUniformStore {
+    unsigned int shaderId;      // Shader program id
+    int count;                  // Number of uniforms stored
+    int capacity;               // Number of uniforms allocated
+    bool dirty;                 // Some uniform value pending to be uploaded
+    ShaderUniformValue *values; // Uniform values
+} ShaderUniformStore;
+
+// Draw call sorting key, used to reorder sorted batches
+typedef struct DrawCallKey {
+    int layer;                  // Draw call layer (first sorting key)
+    unsigned int textureId;     // Draw call texture id (second sorting key)
+    int mode;                   // Draw call mode (third sorting key)
+    int index;                  // Draw call submission index (keeps submission order for equal keys)
+    int offset;                 // Draw call first vertex in the vertex buffer
+    int vertexCount;            // Draw call number of vertex
+    int target;                 // Draw call first vertex once reordered
+    int indexOffset;            // Draw call first index in the draw indices buffer (indexed draws)
+    int indexCount;             // Draw call number of indices (indexed draws)
+    int indexTarget;            // Draw call first index once reordered
+} DrawCallKey;
+
+// Compact vertex type (RL_VERTEX_FORMAT_COMPACT_2D batches, interleaved on GPU)
+typedef struct CompactVertex {
+    float position[2];          // Vertex position (XY), z is discarded
+    unsigned short texcoord[2]; // Vertex texture coordinates (normalized, [0..1] range)
+    unsigned char color[4];     // Vertex color (RGBA)
+} CompactVertex;
+
+// Pixels readback buffer
+// NOTE: On OpenGL 3.3 pixels are copied to a pixel pack buffer (PBO) and retrieved once fence is signaled,
+// on other OpenGL versions pixels are read synchronously on request
+typedef struct ReadbackBuffer {
+    unsigned int pboId;         // OpenGL pixel pack buffer id (reused between readbacks)
+    int pboSize;                // OpenGL pixel pack buffer allocated size
+    int dataSize;               // Pixels data size requested
+    void *fence;                // OpenGL fence sync object (GLsync), signaled when pixels copy is completed
+    void *data;                 // Pixels data (synchronous readback)
+    bool active;                // Readback requested and not retrieved yet
+} ReadbackBuffer;
+
 typedef struct rlglData {
     RenderBatch *currentBatch;              // Current render batch
     RenderBatch defaultBatch;               // Default internal render batch
@@ -863,6 +1061,8 @@ typedef struct rlglData {
         Matrix projection;                  // Default projection matrix
         Matrix transform;                   // Transform matrix to be used with rlTranslate, rlRotate, rlScale
         bool transformRequired;             // Require transform matrix application to current draw-call vertex (if required)
+        bool drawTransform;                 // Apply transform matrix per draw-call on shader instead of per vertex on CPU
+        bool drawTransformCheck;            // Check current draw-call transform on next rlBegin() (per-draw transform disabled)
         Matrix stack[MAX_MATRIX_STACK_SIZE];// Matrix stack for push/pop
         int stackCounter;                   // Matrix stack counter
 
@@ -883,6 +1083,25 @@ typedef struct rlglData {
         int framebufferWidth;               // Default framebuffer width
         int framebufferHeight;              // Default framebuffer height
 
+        int currentLayer;                   // Draw layer assigned to new draw calls (sorting key)
+        int blockFirstVertex;               // First vertex of current rlBegin()/rlEnd() block (rlIndex() base)
+        bool blockIndexed;                  // Current rlBegin()/rlEnd() block provides its own indices
+        InstanceBuffer instanceBuffer;      // Instance buffer reused by rlDrawMeshInstanced() (transforms only)
+        float16 *instanceTransforms;        // Instance transforms converted for upload (instanceTransformsCapacity)
+        int instanceTransformsCapacity;     // Instance transforms converted for upload array capacity
+        VertexBuffer sortBuffer;            // Auxiliar vertex data used to reorder sorted batches (CPU only)
+        DrawCallKey *sortKeys;              // Auxiliar draw calls keys used to sort batches (sortDrawsCapacity)
+        DrawCall *sortDraws;                // Auxiliar merged draw calls used to sort batches (sortDrawsCapacity)
+        int sortDrawsCapacity;              // Auxiliar draw calls arrays capacity used to sort batches
+        ShaderUniformStore *uniformStores;  // Shader uniforms shadow stores (one per shader program)
+        int uniformStoresCount;             // Number of shader uniforms shadow stores
+
+        int flushReason;                    // Reason for next render batch flush (FlushReason)
+        FrameStats frameStats;              // Current frame rendering statistics
+        FrameStats lastFrameStats;          // Last frame rendering statistics
+
+        ReadbackBuffer readbacks[MAX_READBACK_BUFFERS];     // Pixels readbacks (readback id is index + 1)
+
     } State;            // Renderer state
     struct {
         bool vao;                           // VAO support (OpenGL ES2 could not support VAO extension)
@@ -902,6 +1121,20 @@ typedef struct rlglData {
         int maxDepthBits;                   // Maximum bits for depth component
 
     } ExtSupported;     // Extensions supported flags
+    struct {
+        unsigned int program;               // Shader program in use
+        unsigned int vertexArray;           // Vertex array object bound
+        int activeTextureUnit;              // Texture unit active (-1 if unknown)
+        unsigned int textures[MAX_STATE_TEXTURE_UNITS];     // GL_TEXTURE_2D bound per texture unit
+        unsigned int cubemaps[MAX_STATE_TEXTURE_UNITS];     // GL_TEXTURE_CUBE_MAP bound per texture unit
+        int blend;                          // GL_BLEND enabled (-1 if unknown)
+        int depthTest;                      // GL_DEPTH_TEST enabled (-1 if unknown)
+        int depthMask;                      // Depth buffer writing enabled (-1 if unknown)
+        int cullFace;                       // GL_CULL_FACE enabled (-1 if unknown)
+        int scissorTest;                    // GL_SCISSOR_TEST enabled (-1 if unknown)
+        int scissor[4];                     // Scissor rectangle [x, y, width, height]
+        StateCacheStats stats;              // State changes issued/skipped counters
+    } Cache;            // GL state cache (shadow copy of GL state)
 #if defined(SUPPORT_VR_SIMULATOR)
     struct {
         VrStereoConfig config;              // VR stereo configuration for simulator
@@ -931,7 +1164,22 @@ static PFNGLDELETEVERTEXARRAYSOESPROC glDeleteVertexArrays;  // Entry point poin
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
+static void StateBindTexture(unsigned int target, unsigned int id);    // Bind texture to active unit (skipped if already bound)
+static void StateSetCapability(unsigned int cap, bool enabled);        // Enable/disable capability (skipped if already set)
+static void StateDepthMask(bool enabled);                               // Enable/disable depth buffer writing (skipped if already set)
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void StateUseProgram(unsigned int id);           // Use shader program (skipped if already in use)
+static void StateBindVertexArray(unsigned int id);      // Bind vertex array object (skipped if already bound)
+static void StateActiveTexture(unsigned int unit);      // Set active texture unit (skipped if already active)
+static void StateForgetTexture(unsigned int id);        // Forget texture bindings on texture unload
+
+static void SetShaderUniform(unsigned int shaderId, int location, const void *value, int type, int count);  // Set shader uniform value (cached)
+static void UploadShaderUniform(const ShaderUniformValue *uniform);    // Upload shader uniform value to GPU
+static void FlushShaderUniforms(unsigned int shaderId);  // Upload shader uniform values pending (shader must be in use)
+static void UnloadShaderUniforms(unsigned int shaderId);    // Unload shader uniforms shadow store
+static int BeginReadback(int size);                     // Begin pixels readback (pixel pack buffer bound on OpenGL 3.3), returns readback id
+static void EndReadback(ReadbackBuffer *readback);      // End pixels readback (fence inserted on OpenGL 3.3)
 static unsigned int CompileShader(const char *shaderStr, int type);     // Compile custom shader and return shader id
 static unsigned int LoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId);  // Load custom shader program
 
@@ -939,12 +1187,13 @@ static Shader LoadShaderDefault(void);                  // Load default shader (
 static void SetShaderDefaultLocations(Shader *shader);  // Bind default shader locations (attributes and uniforms)
 static void UnloadShaderDefault(void);                  // Unload default shader
 
-static RenderBatch LoadRenderBatch(int numBuffers, int bufferElements); // Load a render batch system
-static void UnloadRenderBatch(RenderBatch batch);       // Unload render batch system
-static void DrawRenderBatch(RenderBatch *batch);        // Draw render batch data (Update->Draw->Reset)
-static void SetRenderBatchActive(RenderBatch *batch);   // Set the active render batch for rlgl
-static void SetRenderBatchDefault(void);                // Set default render batch for rlgl
-//static bool CheckRenderBatchLimit(RenderBatch batch, int vCount);   // Check render batch vertex buffer limits
+static Matrix GetDrawTransform(void);                   // Get transform matrix to be stored in new draw calls
+static void GenDrawIndices(VertexBuffer *buffer, DrawCall *draw, int firstVertex, int vertexCount);  // Generate draw indices for non-indexed vertex data on indexed draws
+static void SetVertexBufferAttribs(const VertexBuffer *buffer, int vertexFormat);   // Set render batch vertex buffer attributes (depends on vertex format)
+static void SortRenderBatch(RenderBatch *batch);        // Sort and merge render batch draw calls (sorted batches)
+static bool GrowRenderBatch(RenderBatch *batch, int elementsCount, int drawsCapacity);  // Grow render batch current buffer elements and draw calls capacity (retained batches)
+static void FlushRenderBatch(int reason);               // Draw current render batch forced by batch limits
+static int CompareDrawCallKeys(const void *a, const void *b);   // Compare draw calls sorting keys (used by qsort())
 
 static void GenDrawCube(void);              // Generate and draw cube
 static void GenDrawQuad(void);              // Generate and draw quad
@@ -1137,6 +1386,7 @@ void rlEnd() { glEnd(); }
 void rlVertex2i(int x, int y) { glVertex2i(x, y); }
 void rlVertex2f(float x, float y) { glVertex2f(x, y); }
 void rlVertex3f(float x, float y, float z) { glVertex3f(x, y, z); }
+void rlIndex(int index) { }     // NOTE: Indexed vertex data not supported on OpenGL 1.1 immediate mode
 void rlTexCoord2f(float x, float y) { glTexCoord2f(x, y); }
 void rlNormal3f(float x, float y, float z) { glNormal3f(x, y, z); }
 void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a) { glColor4ub(r, g, b, a); }
@@ -1150,8 +1400,23 @@ void rlBegin(int mode)
 {
     // Draw mode can be RL_LINES, RL_TRIANGLES and RL_QUADS
     // NOTE: In all three cases, vertex are accumulated over default internal vertex buffer
-    if (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].mode != mode)
+    bool modeChanged = (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].mode != mode);
+    bool transformChanged = false;
+
+    // On per-draw transform mode, transform changes also register a new draw (texture is kept)
+    // NOTE: Transform is only compared on per-draw transform mode, and once after disabling it (draw transform reset)
+    if (RLGL.State.drawTransform || RLGL.State.drawTransformCheck)
     {
+        Matrix transform = GetDrawTransform();
+
+        transformChanged = (memcmp(&RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].transform, &transform, sizeof(Matrix)) != 0);
+        RLGL.State.drawTransformCheck = false;
+    }
+
+    if (modeChanged || transformChanged)
+    {
+        unsigned int textureId = modeChanged? RLGL.State.defaultTextureId : RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].textureId;
+
         if (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount > 0)
         {
             // Make sure current RLGL.currentBatch->draws[i].vertexCount is aligned a multiple of 4,
@@ -1159,12 +1424,17 @@ void rlBegin(int mode)
             // It implies adding some extra alignment vertex at the end of the draw,
             // those vertex are not processed but they are considered as an additional offset
             // for the next set of vertex to be drawn
-            if (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].mode == RL_LINES) RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount < 4)? RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount : RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount%4);
+            // NOTE: Indexed draws vertex are only referenced by indices, they just require the minimum alignment
+            if (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].indexCount > 0) RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment = (4 - RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount%4)%4;
+            else if (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].mode == RL_LINES) RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount < 4)? RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount : RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount%4);
             else if (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].mode == RL_TRIANGLES) RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount < 4)? 1 : (4 - (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount%4)));
 
             else RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment = 0;
 
-            if (rlCheckBufferLimit(RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment)) DrawRenderBatch(RLGL.currentBatch);
+            if (rlCheckBufferLimit(RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment))
+            {
+                FlushRenderBatch(RL_FLUSH_BUFFER_FULL);
+            }
             else
             {
                 RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment;
@@ -1175,12 +1445,25 @@ void rlBegin(int mode)
             }
         }
 
-        if (RLGL.currentBatch->drawsCounter >= DEFAULT_BATCH_DRAWCALLS) DrawRenderBatch(RLGL.currentBatch);
+        if (RLGL.currentBatch->drawsCounter >= RLGL.currentBatch->drawsCapacity)
+        {
+            // Sorted batches try to merge draw calls before forcing a draw, retained batches grow instead
+            if (RLGL.currentBatch->sortMode != RL_BATCH_SORT_NONE) SortRenderBatch(RLGL.currentBatch);
+            if ((RLGL.currentBatch->drawsCounter >= RLGL.currentBatch->drawsCapacity) &&
+                !(RLGL.currentBatch->retained && GrowRenderBatch(RLGL.currentBatch, 0, RLGL.currentBatch->drawsCounter + 1))) FlushRenderBatch(RL_FLUSH_DRAWCALLS_LIMIT);
+        }
 
         RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].mode = mode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount = 0;
-        RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].textureId = RLGL.State.defaultTextureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].indexCount = 0;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].textureId = textureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].layer = RLGL.State.currentLayer;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].transform = GetDrawTransform();
     }
+
+    // Indices provided with rlIndex() are relative to the first vertex of the block
+    RLGL.State.blockFirstVertex = RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter;
+    RLGL.State.blockIndexed = false;
 }
 
 // Finish vertex providing
@@ -1219,20 +1502,29 @@ void rlEnd(void)
 
     // TODO: Make sure normals count match vertex count... if normals support is added in a future... :P
 
+    // Non-indexed vertex data added to an indexed draw call requires its own indices
+    DrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1];
+    int blockVertexCount = RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter - RLGL.State.blockFirstVertex;
+
+    if (!RLGL.State.blockIndexed && (draw->indexCount > 0) && (blockVertexCount > 0)) GenDrawIndices(&RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer], draw, RLGL.State.blockFirstVertex, blockVertexCount);
+    RLGL.State.blockIndexed = false;
+
     // NOTE: Depth increment is dependant on rlOrtho(): z-near and z-far values,
     // as well as depth buffer bit-depth (16bit or 24bit or 32bit)
     // Correct increment formula would be: depthInc = (zfar - znear)/pow(2, bits)
     RLGL.currentBatch->currentDepth += (1.0f/20000.0f);
 
     // Verify internal buffers limits
-    // NOTE: This check is combined with usage of rlCheckBufferLimit()
-    if ((RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter) >= (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementsCount*4 - 4))
+    // NOTE: This check is combined with usage of rlCheckRenderBatchLimit()
+    // NOTE: Retained batches can not be drawn to free space, they grow instead
+    if (((RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter) >= (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementsCount*4 - 4)) &&
+        !(RLGL.currentBatch->retained && GrowRenderBatch(RLGL.currentBatch, RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter/4 + 2, 0)))
     {
         // WARNING: If we are between rlPushMatrix() and rlPopMatrix() and we need to force a DrawRenderBatch(),
         // we need to call rlPopMatrix() before to recover *RLGL.State.currentMatrix (RLGL.State.modelview) for the next forced draw call!
         // If we have multiple matrix pushed, it will require "RLGL.State.stackCounter" pops before launching the draw
         for (int i = RLGL.State.stackCounter; i >= 0; i--) rlPopMatrix();
-        DrawRenderBatch(RLGL.currentBatch);
+        FlushRenderBatch(RL_FLUSH_BUFFER_FULL);
     }
 }
 
@@ -1243,9 +1535,13 @@ void rlVertex3f(float x, float y, float z)
     Vector3 vec = { x, y, z };
 
     // Transform provided vector if required
-    if (RLGL.State.transformRequired) vec = Vector3Transform(vec, RLGL.State.transform);
+    // NOTE: On per-draw transform mode, transform is stored in the draw call and applied on shader
+    if (RLGL.State.transformRequired && !RLGL.State.drawTransform) vec = Vector3Transform(vec, RLGL.State.transform);
+
+    // Verify that current vertex buffer elements limit has not been reached (retained batches grow instead)
+    if ((RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter >= (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementsCount*4)) &&
+        RLGL.currentBatch->retained) GrowRenderBatch(RLGL.currentBatch, RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter/4 + 1, 0);
 
-    // Verify that current vertex buffer elements limit has not been reached
     if (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter < (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementsCount*4))
     {
         RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter] = vec.x;
@@ -1258,6 +1554,36 @@ void rlVertex3f(float x, float y, float z)
     else TRACELOG(LOG_ERROR, "RLGL: Batch elements overflow");
 }
 
+// Define one vertex index
+// NOTE: Index is relative to the first vertex provided after rlBegin(), indexed vertex data is always
+// assembled as triangles (RL_TRIANGLES, RL_QUADS) or lines (RL_LINES), vertex are only drawn through indices.
+// Using RL_QUADS mode, indexed shapes can share the draw call with quads (rectangles, text)
+void rlIndex(int index)
+{
+    VertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+    DrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1];
+
+    // Draw call previous vertex data (not indexed) requires its own indices once draw gets indexed
+    if (draw->indexCount == 0)
+    {
+        int drawFirstVertex = buffer->vCounter - draw->vertexCount;
+        if (RLGL.State.blockFirstVertex > drawFirstVertex) GenDrawIndices(buffer, draw, drawFirstVertex, RLGL.State.blockFirstVertex - drawFirstVertex);
+    }
+
+    // Verify that current draw indices limit has not been reached (retained batches grow instead)
+    if ((buffer->iCounter >= (buffer->elementsCount*BATCH_ELEMENT_INDICES)) && RLGL.currentBatch->retained) GrowRenderBatch(RLGL.currentBatch, buffer->iCounter/BATCH_ELEMENT_INDICES + 1, 0);
+
+    if (buffer->iCounter < (buffer->elementsCount*BATCH_ELEMENT_INDICES))
+    {
+        buffer->drawIndices[buffer->iCounter] = RLGL.State.blockFirstVertex + index;
+        buffer->iCounter++;
+
+        draw->indexCount++;
+        RLGL.State.blockIndexed = true;
+    }
+    else TRACELOG(LOG_ERROR, "RLGL: Batch indices overflow");
+}
+
 // Define one vertex (position)
 void rlVertex2f(float x, float y)
 {
@@ -1274,9 +1600,18 @@ void rlVertex2i(int x, int y)
 // NOTE: Texture coordinates are limited to QUADS only
 void rlTexCoord2f(float x, float y)
 {
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].tcCounter] = x;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].tcCounter + 1] = y;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].tcCounter++;
+    // Verify that current texcoords limit has not been reached (retained batches grow instead)
+    // NOTE: Texcoords are usually provided before the vertex, so they could reach the limit first
+    if ((RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].tcCounter >= (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementsCount*4)) &&
+        RLGL.currentBatch->retained) GrowRenderBatch(RLGL.currentBatch, RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].tcCounter/4 + 1, 0);
+
+    if (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].tcCounter < (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementsCount*4))
+    {
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].tcCounter] = x;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].tcCounter + 1] = y;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].tcCounter++;
+    }
+    else TRACELOG(LOG_ERROR, "RLGL: Batch texcoords overflow");
 }
 
 // Define one vertex (normal)
@@ -1289,11 +1624,20 @@ void rlNormal3f(float x, float y, float z)
 // Define one vertex (color)
 void rlColor4ub(unsigned char x, unsigned char y, unsigned char z, unsigned char w)
 {
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter] = x;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter + 1] = y;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter + 2] = z;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter + 3] = w;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter++;
+    // Verify that current colors limit has not been reached (retained batches grow instead)
+    // NOTE: Colors are usually provided before the vertex, so they could reach the limit first
+    if ((RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter >= (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementsCount*4)) &&
+        RLGL.currentBatch->retained) GrowRenderBatch(RLGL.currentBatch, RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter/4 + 1, 0);
+
+    if (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter < (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementsCount*4))
+    {
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter] = x;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter + 1] = y;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter + 2] = z;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter + 3] = w;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter++;
+    }
+    else TRACELOG(LOG_ERROR, "RLGL: Batch colors overflow");
 }
 
 // Define one vertex (color)
@@ -1319,7 +1663,7 @@ void rlEnableTexture(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_11)
     glEnable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, id);
+    StateBindTexture(GL_TEXTURE_2D, id);
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
@@ -1332,12 +1676,17 @@ void rlEnableTexture(unsigned int id)
             // It implies adding some extra alignment vertex at the end of the draw,
             // those vertex are not processed but they are considered as an additional offset
             // for the next set of vertex to be drawn
-            if (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].mode == RL_LINES) RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount < 4)? RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount : RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount%4);
+            // NOTE: Indexed draws vertex are only referenced by indices, they just require the minimum alignment
+            if (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].indexCount > 0) RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment = (4 - RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount%4)%4;
+            else if (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].mode == RL_LINES) RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount < 4)? RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount : RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount%4);
             else if (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].mode == RL_TRIANGLES) RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount < 4)? 1 : (4 - (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount%4)));
 
             else RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment = 0;
 
-            if (rlCheckBufferLimit(RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment)) DrawRenderBatch(RLGL.currentBatch);
+            if (rlCheckBufferLimit(RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment))
+            {
+                FlushRenderBatch(RL_FLUSH_BUFFER_FULL);
+            }
             else
             {
                 RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment;
@@ -1348,10 +1697,19 @@ void rlEnableTexture(unsigned int id)
             }
         }
 
-        if (RLGL.currentBatch->drawsCounter >= DEFAULT_BATCH_DRAWCALLS) DrawRenderBatch(RLGL.currentBatch);
+        if (RLGL.currentBatch->drawsCounter >= RLGL.currentBatch->drawsCapacity)
+        {
+            // Sorted batches try to merge draw calls before forcing a draw, retained batches grow instead
+            if (RLGL.currentBatch->sortMode != RL_BATCH_SORT_NONE) SortRenderBatch(RLGL.currentBatch);
+            if ((RLGL.currentBatch->drawsCounter >= RLGL.currentBatch->drawsCapacity) &&
+                !(RLGL.currentBatch->retained && GrowRenderBatch(RLGL.currentBatch, 0, RLGL.currentBatch->drawsCounter + 1))) FlushRenderBatch(RL_FLUSH_DRAWCALLS_LIMIT);
+        }
 
         RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].textureId = id;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount = 0;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].indexCount = 0;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].layer = RLGL.State.currentLayer;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].transform = GetDrawTransform();
     }
 #endif
 }
@@ -1361,18 +1719,21 @@ void rlDisableTexture(void)
 {
 #if defined(GRAPHICS_API_OPENGL_11)
     glDisable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    StateBindTexture(GL_TEXTURE_2D, 0);
 #else
     // NOTE: If quads batch limit is reached,
     // we force a draw call and next batch starts
-    if (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter >= (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementsCount*4)) DrawRenderBatch(RLGL.currentBatch);
+    if (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter >= (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementsCount*4))
+    {
+        FlushRenderBatch(RL_FLUSH_BUFFER_FULL);
+    }
 #endif
 }
 
 // Set texture parameters (wrap mode/filter mode)
 void rlTextureParameters(unsigned int id, int param, int value)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    StateBindTexture(GL_TEXTURE_2D, id);
 
     switch (param)
     {
@@ -1406,14 +1767,14 @@ void rlTextureParameters(unsigned int id, int param, int value)
         default: break;
     }
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    StateBindTexture(GL_TEXTURE_2D, 0);
 }
 
 // Enable shader program usage
 void rlEnableShader(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(id);
+    StateUseProgram(id);
 #endif
 }
 
@@ -1421,7 +1782,7 @@ void rlEnableShader(unsigned int id)
 void rlDisableShader(void)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(0);
+    StateUseProgram(0);
 #endif
 }
 
@@ -1442,31 +1803,47 @@ void rlDisableFramebuffer(void)
 }
 
 // Enable depth test
-void rlEnableDepthTest(void) { glEnable(GL_DEPTH_TEST); }
+void rlEnableDepthTest(void) { StateSetCapability(GL_DEPTH_TEST, true); }
 
 // Disable depth test
-void rlDisableDepthTest(void) { glDisable(GL_DEPTH_TEST); }
+void rlDisableDepthTest(void) { StateSetCapability(GL_DEPTH_TEST, false); }
 
 // Enable depth write
-void rlEnableDepthMask(void) { glDepthMask(GL_TRUE); }
+void rlEnableDepthMask(void) { StateDepthMask(true); }
 
 // Disable depth write
-void rlDisableDepthMask(void) { glDepthMask(GL_FALSE); }
+void rlDisableDepthMask(void) { StateDepthMask(false); }
 
 // Enable backface culling
-void rlEnableBackfaceCulling(void) { glEnable(GL_CULL_FACE); }
+void rlEnableBackfaceCulling(void) { StateSetCapability(GL_CULL_FACE, true); }
 
 // Disable backface culling
-void rlDisableBackfaceCulling(void) { glDisable(GL_CULL_FACE); }
+void rlDisableBackfaceCulling(void) { StateSetCapability(GL_CULL_FACE, false); }
 
 // Enable scissor test
-RLAPI void rlEnableScissorTest(void) { glEnable(GL_SCISSOR_TEST); }
+RLAPI void rlEnableScissorTest(void) { StateSetCapability(GL_SCISSOR_TEST, true); }
 
 // Disable scissor test
-RLAPI void rlDisableScissorTest(void) { glDisable(GL_SCISSOR_TEST); }
+RLAPI void rlDisableScissorTest(void) { StateSetCapability(GL_SCISSOR_TEST, false); }
 
 // Scissor test
-RLAPI void rlScissor(int x, int y, int width, int height) { glScissor(x, y, width, height); }
+RLAPI void rlScissor(int x, int y, int width, int height)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((RLGL.Cache.scissor[0] == x) && (RLGL.Cache.scissor[1] == y) && (RLGL.Cache.scissor[2] == width) && (RLGL.Cache.scissor[3] == height))
+    {
+        RLGL.Cache.stats.stateSkipped++;
+        return;
+    }
+
+    RLGL.Cache.scissor[0] = x;
+    RLGL.Cache.scissor[1] = y;
+    RLGL.Cache.scissor[2] = width;
+    RLGL.Cache.scissor[3] = height;
+    RLGL.Cache.stats.stateCalls++;
+#endif
+    glScissor(x, y, width, height);
+}
 
 // Enable wire mode
 void rlEnableWireMode(void)
@@ -1529,7 +1906,11 @@ void rlUnloadFramebuffer(unsigned int id)
 
     unsigned int depthIdU = (unsigned int)depthId;
     if (depthType == GL_RENDERBUFFER) glDeleteRenderbuffers(1, &depthIdU);
-    else if (depthType == GL_RENDERBUFFER) glDeleteTextures(1, &depthIdU);
+    else if (depthType == GL_RENDERBUFFER)
+    {
+        StateForgetTexture(depthIdU);
+        glDeleteTextures(1, &depthIdU);
+    }
 
     // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
     // the texture image is automatically detached from the currently bound framebuffer.
@@ -1566,6 +1947,7 @@ void rlUpdateBuffer(int bufferId, void *data, int dataSize)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ARRAY_BUFFER, bufferId);
     glBufferSubData(GL_ARRAY_BUFFER, 0, dataSize, data);
+    RLGL.State.frameStats.bytesUploaded += dataSize;
 #endif
 }
 
@@ -1576,6 +1958,9 @@ void rlUpdateBuffer(int bufferId, void *data, int dataSize)
 // Initialize rlgl: OpenGL extensions, default buffers/shaders/textures, OpenGL states
 void rlglInit(int width, int height)
 {
+    // Reset GL state cache, OpenGL context state is unknown
+    rlInvalidateStateCache();
+
     // Check OpenGL information and capabilities
     //------------------------------------------------------------------------------
     // Print current OpenGL and GLSL version
@@ -1769,7 +2154,7 @@ void rlglInit(int width, int height)
     RLGL.State.currentShader = RLGL.State.defaultShader;
 
     // Init default vertex arrays buffers
-    RLGL.defaultBatch = LoadRenderBatch(DEFAULT_BATCH_BUFFERS, DEFAULT_BATCH_BUFFER_ELEMENTS);
+    RLGL.defaultBatch = rlLoadRenderBatchEx(DEFAULT_BATCH_BUFFERS, DEFAULT_BATCH_BUFFER_ELEMENTS, DEFAULT_BATCH_DRAWCALLS, DEFAULT_BATCH_VERTEX_FORMAT);
     RLGL.currentBatch = &RLGL.defaultBatch;
 
     // Init stack matrices (emulating OpenGL 1.1)
@@ -1787,17 +2172,17 @@ void rlglInit(int width, int height)
     //----------------------------------------------------------
     // Init state: Depth test
     glDepthFunc(GL_LEQUAL);                                 // Type of depth testing to apply
-    glDisable(GL_DEPTH_TEST);                               // Disable depth testing for 2D (only used for 3D)
+    StateSetCapability(GL_DEPTH_TEST, false);               // Disable depth testing for 2D (only used for 3D)
 
     // Init state: Blending mode
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);      // Color blending function (how colors are mixed)
-    glEnable(GL_BLEND);                                     // Enable color blending (required to work with transparencies)
+    StateSetCapability(GL_BLEND, true);                     // Enable color blending (required to work with transparencies)
 
     // Init state: Culling
     // NOTE: All shapes/models triangles are drawn CCW
     glCullFace(GL_BACK);                                    // Cull the back face (default)
     glFrontFace(GL_CCW);                                    // Front face are defined counter clockwise (default)
-    glEnable(GL_CULL_FACE);                                 // Enable backface culling
+    StateSetCapability(GL_CULL_FACE, true);                 // Enable backface culling
 
     // Init state: Cubemap seamless
 #if defined(GRAPHICS_API_OPENGL_33)
@@ -1832,9 +2217,47 @@ void rlglInit(int width, int height)
 void rlglClose(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    UnloadRenderBatch(RLGL.defaultBatch);
+    rlUnloadRenderBatch(RLGL.defaultBatch);
+
+    // Unload instance buffer used by rlDrawMeshInstanced()
+    if (RLGL.State.instanceBuffer.vboId > 0) rlUnloadInstanceBuffer(RLGL.State.instanceBuffer);
+    RL_FREE(RLGL.State.instanceTransforms);
+    RLGL.State.instanceBuffer = (InstanceBuffer){ 0 };
+    RLGL.State.instanceTransforms = NULL;
+    RLGL.State.instanceTransformsCapacity = 0;
+
+    // Unload remaining shader uniforms shadow stores
+    while (RLGL.State.uniformStoresCount > 0) UnloadShaderUniforms(RLGL.State.uniformStores[0].shaderId);
+    RL_FREE(RLGL.State.uniformStores);
+    RLGL.State.uniformStores = NULL;
+
+    // Unload pixels readbacks buffers, pending readbacks are discarded
+    for (int i = 0; i < MAX_READBACK_BUFFERS; i++)
+    {
+        ReadbackBuffer *readback = &RLGL.State.readbacks[i];
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+        if (readback->fence != NULL) glDeleteSync((GLsync)readback->fence);
+        if (readback->pboId > 0) glDeleteBuffers(1, &readback->pboId);
+#endif
+        RL_FREE(readback->data);
+        *readback = (ReadbackBuffer){ 0 };
+    }
+
+    // Free auxiliar vertex data and draw calls used for batches sorting
+    RL_FREE(RLGL.State.sortBuffer.vertices);
+    RL_FREE(RLGL.State.sortBuffer.texcoords);
+    RL_FREE(RLGL.State.sortBuffer.colors);
+    RL_FREE(RLGL.State.sortBuffer.drawIndices);
+    RL_FREE(RLGL.State.sortKeys);
+    RL_FREE(RLGL.State.sortDraws);
+    RLGL.State.sortBuffer = (VertexBuffer){ 0 };
+    RLGL.State.sortKeys = NULL;
+    RLGL.State.sortDraws = NULL;
+    RLGL.State.sortDrawsCapacity = 0;
 
     UnloadShaderDefault();          // Unload default shader
+    StateForgetTexture(RLGL.State.defaultTextureId);
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
 
     TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Unloaded default texture data from VRAM (GPU)", RLGL.State.defaultTextureId);
@@ -1845,7 +2268,8 @@ void rlglClose(void)
 void rlglDraw(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    DrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
+    // NOTE: Retained batches are only drawn on user request with rlDrawRenderBatch()
+    if (!RLGL.currentBatch->retained) rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
 #endif
 }
 
@@ -1907,11 +2331,53 @@ int rlGetVersion(void)
 }
 
 // Check internal buffer overflow for a given number of vertex
+// NOTE: Retained batches can not be drawn to free space, they grow to fit required vertex instead
 bool rlCheckBufferLimit(int vCount)
+{
+    return rlCheckBufferLimitEx(vCount, 0);
+}
+
+// Check internal buffer overflow for a given number of vertex and draw indices
+// NOTE: Current draw call previous vertex data (not indexed) also requires indices once draw gets indexed (see rlIndex())
+bool rlCheckBufferLimitEx(int vCount, int iCount)
+{
+    bool overflow = false;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    VertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+    DrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1];
+
+    if ((iCount > 0) && (draw->indexCount == 0)) iCount += (draw->mode == RL_QUADS)? draw->vertexCount/4*6 : draw->vertexCount;
+
+    if (((buffer->vCounter + vCount) >= (buffer->elementsCount*4)) ||
+        ((buffer->iCounter + iCount) > (buffer->elementsCount*BATCH_ELEMENT_INDICES)))
+    {
+        int elementsCount = (buffer->vCounter + vCount)/4 + 1;
+        if (elementsCount < ((buffer->iCounter + iCount)/BATCH_ELEMENT_INDICES + 1)) elementsCount = (buffer->iCounter + iCount)/BATCH_ELEMENT_INDICES + 1;
+
+        overflow = !(RLGL.currentBatch->retained && GrowRenderBatch(RLGL.currentBatch, elementsCount, 0));
+    }
+#endif
+    return overflow;
+}
+
+// Check internal buffer overflow for a given number of vertex and force a render batch draw if required
+// NOTE: Forced draw is registered as RL_FLUSH_BUFFER_FULL, retained batches grow instead (see rlCheckBufferLimit())
+bool rlCheckRenderBatchLimit(int vCount)
+{
+    return rlCheckRenderBatchLimitEx(vCount, 0);
+}
+
+// Check internal buffer overflow for a given number of vertex and draw indices and force a render batch draw if required
+// NOTE: Required by indexed vertex data (see rlIndex()), vertex limit alone does not ensure draw indices fit
+bool rlCheckRenderBatchLimitEx(int vCount, int iCount)
 {
     bool overflow = false;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if ((RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter + vCount) >= (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementsCount*4)) overflow = true;
+    if (rlCheckBufferLimitEx(vCount, iCount))
+    {
+        overflow = true;
+        FlushRenderBatch(RL_FLUSH_BUFFER_FULL);
+    }
 #endif
     return overflow;
 }
@@ -1934,291 +2400,1121 @@ void rlSetBlendMode(int glSrcFactor, int glDstFactor, int glEquation)
 #endif
 }
 
-// Load OpenGL extensions
-// NOTE: External loader function could be passed as a pointer
-void rlLoadExtensions(void *loader)
+// Load render batch
+// NOTE: Every batch can define its own elements (quads) per buffer and draw calls capacity
+RenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements, int drawsCapacity)
 {
-#if defined(GRAPHICS_API_OPENGL_33)
-    // NOTE: glad is generated and contains only required OpenGL 3.3 Core extensions (and lower versions)
-    #if !defined(__APPLE__)
-        if (!gladLoadGLLoader((GLADloadproc)loader)) TRACELOG(LOG_WARNING, "GLAD: Cannot load OpenGL extensions");
-        else TRACELOG(LOG_INFO, "GLAD: OpenGL extensions loaded successfully");
-
-        #if defined(GRAPHICS_API_OPENGL_21)
-        if (GLAD_GL_VERSION_2_1) TRACELOG(LOG_INFO, "GL: OpenGL 2.1 profile supported");
-        #elif defined(GRAPHICS_API_OPENGL_33)
-        if (GLAD_GL_VERSION_3_3) TRACELOG(LOG_INFO, "GL: OpenGL 3.3 Core profile supported");
-        else TRACELOG(LOG_ERROR, "GL: OpenGL 3.3 Core profile not supported");
-        #endif
-    #endif
-
-    // With GLAD, we can check if an extension is supported using the GLAD_GL_xxx booleans
-    //if (GLAD_GL_ARB_vertex_array_object) // Use GL_ARB_vertex_array_object
-#endif
+    return rlLoadRenderBatchEx(numBuffers, bufferElements, drawsCapacity, RL_VERTEX_FORMAT_DEFAULT);
 }
 
-// Convert image data to OpenGL texture (returns OpenGL valid Id)
-unsigned int rlLoadTexture(void *data, int width, int height, int format, int mipmapCount)
+// Load render batch with vertex format
+// NOTE: Vertex data is always accumulated on CPU with full precision, vertex format defines how it is uploaded
+// and stored on GPU. RL_VERTEX_FORMAT_COMPACT_2D discards vertex z (depth) and clamps texcoords to [0..1]
+// range, only suitable for 2D drawing without texture coordinates wrapping
+RenderBatch rlLoadRenderBatchEx(int numBuffers, int bufferElements, int drawsCapacity, int vertexFormat)
 {
-    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
-
-    unsigned int id = 0;
+    RenderBatch batch = { 0 };
 
-    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
-#if defined(GRAPHICS_API_OPENGL_11)
-    if (format >= COMPRESSED_DXT1_RGB)
-    {
-        TRACELOG(LOG_WARNING, "GL: OpenGL 1.1 does not support GPU compressed texture formats");
-        return id;
-    }
-#else
-    if ((!RLGL.ExtSupported.texCompDXT) && ((format == COMPRESSED_DXT1_RGB) || (format == COMPRESSED_DXT1_RGBA) ||
-        (format == COMPRESSED_DXT3_RGBA) || (format == COMPRESSED_DXT5_RGBA)))
-    {
-        TRACELOG(LOG_WARNING, "GL: DXT compressed texture format not supported");
-        return id;
-    }
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if ((!RLGL.ExtSupported.texCompETC1) && (format == COMPRESSED_ETC1_RGB))
-    {
-        TRACELOG(LOG_WARNING, "GL: ETC1 compressed texture format not supported");
-        return id;
-    }
 
-    if ((!RLGL.ExtSupported.texCompETC2) && ((format == COMPRESSED_ETC2_RGB) || (format == COMPRESSED_ETC2_EAC_RGBA)))
-    {
-        TRACELOG(LOG_WARNING, "GL: ETC2 compressed texture format not supported");
-        return id;
-    }
+    // Initialize CPU (RAM) vertex buffers (position, texcoord, color data and indexes)
+    //--------------------------------------------------------------------------------------------
+    batch.vertexBuffer = (VertexBuffer *)RL_MALLOC(sizeof(VertexBuffer)*numBuffers);
 
-    if ((!RLGL.ExtSupported.texCompPVRT) && ((format == COMPRESSED_PVRT_RGB) || (format == COMPRESSED_PVRT_RGBA)))
+    for (int i = 0; i < numBuffers; i++)
     {
-        TRACELOG(LOG_WARNING, "GL: PVRT compressed texture format not supported");
-        return id;
-    }
+        batch.vertexBuffer[i].elementsCount = bufferElements;
 
-    if ((!RLGL.ExtSupported.texCompASTC) && ((format == COMPRESSED_ASTC_4x4_RGBA) || (format == COMPRESSED_ASTC_8x8_RGBA)))
-    {
-        TRACELOG(LOG_WARNING, "GL: ASTC compressed texture format not supported");
-        return id;
-    }
+        batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
+        batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
+        batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+#if defined(GRAPHICS_API_OPENGL_33)
+        batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+        batch.vertexBuffer[i].indices = (unsigned short *)RL_MALLOC(bufferElements*6*sizeof(unsigned short));  // 6 int by quad (indices)
 #endif
-#endif      // GRAPHICS_API_OPENGL_11
 
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+#if defined(GRAPHICS_API_OPENGL_33)
+        batch.vertexBuffer[i].drawIndices = (unsigned int *)RL_MALLOC(bufferElements*BATCH_ELEMENT_INDICES*sizeof(unsigned int));
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+        batch.vertexBuffer[i].drawIndices = (unsigned short *)RL_MALLOC(bufferElements*BATCH_ELEMENT_INDICES*sizeof(unsigned short));
+#endif
+        if (vertexFormat == RL_VERTEX_FORMAT_COMPACT_2D) batch.vertexBuffer[i].interleaved = (unsigned char *)RL_MALLOC(bufferElements*4*sizeof(CompactVertex));
+        else batch.vertexBuffer[i].interleaved = NULL;
 
-    glGenTextures(1, &id);              // Generate texture id
+        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
+        for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
+        for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    //glActiveTexture(GL_TEXTURE0);     // If not defined, using GL_TEXTURE0 by default (shader texture)
-#endif
+        int k = 0;
 
-    glBindTexture(GL_TEXTURE_2D, id);
+        // Indices can be initialized right now
+        for (int j = 0; j < (6*bufferElements); j += 6)
+        {
+            batch.vertexBuffer[i].indices[j] = 4*k;
+            batch.vertexBuffer[i].indices[j + 1] = 4*k + 1;
+            batch.vertexBuffer[i].indices[j + 2] = 4*k + 2;
+            batch.vertexBuffer[i].indices[j + 3] = 4*k;
+            batch.vertexBuffer[i].indices[j + 4] = 4*k + 2;
+            batch.vertexBuffer[i].indices[j + 5] = 4*k + 3;
 
-    int mipWidth = width;
-    int mipHeight = height;
-    int mipOffset = 0;          // Mipmap data offset
+            k++;
+        }
 
-    // Load the different mipmap levels
-    for (int i = 0; i < mipmapCount; i++)
-    {
-        unsigned int mipSize = GetPixelDataSize(mipWidth, mipHeight, format);
+        batch.vertexBuffer[i].vCounter = 0;
+        batch.vertexBuffer[i].tcCounter = 0;
+        batch.vertexBuffer[i].cCounter = 0;
+        batch.vertexBuffer[i].iCounter = 0;
 
-        unsigned int glInternalFormat, glFormat, glType;
-        rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+        batch.vertexBuffer[i].fence = NULL;
+        batch.vertexBuffer[i].busyCount = 0;
+        batch.vertexBuffer[i].uploadCounter = 0;
+        batch.vertexBuffer[i].indexUploadCounter = 0;
+    }
 
-        TRACELOGD("TEXTURE: Load mipmap level %i (%i x %i), size: %i, offset: %i", i, mipWidth, mipHeight, mipSize, mipOffset);
+    TRACELOG(LOG_INFO, "RLGL: Internal vertex buffers initialized successfully in RAM (CPU)");
+    //--------------------------------------------------------------------------------------------
 
-        if (glInternalFormat != -1)
+    // Upload to GPU (VRAM) vertex data and initialize VAOs/VBOs
+    //--------------------------------------------------------------------------------------------
+    for (int i = 0; i < numBuffers; i++)
+    {
+        if (RLGL.ExtSupported.vao)
         {
-            if (format < COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, (unsigned char *)data + mipOffset);
-        #if !defined(GRAPHICS_API_OPENGL_11)
-            else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, (unsigned char *)data + mipOffset);
-        #endif
-
-        #if defined(GRAPHICS_API_OPENGL_33)
-            if (format == UNCOMPRESSED_GRAYSCALE)
-            {
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
-                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-            else if (format == UNCOMPRESSED_GRAY_ALPHA)
-            {
-            #if defined(GRAPHICS_API_OPENGL_21)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
-            #elif defined(GRAPHICS_API_OPENGL_33)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
-            #endif
-                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-        #endif
+            // Initialize Quads VAO
+            glGenVertexArrays(1, &batch.vertexBuffer[i].vaoId);
+            StateBindVertexArray(batch.vertexBuffer[i].vaoId);
         }
 
-        mipWidth /= 2;
-        mipHeight /= 2;
-        mipOffset += mipSize;
+        if (vertexFormat == RL_VERTEX_FORMAT_COMPACT_2D)
+        {
+            // Quads - Interleaved vertex buffer: position (shader-location = 0), texcoord (shader-location = 1), color (shader-location = 3)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*4*sizeof(CompactVertex), NULL, GL_DYNAMIC_DRAW);
 
-        // Security check for NPOT textures
-        if (mipWidth < 1) mipWidth = 1;
-        if (mipHeight < 1) mipHeight = 1;
-    }
+            batch.vertexBuffer[i].vboId[1] = 0;
+            batch.vertexBuffer[i].vboId[2] = 0;
+        }
+        else
+        {
+            // Quads - Vertex buffers binding
+            // Vertex position buffer (shader-location = 0)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
+
+            // Vertex texcoord buffer (shader-location = 1)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
+
+            // Vertex color buffer (shader-location = 3)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
+        }
 
-    // Texture parameters configuration
-    // NOTE: glTexParameteri does NOT affect texture uploading, just the way it's used
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    // NOTE: OpenGL ES 2.0 with no GL_OES_texture_npot support (i.e. WebGL) has limited NPOT support, so CLAMP_TO_EDGE must be used
-    if (RLGL.ExtSupported.texNPOT)
-    {
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
-    }
-    else
-    {
-        // NOTE: If using negative texture coordinates (LoadOBJ()), it does not work!
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);       // Set texture to clamp on x-axis
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);       // Set texture to clamp on y-axis
-    }
-#else
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
-#endif
+        // Vertex attributes enable (kept by VAO)
+        SetVertexBufferAttribs(&batch.vertexBuffer[i], vertexFormat);
 
-    // Magnification and minification filters
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
+        // Draw indices buffer (filled on drawing with rlIndex() indices)
+        // NOTE: Created before quads index buffer, last element array buffer binding is kept by VAO
+        glGenBuffers(1, &batch.vertexBuffer[i].vboId[4]);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[4]);
+#if defined(GRAPHICS_API_OPENGL_33)
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*BATCH_ELEMENT_INDICES*sizeof(int), NULL, GL_DYNAMIC_DRAW);
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*BATCH_ELEMENT_INDICES*sizeof(short), NULL, GL_DYNAMIC_DRAW);
+#endif
 
+        // Fill index buffer
+        glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
 #if defined(GRAPHICS_API_OPENGL_33)
-    if (mipmapCount > 1)
-    {
-        // Activate Trilinear filtering if mipmaps are available
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-    }
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(int), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(short), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
 #endif
+    }
 
-    // At this point we have the texture loaded in GPU and texture parameters configured
+    TRACELOG(LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully");
 
-    // NOTE: If mipmaps were not in data, they are not generated automatically
+    // Unbind the current VAO
+    if (RLGL.ExtSupported.vao) StateBindVertexArray(0);
+    //--------------------------------------------------------------------------------------------
 
-    // Unbind current texture
-    glBindTexture(GL_TEXTURE_2D, 0);
+    // Init draw calls tracking system
+    //--------------------------------------------------------------------------------------------
+    batch.draws = (DrawCall *)RL_MALLOC(drawsCapacity*sizeof(DrawCall));
 
-    if (id > 0) TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Texture created successfully (%ix%i - %i mipmaps)", id, width, height, mipmapCount);
-    else TRACELOG(LOG_WARNING, "TEXTURE: Failed to load texture");
+    for (int i = 0; i < drawsCapacity; i++)
+    {
+        batch.draws[i].mode = RL_QUADS;
+        batch.draws[i].vertexCount = 0;
+        batch.draws[i].vertexAlignment = 0;
+        batch.draws[i].indexCount = 0;
+        //batch.draws[i].vaoId = 0;
+        //batch.draws[i].shaderId = 0;
+        batch.draws[i].textureId = RLGL.State.defaultTextureId;
+        batch.draws[i].layer = RLGL.State.currentLayer;
+        batch.draws[i].transform = MatrixIdentity();
+        //batch.draws[i].RLGL.State.projection = MatrixIdentity();
+        //batch.draws[i].RLGL.State.modelview = MatrixIdentity();
+    }
 
-    return id;
+    batch.buffersCount = numBuffers;    // Record buffer count
+    batch.drawsCounter = 1;             // Reset draws counter
+    batch.drawsCapacity = drawsCapacity;    // Record draw calls capacity
+    batch.currentDepth = -1.0f;         // Reset depth value
+    batch.sortMode = RL_BATCH_SORT_NONE;    // Draw calls processed in submission order by default
+    batch.vertexFormat = vertexFormat;      // Vertex data format on GPU
+    batch.retained = false;             // Batch data is reset after drawing by default
+    //--------------------------------------------------------------------------------------------
+#endif
+    return batch;
 }
 
-// Load depth texture/renderbuffer (to be attached to fbo)
-// WARNING: OpenGL ES 2.0 requires GL_OES_depth_texture/WEBGL_depth_texture extensions
-unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
+// Draw render batch
+// NOTE: We require a pointer to reset batch and increase current buffer (multi-buffer)
+// Retained batches are not reset after drawing, their vertex data is kept on GPU and re-submitted
+// on every call, only data added since previous upload is sent to GPU
+void rlDrawRenderBatch(RenderBatch *batch)
 {
-    unsigned int id = 0;
-
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // In case depth textures not supported, we force renderbuffer usage
-    if (!RLGL.ExtSupported.texDepth) useRenderBuffer = true;
+    // Keep submission order: pending data on active batch must be drawn before the requested one
+    if ((batch != RLGL.currentBatch) && !RLGL.currentBatch->retained) rlDrawRenderBatch(RLGL.currentBatch);
 
-    // NOTE: We let the implementation to choose the best bit-depth
-    // Possible formats: GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT24, GL_DEPTH_COMPONENT32 and GL_DEPTH_COMPONENT32F
-    unsigned int glInternalFormat = GL_DEPTH_COMPONENT;
+    // Register flush for frame statistics, reason is consumed (next flushes are explicit unless set again)
+    if (batch->vertexBuffer[batch->currentBuffer].vCounter > 0) RLGL.State.frameStats.flushes[RLGL.State.flushReason]++;
+    RLGL.State.flushReason = RL_FLUSH_EXPLICIT;
 
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.maxDepthBits == 32) glInternalFormat = GL_DEPTH_COMPONENT32_OES;
-    else if (RLGL.ExtSupported.maxDepthBits == 24) glInternalFormat = GL_DEPTH_COMPONENT24_OES;
-    else glInternalFormat = GL_DEPTH_COMPONENT16;
-#endif
+    // Sort and merge draw calls if required, reordered vertex data must be fully uploaded again
+    if ((batch->sortMode != RL_BATCH_SORT_NONE) && (batch->vertexBuffer[batch->currentBuffer].vCounter > batch->vertexBuffer[batch->currentBuffer].uploadCounter)) SortRenderBatch(batch);
 
-    if (!useRenderBuffer && RLGL.ExtSupported.texDepth)
+    // Update batch vertex buffers
+    //------------------------------------------------------------------------------------------------------------
+    // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
+    // NOTE: If no data changed on the CPU arrays since last upload, GPU arrays are not updated
+    if ((batch->vertexBuffer[batch->currentBuffer].vCounter > batch->vertexBuffer[batch->currentBuffer].uploadCounter) ||
+        (batch->vertexBuffer[batch->currentBuffer].iCounter > batch->vertexBuffer[batch->currentBuffer].indexUploadCounter))
     {
-        glGenTextures(1, &id);
-        glBindTexture(GL_TEXTURE_2D, id);
-        glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+        VertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
 
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        // Check if GPU could still be reading from this buffer (previous draw submitted with it)
+        // NOTE: In that case, buffers storage is orphaned (glBufferData() with NULL) so the driver
+        // can allocate a new one and keep the old one alive until GPU is done, avoiding a sync stall.
+        // If fence sync objects are not available, buffers are always orphaned before update
+        bool orphanBuffers = true;
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+        if (buffer->fence != NULL)
+        {
+            GLenum result = glClientWaitSync((GLsync)buffer->fence, 0, 0);
 
-        glBindTexture(GL_TEXTURE_2D, 0);
+            if ((result == GL_ALREADY_SIGNALED) || (result == GL_CONDITION_SATISFIED)) orphanBuffers = false;
+            else buffer->busyCount++;
 
-        TRACELOG(LOG_INFO, "TEXTURE: Depth texture loaded successfully");
-    }
-    else
-    {
-        // Create the renderbuffer that will serve as the depth attachment for the framebuffer
-        // NOTE: A renderbuffer is simpler than a texture and could offer better performance on embedded devices
-        glGenRenderbuffers(1, &id);
-        glBindRenderbuffer(GL_RENDERBUFFER, id);
-        glRenderbufferStorage(GL_RENDERBUFFER, glInternalFormat, width, height);
+            glDeleteSync((GLsync)buffer->fence);
+            buffer->fence = NULL;
+        }
+        else orphanBuffers = false;     // Buffer never used for drawing, no need to orphan
+#endif
+        // Orphaned buffers lose their previous content, all vertex data must be uploaded again
+        if (orphanBuffers)
+        {
+            buffer->uploadCounter = 0;
+            buffer->indexUploadCounter = 0;
+        }
 
-        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+        int offset = buffer->uploadCounter;
+        int count = buffer->vCounter - buffer->uploadCounter;
 
-        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Depth renderbuffer loaded successfully (%i bits)", id, (RLGL.ExtSupported.maxDepthBits >= 24)? RLGL.ExtSupported.maxDepthBits : 16);
-    }
-#endif
+        // Activate elements VAO
+        if (RLGL.ExtSupported.vao) StateBindVertexArray(buffer->vaoId);
 
-    return id;
-}
+        if (batch->vertexFormat == RL_VERTEX_FORMAT_COMPACT_2D)
+        {
+            // Pack vertex data into interleaved compact vertex (z discarded, texcoords normalized to 16 bit)
+            CompactVertex *data = (CompactVertex *)buffer->interleaved;
 
-// Load texture cubemap
-// NOTE: Cubemap data is expected to be 6 images in a single data array (one after the other),
-// expected the following convention: +X, -X, +Y, -Y, +Z, -Z
-unsigned int rlLoadTextureCubemap(void *data, int size, int format)
-{
-    unsigned int id = 0;
+            for (int i = 0; i < count; i++)
+            {
+                const float *position = buffer->vertices + 3*(offset + i);
+                const float *texcoord = buffer->texcoords + 2*(offset + i);
+
+                data[i].position[0] = position[0];
+                data[i].position[1] = position[1];
+                data[i].texcoord[0] = (unsigned short)(((texcoord[0] < 0.0f)? 0.0f : (texcoord[0] > 1.0f)? 1.0f : texcoord[0])*65535.0f + 0.5f);
+                data[i].texcoord[1] = (unsigned short)(((texcoord[1] < 0.0f)? 0.0f : (texcoord[1] > 1.0f)? 1.0f : texcoord[1])*65535.0f + 0.5f);
+                memcpy(data[i].color, buffer->colors + 4*(offset + i), 4);
+            }
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned int dataSize = GetPixelDataSize(size, size, format);
+            // Interleaved vertex buffer
+            glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+            if (orphanBuffers) glBufferData(GL_ARRAY_BUFFER, buffer->elementsCount*4*sizeof(CompactVertex), NULL, GL_DYNAMIC_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, offset*sizeof(CompactVertex), count*sizeof(CompactVertex), data);
 
-    glGenTextures(1, &id);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+            RLGL.State.frameStats.bytesUploaded += count*sizeof(CompactVertex);
+        }
+        else
+        {
+            // Vertex positions buffer
+            glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+            if (orphanBuffers) glBufferData(GL_ARRAY_BUFFER, buffer->elementsCount*3*4*sizeof(float), NULL, GL_DYNAMIC_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, offset*3*sizeof(float), count*3*sizeof(float), buffer->vertices + offset*3);
+
+            // Texture coordinates buffer
+            glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[1]);
+            if (orphanBuffers) glBufferData(GL_ARRAY_BUFFER, buffer->elementsCount*2*4*sizeof(float), NULL, GL_DYNAMIC_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, offset*2*sizeof(float), count*2*sizeof(float), buffer->texcoords + offset*2);
+
+            // Colors buffer
+            glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[2]);
+            if (orphanBuffers) glBufferData(GL_ARRAY_BUFFER, buffer->elementsCount*4*4*sizeof(unsigned char), NULL, GL_DYNAMIC_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, offset*4*sizeof(unsigned char), count*4*sizeof(unsigned char), buffer->colors + offset*4);
+
+            RLGL.State.frameStats.bytesUploaded += count*(3*sizeof(float) + 2*sizeof(float) + 4*sizeof(unsigned char));
+        }
 
-    unsigned int glInternalFormat, glFormat, glType;
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+        buffer->uploadCounter = buffer->vCounter;
 
-    if (glInternalFormat != -1)
-    {
-        // Load cubemap faces
-        for (unsigned int i = 0; i < 6; i++)
+        // Draw indices buffer (only if indexed draws have been submitted)
+        // NOTE: Binding it replaces VAO element array buffer, quads index buffer must be bound again
+        if (buffer->iCounter > buffer->indexUploadCounter)
         {
-            if (data == NULL)
-            {
-                if (format < COMPRESSED_DXT1_RGB)
-                {
-                    if (format == UNCOMPRESSED_R32G32B32)
-                    {
-                        // Instead of using a sized internal texture format (GL_RGB16F, GL_RGB32F), we let the driver to choose the better format for us (GL_RGB)
-                        if (RLGL.ExtSupported.texFloat32) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB, size, size, 0, GL_RGB, GL_FLOAT, NULL);
-                        else TRACELOG(LOG_WARNING, "TEXTURES: Cubemap requested format not supported");
-                    }
-                    else if ((format == UNCOMPRESSED_R32) || (format == UNCOMPRESSED_R32G32B32A32)) TRACELOG(LOG_WARNING, "TEXTURES: Cubemap requested format not supported");
-                    else glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, NULL);
-                }
-                else TRACELOG(LOG_WARNING, "TEXTURES: Empty cubemap creation does not support compressed format");
-            }
-            else
-            {
-                if (format < COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, (unsigned char *)data + i*dataSize);
-                else glCompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, dataSize, (unsigned char *)data + i*dataSize);
-            }
+            int indexOffset = buffer->indexUploadCounter;
+            int indexCount = buffer->iCounter - buffer->indexUploadCounter;
 
-#if defined(GRAPHICS_API_OPENGL_33)
-            if (format == UNCOMPRESSED_GRAYSCALE)
-            {
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
-                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-            else if (format == UNCOMPRESSED_GRAY_ALPHA)
-            {
-#if defined(GRAPHICS_API_OPENGL_21)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
-#elif defined(GRAPHICS_API_OPENGL_33)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
-#endif
-                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-#endif
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer->vboId[4]);
+            if (orphanBuffers) glBufferData(GL_ELEMENT_ARRAY_BUFFER, buffer->elementsCount*BATCH_ELEMENT_INDICES*sizeof(buffer->drawIndices[0]), NULL, GL_DYNAMIC_DRAW);
+            glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, indexOffset*sizeof(buffer->drawIndices[0]), indexCount*sizeof(buffer->drawIndices[0]), buffer->drawIndices + indexOffset);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer->vboId[3]);
+
+            buffer->indexUploadCounter = buffer->iCounter;
+            RLGL.State.frameStats.bytesUploaded += indexCount*sizeof(buffer->drawIndices[0]);
+        }
+
+        // NOTE: glMapBuffer() causes sync issue.
+        // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
+        // Orphaning the buffer (see above) avoids the stall for glBufferSubData() and glMapBuffer() alike
+    }
+    //------------------------------------------------------------------------------------------------------------
+
+    // Draw batch vertex buffers (considering VR stereo if required)
+    //------------------------------------------------------------------------------------------------------------
+    Matrix matProjection = RLGL.State.projection;
+    Matrix matModelView = RLGL.State.modelview;
+
+    int eyesCount = 1;
+#if defined(SUPPORT_VR_SIMULATOR)
+    if (RLGL.Vr.stereoRender) eyesCount = 2;
+#endif
+
+    for (int eye = 0; eye < eyesCount; eye++)
+    {
+#if defined(SUPPORT_VR_SIMULATOR)
+        if (eyesCount == 2) SetStereoView(eye, matProjection, matModelView);
+#endif
+        // Draw buffers
+        if (batch->vertexBuffer[batch->currentBuffer].vCounter > 0)
+        {
+            // Set current shader and upload current MVP matrix
+            StateUseProgram(RLGL.State.currentShader.id);
+
+            // Create modelview-projection matrix and upload to shader
+            Matrix matMVP = MatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
+            SetShaderValueMatrix(RLGL.State.currentShader, RLGL.State.currentShader.locs[LOC_MATRIX_MVP], matMVP);
+
+            if (RLGL.ExtSupported.vao) StateBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+            else
+            {
+                // Bind vertex attribs: position (shader-location = 0), texcoord (shader-location = 1), color (shader-location = 3)
+                SetVertexBufferAttribs(&batch->vertexBuffer[batch->currentBuffer], batch->vertexFormat);
+
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
+            }
+
+            // Setup some default shader values
+            float colDiffuse[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+            int mapDiffuse = 0;     // Active default sampler2D: texture0
+            SetShaderUniform(RLGL.State.currentShader.id, RLGL.State.currentShader.locs[LOC_COLOR_DIFFUSE], colDiffuse, UNIFORM_VEC4, 1);
+            SetShaderUniform(RLGL.State.currentShader.id, RLGL.State.currentShader.locs[LOC_MAP_DIFFUSE], &mapDiffuse, UNIFORM_SAMPLER2D, 1);
+
+            // Activate additional sampler textures
+            // Those additional textures will be common for all draw calls of the batch
+            for (int i = 0; i < MAX_BATCH_ACTIVE_TEXTURES; i++)
+            {
+                if (RLGL.State.activeTextureId[i] > 0)
+                {
+                    StateActiveTexture(GL_TEXTURE0 + 1 + i);
+                    StateBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
+                }
+            }
+
+            // Activate default sampler2D texture0 (one texture is always active for default batch shader)
+            // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
+            StateActiveTexture(GL_TEXTURE0);
+
+            // Depth sorted batches rely on depth test to resolve visibility (vertex depth keeps submission order)
+            // NOTE: Depth test and depth writing states are restored after drawing
+            GLboolean depthTestEnabled = GL_TRUE;
+            GLboolean depthMaskEnabled = GL_TRUE;
+            if (batch->sortMode == RL_BATCH_SORT_DEPTH)
+            {
+                depthTestEnabled = (RLGL.Cache.depthTest != -1)? (GLboolean)RLGL.Cache.depthTest : glIsEnabled(GL_DEPTH_TEST);
+                if (RLGL.Cache.depthMask != -1) depthMaskEnabled = (GLboolean)RLGL.Cache.depthMask;
+                else glGetBooleanv(GL_DEPTH_WRITEMASK, &depthMaskEnabled);
+
+                StateSetCapability(GL_DEPTH_TEST, true);
+                StateDepthMask(true);
+            }
+
+            Matrix matTransform = MatrixIdentity();     // Transform matrix currently premultiplied in uploaded MVP
+            unsigned int elementBuffer = batch->vertexBuffer[batch->currentBuffer].vboId[3];    // Element array buffer currently bound
+
+            for (int i = 0, vertexOffset = 0, indexOffset = 0; i < batch->drawsCounter; i++)
+            {
+                // Upload draw call transform if required (per-draw transform mode)
+                if (memcmp(&batch->draws[i].transform, &matTransform, sizeof(Matrix)) != 0)
+                {
+                    matTransform = batch->draws[i].transform;
+                    matMVP = MatrixMultiply(matTransform, MatrixMultiply(RLGL.State.modelview, RLGL.State.projection));
+                    SetShaderValueMatrix(RLGL.State.currentShader, RLGL.State.currentShader.locs[LOC_MATRIX_MVP], matMVP);
+                }
+
+                // Bind current draw call texture, activated as GL_TEXTURE0 and binded to sampler2D texture0 by default
+                StateBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+
+                if (batch->draws[i].indexCount > 0)
+                {
+                    // Indexed draw, indices already point to vertex positions in the buffer
+                    if (elementBuffer != batch->vertexBuffer[batch->currentBuffer].vboId[4])
+                    {
+                        elementBuffer = batch->vertexBuffer[batch->currentBuffer].vboId[4];
+                        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, elementBuffer);
+                    }
+#if defined(GRAPHICS_API_OPENGL_33)
+                    glDrawElements((batch->draws[i].mode == RL_LINES)? GL_LINES : GL_TRIANGLES, batch->draws[i].indexCount, GL_UNSIGNED_INT, (GLvoid *)(indexOffset*sizeof(GLuint)));
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+                    glDrawElements((batch->draws[i].mode == RL_LINES)? GL_LINES : GL_TRIANGLES, batch->draws[i].indexCount, GL_UNSIGNED_SHORT, (GLvoid *)(indexOffset*sizeof(GLushort)));
+#endif
+                }
+                else if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
+                else
+                {
+                    if (elementBuffer != batch->vertexBuffer[batch->currentBuffer].vboId[3])
+                    {
+                        elementBuffer = batch->vertexBuffer[batch->currentBuffer].vboId[3];
+                        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, elementBuffer);
+                    }
+#if defined(GRAPHICS_API_OPENGL_33)
+                    // We need to define the number of indices to be processed: quadsCount*6
+                    // NOTE: The final parameter tells the GPU the offset in bytes from the
+                    // start of the index buffer to the location of the first index to process
+                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)));
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(vertexOffset/4*6*sizeof(GLushort)));
+#endif
+                }
+
+                RLGL.State.frameStats.drawCalls++;
+                RLGL.State.frameStats.vertices += batch->draws[i].vertexCount;
+
+                vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+                indexOffset += batch->draws[i].indexCount;
+            }
+
+            // Quads index buffer is kept as VAO element array buffer
+            if (elementBuffer != batch->vertexBuffer[batch->currentBuffer].vboId[3]) glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
+
+            if ((batch->sortMode == RL_BATCH_SORT_DEPTH) && !depthTestEnabled) StateSetCapability(GL_DEPTH_TEST, false);
+            if ((batch->sortMode == RL_BATCH_SORT_DEPTH) && !depthMaskEnabled) StateDepthMask(false);
+
+            if (!RLGL.ExtSupported.vao)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, 0);
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+            }
+
+            // NOTE: Texture, VAO and shader program are kept bound, state cache skips redundant bindings
+        }
+    }
+    //------------------------------------------------------------------------------------------------------------
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    // Insert a fence to know when GPU has finished drawing from current buffer
+    if (batch->vertexBuffer[batch->currentBuffer].vCounter > 0)
+    {
+        if (batch->vertexBuffer[batch->currentBuffer].fence != NULL) glDeleteSync((GLsync)batch->vertexBuffer[batch->currentBuffer].fence);
+        batch->vertexBuffer[batch->currentBuffer].fence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+#endif
+
+    // Restore projection/modelview matrices
+    RLGL.State.projection = matProjection;
+    RLGL.State.modelview = matModelView;
+
+    // Reset active texture units for next batch
+    for (int i = 0; i < MAX_BATCH_ACTIVE_TEXTURES; i++) RLGL.State.activeTextureId[i] = 0;
+
+    // Retained batches keep their vertex data and draw calls to be re-submitted
+    if (!batch->retained) rlResetRenderBatch(batch);
+#endif
+}
+
+// Reset render batch data
+// NOTE: Vertex data and draw calls are discarded and current buffer is moved to next one (multi-buffering),
+// it's called automatically after drawing non-retained batches, retained batches require it to be refilled
+void rlResetRenderBatch(RenderBatch *batch)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Reset vertex counters for next frame
+    batch->vertexBuffer[batch->currentBuffer].vCounter = 0;
+    batch->vertexBuffer[batch->currentBuffer].tcCounter = 0;
+    batch->vertexBuffer[batch->currentBuffer].cCounter = 0;
+    batch->vertexBuffer[batch->currentBuffer].iCounter = 0;
+    batch->vertexBuffer[batch->currentBuffer].uploadCounter = 0;
+    batch->vertexBuffer[batch->currentBuffer].indexUploadCounter = 0;
+
+    // Reset depth for next draw
+    batch->currentDepth = -1.0f;
+
+    // Reset batch draws array
+    Matrix transform = GetDrawTransform();
+
+    for (int i = 0; i < batch->drawsCapacity; i++)
+    {
+        batch->draws[i].mode = RL_QUADS;
+        batch->draws[i].vertexCount = 0;
+        batch->draws[i].vertexAlignment = 0;
+        batch->draws[i].indexCount = 0;
+        batch->draws[i].textureId = RLGL.State.defaultTextureId;
+        batch->draws[i].layer = RLGL.State.currentLayer;
+        batch->draws[i].transform = transform;
+    }
+
+    // Reset draws counter to one draw for the batch
+    batch->drawsCounter = 1;
+
+    // Change to next buffer in the list (in case of multi-buffering)
+    batch->currentBuffer++;
+    if (batch->currentBuffer >= batch->buffersCount) batch->currentBuffer = 0;
+#endif
+}
+
+// Unload render batch vertex data from CPU and GPU
+void rlUnloadRenderBatch(RenderBatch batch)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Unbind everything
+    if (RLGL.ExtSupported.vao) StateBindVertexArray(0);
+    glDisableVertexAttribArray(0);
+    glDisableVertexAttribArray(1);
+    glDisableVertexAttribArray(2);
+    glDisableVertexAttribArray(3);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+    // Unload all vertex buffers data
+    for (int i = 0; i < batch.buffersCount; i++)
+    {
+        // Delete VBOs from GPU (VRAM)
+        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
+        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
+        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[3]);
+        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[4]);
+
+        // Delete VAOs from GPU (VRAM)
+        if (RLGL.ExtSupported.vao)
+        {
+            if (RLGL.Cache.vertexArray == batch.vertexBuffer[i].vaoId) RLGL.Cache.vertexArray = 0;
+            glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
+        }
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+        // Delete pending fence sync object
+        if (batch.vertexBuffer[i].fence != NULL) glDeleteSync((GLsync)batch.vertexBuffer[i].fence);
+#endif
+
+        // Free vertex arrays memory from CPU (RAM)
+        RL_FREE(batch.vertexBuffer[i].vertices);
+        RL_FREE(batch.vertexBuffer[i].texcoords);
+        RL_FREE(batch.vertexBuffer[i].colors);
+        RL_FREE(batch.vertexBuffer[i].indices);
+        RL_FREE(batch.vertexBuffer[i].drawIndices);
+        RL_FREE(batch.vertexBuffer[i].interleaved);
+    }
+
+    // Unload arrays
+    RL_FREE(batch.vertexBuffer);
+    RL_FREE(batch.draws);
+#endif
+}
+
+// Set the active render batch for rlgl
+// NOTE: Current batch is drawn before switching (unless it is retained, those are only drawn on request),
+// passing NULL sets the default internal batch
+void rlSetRenderBatchActive(RenderBatch *batch)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.currentBatch->retained) rlDrawRenderBatch(RLGL.currentBatch);
+
+    if (batch != NULL) RLGL.currentBatch = batch;
+    else RLGL.currentBatch = &RLGL.defaultBatch;
+#endif
+}
+
+// Set active render batch draw calls sorting mode (BatchSortMode)
+// NOTE: Sorted batches reorder draw calls by layer (see rlSetDrawLayer()), texture and mode before drawing,
+// RL_BATCH_SORT_DEPTH enables depth test while drawing, useful for opaque content drawn in any order;
+// vertex depth is reset on every batch draw, so it works better with one batch draw per frame
+void rlSetRenderBatchSortMode(int mode)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Compact vertex format discards vertex depth, depth test can not resolve visibility
+    if ((mode == RL_BATCH_SORT_DEPTH) && (RLGL.currentBatch->vertexFormat == RL_VERTEX_FORMAT_COMPACT_2D))
+    {
+        TRACELOG(LOG_WARNING, "RLGL: Depth sorting not supported by compact vertex format batches, using layered sorting");
+        mode = RL_BATCH_SORT_LAYERED;
+    }
+
+    RLGL.currentBatch->sortMode = mode;
+#endif
+}
+
+// Set draw layer for next vertex data (sorting key on sorted batches)
+// NOTE: Layers are drawn in ascending order, default layer is 0
+void rlSetDrawLayer(int layer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.currentLayer != layer)
+    {
+        RLGL.State.currentLayer = layer;
+
+        if (RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount > 0)
+        {
+            // Make sure current draw call vertexCount is aligned a multiple of 4 (same as rlBegin())
+            DrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1];
+            int mode = draw->mode;
+            unsigned int textureId = draw->textureId;
+            Matrix transform = draw->transform;
+
+            if (draw->indexCount > 0) draw->vertexAlignment = (4 - draw->vertexCount%4)%4;
+            else if (mode == RL_LINES) draw->vertexAlignment = ((draw->vertexCount < 4)? draw->vertexCount : draw->vertexCount%4);
+            else if (mode == RL_TRIANGLES) draw->vertexAlignment = ((draw->vertexCount < 4)? 1 : (4 - (draw->vertexCount%4)));
+            else draw->vertexAlignment = 0;
+
+            if (rlCheckBufferLimit(draw->vertexAlignment))
+            {
+                FlushRenderBatch(RL_FLUSH_BUFFER_FULL);
+            }
+            else
+            {
+                RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter += draw->vertexAlignment;
+                RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter += draw->vertexAlignment;
+                RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].tcCounter += draw->vertexAlignment;
+
+                RLGL.currentBatch->drawsCounter++;
+
+                if (RLGL.currentBatch->drawsCounter >= RLGL.currentBatch->drawsCapacity)
+                {
+                    if (RLGL.currentBatch->sortMode != RL_BATCH_SORT_NONE) SortRenderBatch(RLGL.currentBatch);
+                    if ((RLGL.currentBatch->drawsCounter >= RLGL.currentBatch->drawsCapacity) &&
+                        !(RLGL.currentBatch->retained && GrowRenderBatch(RLGL.currentBatch, 0, RLGL.currentBatch->drawsCounter + 1))) FlushRenderBatch(RL_FLUSH_DRAWCALLS_LIMIT);
+                }
+
+                RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount = 0;
+                RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].indexCount = 0;
+            }
+
+            // New draw call keeps previous mode and texture
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].mode = mode;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].textureId = textureId;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].transform = transform;
+        }
+
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].layer = layer;
+    }
+#endif
+}
+
+// Enable per-draw transform
+// NOTE: Transform matrix set between rlPushMatrix()/rlPopMatrix() is stored per draw call and applied by the
+// shader (premultiplied in MVP matrix), avoiding the CPU transform of every vertex; every transform change
+// registers a new draw call, so it works better for few draws with many vertex (i.e. DrawSphere())
+// WARNING: Every draw using its own transform (DrawCube(), DrawSphere()...) takes a draw call slot,
+// batch is drawn when draw calls limit is reached (DEFAULT_BATCH_DRAWCALLS, 256 by default)
+void rlEnableDrawTransform(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.drawTransform = true;
+#endif
+}
+
+// Disable per-draw transform
+void rlDisableDrawTransform(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.drawTransform) RLGL.State.drawTransformCheck = true;     // Current draw transform could require a reset
+    RLGL.State.drawTransform = false;
+#endif
+}
+
+// Set default render batch buffers count (multi-buffering ring depth)
+// NOTE: Default batch is flushed and reloaded, vertex buffers are cycled on every DrawRenderBatch(),
+// so a buffer is not updated again until count-1 other flushes have been submitted
+void rlSetRenderBatchBuffers(int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (count < 1) count = 1;
+    else if (count > MAX_BATCH_BUFFERS)
+    {
+        TRACELOG(LOG_WARNING, "RLGL: Requested batch buffers count over limit (MAX_BATCH_BUFFERS: %i)", MAX_BATCH_BUFFERS);
+        count = MAX_BATCH_BUFFERS;
+    }
+
+    if (count == RLGL.defaultBatch.buffersCount) return;
+
+    bool defaultActive = (RLGL.currentBatch == &RLGL.defaultBatch);
+
+    rlglDraw();     // Flush any pending vertex data
+
+    int bufferElements = RLGL.defaultBatch.vertexBuffer[0].elementsCount;
+    rlUnloadRenderBatch(RLGL.defaultBatch);
+    RLGL.defaultBatch = rlLoadRenderBatchEx(count, bufferElements, RLGL.defaultBatch.drawsCapacity, RLGL.defaultBatch.vertexFormat);
+
+    if (defaultActive) RLGL.currentBatch = &RLGL.defaultBatch;
+
+    TRACELOG(LOG_INFO, "RLGL: Default render batch set to %i buffers", count);
+#endif
+}
+
+// Get number of times a batch buffer was still in use by GPU when re-uploaded
+// NOTE: Busy buffers are orphaned instead of waited, this counter is only available
+// when fence sync objects are supported (OpenGL 3.3), it always returns 0 otherwise
+int rlGetRenderBatchBusyCount(void)
+{
+    int count = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    for (int i = 0; i < RLGL.currentBatch->buffersCount; i++) count += RLGL.currentBatch->vertexBuffer[i].busyCount;
+#endif
+    return count;
+}
+
+// Get GL state cache statistics
+StateCacheStats rlGetStateCacheStats(void)
+{
+    StateCacheStats stats = { 0 };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    stats = RLGL.Cache.stats;
+#endif
+    return stats;
+}
+
+// Reset GL state cache statistics
+void rlResetStateCacheStats(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    StateCacheStats stats = { 0 };
+    RLGL.Cache.stats = stats;
+#endif
+}
+
+// Invalidate GL state cache (next state changes are always issued)
+// NOTE: Required if OpenGL state is changed out of rlgl (i.e. direct OpenGL calls)
+void rlInvalidateStateCache(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: 0xFFFFFFFF is never returned as a valid object id by OpenGL
+    RLGL.Cache.program = 0xFFFFFFFF;
+    RLGL.Cache.vertexArray = 0xFFFFFFFF;
+    RLGL.Cache.activeTextureUnit = -1;
+
+    for (int i = 0; i < MAX_STATE_TEXTURE_UNITS; i++)
+    {
+        RLGL.Cache.textures[i] = 0xFFFFFFFF;
+        RLGL.Cache.cubemaps[i] = 0xFFFFFFFF;
+    }
+
+    RLGL.Cache.blend = -1;
+    RLGL.Cache.depthTest = -1;
+    RLGL.Cache.depthMask = -1;
+    RLGL.Cache.cullFace = -1;
+    RLGL.Cache.scissorTest = -1;
+    RLGL.Cache.scissor[2] = -1;     // Invalid scissor width, next rlScissor() is always issued
+#endif
+}
+
+// Get rendering statistics of last frame
+FrameStats rlGetFrameStats(void)
+{
+    FrameStats stats = { 0 };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    stats = RLGL.State.lastFrameStats;
+#endif
+    return stats;
+}
+
+// Reset frame statistics
+// NOTE: Current frame counters are kept as last frame statistics
+void rlResetFrameStats(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    FrameStats stats = { 0 };
+    RLGL.State.lastFrameStats = RLGL.State.frameStats;
+    RLGL.State.frameStats = stats;
+#endif
+}
+
+// Load uniform buffer object (data can be NULL)
+unsigned int rlLoadUniformBuffer(const void *data, int size)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_UNIFORM_BUFFER, id);
+    glBufferData(GL_UNIFORM_BUFFER, size, data, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    TRACELOG(LOG_INFO, "UBO: [ID %i] Uniform buffer loaded successfully (%i bytes)", id, size);
+#else
+    TRACELOG(LOG_WARNING, "UBO: Uniform buffers not supported (requires OpenGL 3.3)");
+#endif
+
+    return id;
+}
+
+// Update uniform buffer data
+// NOTE: Shaders using the buffer get the new data without any per-shader upload
+void rlUpdateUniformBuffer(unsigned int id, const void *data, int size, int offset)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    glBindBuffer(GL_UNIFORM_BUFFER, id);
+    glBufferSubData(GL_UNIFORM_BUFFER, offset, size, data);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    RLGL.State.frameStats.bytesUploaded += size;
+#endif
+}
+
+// Bind uniform buffer to a binding point
+void rlBindUniformBuffer(unsigned int id, int bindingPoint)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    glBindBufferBase(GL_UNIFORM_BUFFER, bindingPoint, id);
+#endif
+}
+
+// Set shader uniform block binding point
+// NOTE: Uniform block is read from the uniform buffer bound to the same binding point
+void rlSetShaderUniformBlock(Shader shader, const char *blockName, int bindingPoint)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    unsigned int index = glGetUniformBlockIndex(shader.id, blockName);
+
+    if (index == GL_INVALID_INDEX) TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to find shader uniform block: %s", shader.id, blockName);
+    else
+    {
+        glUniformBlockBinding(shader.id, index, bindingPoint);
+        TRACELOG(LOG_INFO, "SHADER: [ID %i] Shader uniform block (%s) set at binding point: %i", shader.id, blockName, bindingPoint);
+    }
+#endif
+}
+
+// Unload uniform buffer object
+void rlUnloadUniformBuffer(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    glDeleteBuffers(1, &id);
+#endif
+}
+
+// Load OpenGL extensions
+// NOTE: External loader function could be passed as a pointer
+void rlLoadExtensions(void *loader)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    // NOTE: glad is generated and contains only required OpenGL 3.3 Core extensions (and lower versions)
+    #if !defined(__APPLE__)
+        if (!gladLoadGLLoader((GLADloadproc)loader)) TRACELOG(LOG_WARNING, "GLAD: Cannot load OpenGL extensions");
+        else TRACELOG(LOG_INFO, "GLAD: OpenGL extensions loaded successfully");
+
+        #if defined(GRAPHICS_API_OPENGL_21)
+        if (GLAD_GL_VERSION_2_1) TRACELOG(LOG_INFO, "GL: OpenGL 2.1 profile supported");
+        #elif defined(GRAPHICS_API_OPENGL_33)
+        if (GLAD_GL_VERSION_3_3) TRACELOG(LOG_INFO, "GL: OpenGL 3.3 Core profile supported");
+        else TRACELOG(LOG_ERROR, "GL: OpenGL 3.3 Core profile not supported");
+        #endif
+    #endif
+
+    // With GLAD, we can check if an extension is supported using the GLAD_GL_xxx booleans
+    //if (GLAD_GL_ARB_vertex_array_object) // Use GL_ARB_vertex_array_object
+#endif
+}
+
+// Convert image data to OpenGL texture (returns OpenGL valid Id)
+unsigned int rlLoadTexture(void *data, int width, int height, int format, int mipmapCount)
+{
+    StateBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+
+    unsigned int id = 0;
+
+    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
+#if defined(GRAPHICS_API_OPENGL_11)
+    if (format >= COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "GL: OpenGL 1.1 does not support GPU compressed texture formats");
+        return id;
+    }
+#else
+    if ((!RLGL.ExtSupported.texCompDXT) && ((format == COMPRESSED_DXT1_RGB) || (format == COMPRESSED_DXT1_RGBA) ||
+        (format == COMPRESSED_DXT3_RGBA) || (format == COMPRESSED_DXT5_RGBA)))
+    {
+        TRACELOG(LOG_WARNING, "GL: DXT compressed texture format not supported");
+        return id;
+    }
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((!RLGL.ExtSupported.texCompETC1) && (format == COMPRESSED_ETC1_RGB))
+    {
+        TRACELOG(LOG_WARNING, "GL: ETC1 compressed texture format not supported");
+        return id;
+    }
+
+    if ((!RLGL.ExtSupported.texCompETC2) && ((format == COMPRESSED_ETC2_RGB) || (format == COMPRESSED_ETC2_EAC_RGBA)))
+    {
+        TRACELOG(LOG_WARNING, "GL: ETC2 compressed texture format not supported");
+        return id;
+    }
+
+    if ((!RLGL.ExtSupported.texCompPVRT) && ((format == COMPRESSED_PVRT_RGB) || (format == COMPRESSED_PVRT_RGBA)))
+    {
+        TRACELOG(LOG_WARNING, "GL: PVRT compressed texture format not supported");
+        return id;
+    }
+
+    if ((!RLGL.ExtSupported.texCompASTC) && ((format == COMPRESSED_ASTC_4x4_RGBA) || (format == COMPRESSED_ASTC_8x8_RGBA)))
+    {
+        TRACELOG(LOG_WARNING, "GL: ASTC compressed texture format not supported");
+        return id;
+    }
+#endif
+#endif      // GRAPHICS_API_OPENGL_11
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    glGenTextures(1, &id);              // Generate texture id
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    //glActiveTexture(GL_TEXTURE0);     // If not defined, using GL_TEXTURE0 by default (shader texture)
+#endif
+
+    StateBindTexture(GL_TEXTURE_2D, id);
+
+    int mipWidth = width;
+    int mipHeight = height;
+    int mipOffset = 0;          // Mipmap data offset
+
+    // Load the different mipmap levels
+    for (int i = 0; i < mipmapCount; i++)
+    {
+        unsigned int mipSize = GetPixelDataSize(mipWidth, mipHeight, format);
+
+        unsigned int glInternalFormat, glFormat, glType;
+        rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+        TRACELOGD("TEXTURE: Load mipmap level %i (%i x %i), size: %i, offset: %i", i, mipWidth, mipHeight, mipSize, mipOffset);
+
+        if (glInternalFormat != -1)
+        {
+            if (format < COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, (unsigned char *)data + mipOffset);
+        #if !defined(GRAPHICS_API_OPENGL_11)
+            else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, (unsigned char *)data + mipOffset);
+        #endif
+
+        #if defined(GRAPHICS_API_OPENGL_33)
+            if (format == UNCOMPRESSED_GRAYSCALE)
+            {
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+            else if (format == UNCOMPRESSED_GRAY_ALPHA)
+            {
+            #if defined(GRAPHICS_API_OPENGL_21)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
+            #elif defined(GRAPHICS_API_OPENGL_33)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+            #endif
+                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+        #endif
+        }
+
+        mipWidth /= 2;
+        mipHeight /= 2;
+        mipOffset += mipSize;
+
+        // Security check for NPOT textures
+        if (mipWidth < 1) mipWidth = 1;
+        if (mipHeight < 1) mipHeight = 1;
+    }
+
+    // Texture parameters configuration
+    // NOTE: glTexParameteri does NOT affect texture uploading, just the way it's used
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: OpenGL ES 2.0 with no GL_OES_texture_npot support (i.e. WebGL) has limited NPOT support, so CLAMP_TO_EDGE must be used
+    if (RLGL.ExtSupported.texNPOT)
+    {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
+    }
+    else
+    {
+        // NOTE: If using negative texture coordinates (LoadOBJ()), it does not work!
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);       // Set texture to clamp on x-axis
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);       // Set texture to clamp on y-axis
+    }
+#else
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
+#endif
+
+    // Magnification and minification filters
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (mipmapCount > 1)
+    {
+        // Activate Trilinear filtering if mipmaps are available
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    }
+#endif
+
+    // At this point we have the texture loaded in GPU and texture parameters configured
+
+    // NOTE: If mipmaps were not in data, they are not generated automatically
+
+    // Unbind current texture
+    StateBindTexture(GL_TEXTURE_2D, 0);
+
+    if (id > 0) TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Texture created successfully (%ix%i - %i mipmaps)", id, width, height, mipmapCount);
+    else TRACELOG(LOG_WARNING, "TEXTURE: Failed to load texture");
+
+    return id;
+}
+
+// Load depth texture/renderbuffer (to be attached to fbo)
+// WARNING: OpenGL ES 2.0 requires GL_OES_depth_texture/WEBGL_depth_texture extensions
+unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // In case depth textures not supported, we force renderbuffer usage
+    if (!RLGL.ExtSupported.texDepth) useRenderBuffer = true;
+
+    // NOTE: We let the implementation to choose the best bit-depth
+    // Possible formats: GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT24, GL_DEPTH_COMPONENT32 and GL_DEPTH_COMPONENT32F
+    unsigned int glInternalFormat = GL_DEPTH_COMPONENT;
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.maxDepthBits == 32) glInternalFormat = GL_DEPTH_COMPONENT32_OES;
+    else if (RLGL.ExtSupported.maxDepthBits == 24) glInternalFormat = GL_DEPTH_COMPONENT24_OES;
+    else glInternalFormat = GL_DEPTH_COMPONENT16;
+#endif
+
+    if (!useRenderBuffer && RLGL.ExtSupported.texDepth)
+    {
+        glGenTextures(1, &id);
+        StateBindTexture(GL_TEXTURE_2D, id);
+        glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        StateBindTexture(GL_TEXTURE_2D, 0);
+
+        TRACELOG(LOG_INFO, "TEXTURE: Depth texture loaded successfully");
+    }
+    else
+    {
+        // Create the renderbuffer that will serve as the depth attachment for the framebuffer
+        // NOTE: A renderbuffer is simpler than a texture and could offer better performance on embedded devices
+        glGenRenderbuffers(1, &id);
+        glBindRenderbuffer(GL_RENDERBUFFER, id);
+        glRenderbufferStorage(GL_RENDERBUFFER, glInternalFormat, width, height);
+
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Depth renderbuffer loaded successfully (%i bits)", id, (RLGL.ExtSupported.maxDepthBits >= 24)? RLGL.ExtSupported.maxDepthBits : 16);
+    }
+#endif
+
+    return id;
+}
+
+// Load texture cubemap
+// NOTE: Cubemap data is expected to be 6 images in a single data array (one after the other),
+// expected the following convention: +X, -X, +Y, -Y, +Z, -Z
+unsigned int rlLoadTextureCubemap(void *data, int size, int format)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned int dataSize = GetPixelDataSize(size, size, format);
+
+    glGenTextures(1, &id);
+    StateBindTexture(GL_TEXTURE_CUBE_MAP, id);
+
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if (glInternalFormat != -1)
+    {
+        // Load cubemap faces
+        for (unsigned int i = 0; i < 6; i++)
+        {
+            if (data == NULL)
+            {
+                if (format < COMPRESSED_DXT1_RGB)
+                {
+                    if (format == UNCOMPRESSED_R32G32B32)
+                    {
+                        // Instead of using a sized internal texture format (GL_RGB16F, GL_RGB32F), we let the driver to choose the better format for us (GL_RGB)
+                        if (RLGL.ExtSupported.texFloat32) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB, size, size, 0, GL_RGB, GL_FLOAT, NULL);
+                        else TRACELOG(LOG_WARNING, "TEXTURES: Cubemap requested format not supported");
+                    }
+                    else if ((format == UNCOMPRESSED_R32) || (format == UNCOMPRESSED_R32G32B32A32)) TRACELOG(LOG_WARNING, "TEXTURES: Cubemap requested format not supported");
+                    else glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, NULL);
+                }
+                else TRACELOG(LOG_WARNING, "TEXTURES: Empty cubemap creation does not support compressed format");
+            }
+            else
+            {
+                if (format < COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, (unsigned char *)data + i*dataSize);
+                else glCompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, dataSize, (unsigned char *)data + i*dataSize);
+            }
+
+#if defined(GRAPHICS_API_OPENGL_33)
+            if (format == UNCOMPRESSED_GRAYSCALE)
+            {
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+            else if (format == UNCOMPRESSED_GRAY_ALPHA)
+            {
+#if defined(GRAPHICS_API_OPENGL_21)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
+#elif defined(GRAPHICS_API_OPENGL_33)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+#endif
+                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+#endif
         }
     }
 
@@ -2231,7 +3527,7 @@ unsigned int rlLoadTextureCubemap(void *data, int size, int format)
     glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
 #endif
 
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    StateBindTexture(GL_TEXTURE_CUBE_MAP, 0);
 #endif
 
     if (id > 0) TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Cubemap texture created successfully (%ix%i)", id, size, size);
@@ -2244,7 +3540,7 @@ unsigned int rlLoadTextureCubemap(void *data, int size, int format)
 // NOTE: We don't know safely if internal texture format is the expected one...
 void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    StateBindTexture(GL_TEXTURE_2D, id);
 
     unsigned int glInternalFormat, glFormat, glType;
     rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
@@ -2311,6 +3607,9 @@ void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned
 // Unload texture from GPU memory
 void rlUnloadTexture(unsigned int id)
 {
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    StateForgetTexture(id);
+#endif
     glDeleteTextures(1, &id);
 }
 
@@ -2405,7 +3704,7 @@ bool rlFramebufferComplete(unsigned int id)
 // Generate mipmap data for selected texture
 void rlGenerateMipmaps(Texture2D *texture)
 {
-    glBindTexture(GL_TEXTURE_2D, texture->id);
+    StateBindTexture(GL_TEXTURE_2D, texture->id);
 
     // Check if texture is power-of-two (POT)
     bool texIsPOT = false;
@@ -2469,7 +3768,7 @@ void rlGenerateMipmaps(Texture2D *texture)
 #endif
     else TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", texture->id);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    StateBindTexture(GL_TEXTURE_2D, 0);
 }
 
 // Upload vertex data into a VAO (if supported) and VBO
@@ -2499,7 +3798,7 @@ void rlLoadMesh(Mesh *mesh, bool dynamic)
     {
         // Initialize Quads VAO (Buffer A)
         glGenVertexArrays(1, &mesh->vaoId);
-        glBindVertexArray(mesh->vaoId);
+        StateBindVertexArray(mesh->vaoId);
     }
 
     // NOTE: Attributes must be uploaded considering default locations points
@@ -2610,7 +3909,7 @@ unsigned int rlLoadAttribBuffer(unsigned int vaoId, int shaderLoc, void *buffer,
     int drawHint = GL_STATIC_DRAW;
     if (dynamic) drawHint = GL_DYNAMIC_DRAW;
 
-    if (RLGL.ExtSupported.vao) glBindVertexArray(vaoId);
+    if (RLGL.ExtSupported.vao) StateBindVertexArray(vaoId);
 
     glGenBuffers(1, &id);
     glBindBuffer(GL_ARRAY_BUFFER, id);
@@ -2618,7 +3917,7 @@ unsigned int rlLoadAttribBuffer(unsigned int vaoId, int shaderLoc, void *buffer,
     glVertexAttribPointer(shaderLoc, 2, GL_FLOAT, 0, 0, 0);
     glEnableVertexAttribArray(shaderLoc);
 
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    if (RLGL.ExtSupported.vao) StateBindVertexArray(0);
 #endif
 
     return id;
@@ -2637,7 +3936,7 @@ void rlUpdateMeshAt(Mesh mesh, int buffer, int count, int index)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // Activate mesh VAO
-    if (RLGL.ExtSupported.vao) glBindVertexArray(mesh.vaoId);
+    if (RLGL.ExtSupported.vao) StateBindVertexArray(mesh.vaoId);
 
     switch (buffer)
     {
@@ -2704,7 +4003,7 @@ void rlUpdateMeshAt(Mesh mesh, int buffer, int count, int index)
     }
 
     // Unbind the current VAO
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    if (RLGL.ExtSupported.vao) StateBindVertexArray(0);
 
     // Another option would be using buffer mapping...
     //mesh.vertices = glMapBuffer(GL_ARRAY_BUFFER, GL_READ_WRITE);
@@ -2718,7 +4017,7 @@ void rlDrawMesh(Mesh mesh, Material material, Matrix transform)
 {
 #if defined(GRAPHICS_API_OPENGL_11)
     glEnable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, material.maps[MAP_DIFFUSE].texture.id);
+    StateBindTexture(GL_TEXTURE_2D, material.maps[MAP_DIFFUSE].texture.id);
 
     // NOTE: On OpenGL 1.1 we use Vertex Arrays to draw model
     glEnableClientState(GL_VERTEX_ARRAY);                   // Enable vertex array
@@ -2745,12 +4044,12 @@ void rlDrawMesh(Mesh mesh, Material material, Matrix transform)
     if (mesh.colors != NULL) glDisableClientState(GL_NORMAL_ARRAY);     // Disable colors array
 
     glDisable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    StateBindTexture(GL_TEXTURE_2D, 0);
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // Bind shader program
-    glUseProgram(material.shader.id);
+    StateUseProgram(material.shader.id);
 
     // Matrices and other values required by shader
     //-----------------------------------------------------
@@ -2759,17 +4058,19 @@ void rlDrawMesh(Mesh mesh, Material material, Matrix transform)
 
     // Upload to shader material.colDiffuse
     if (material.shader.locs[LOC_COLOR_DIFFUSE] != -1)
-        glUniform4f(material.shader.locs[LOC_COLOR_DIFFUSE], (float)material.maps[MAP_DIFFUSE].color.r/255.0f,
-                                                           (float)material.maps[MAP_DIFFUSE].color.g/255.0f,
-                                                           (float)material.maps[MAP_DIFFUSE].color.b/255.0f,
-                                                           (float)material.maps[MAP_DIFFUSE].color.a/255.0f);
+    {
+        float colDiffuse[4] = { (float)material.maps[MAP_DIFFUSE].color.r/255.0f, (float)material.maps[MAP_DIFFUSE].color.g/255.0f,
+                                (float)material.maps[MAP_DIFFUSE].color.b/255.0f, (float)material.maps[MAP_DIFFUSE].color.a/255.0f };
+        SetShaderUniform(material.shader.id, material.shader.locs[LOC_COLOR_DIFFUSE], colDiffuse, UNIFORM_VEC4, 1);
+    }
 
     // Upload to shader material.colSpecular (if available)
     if (material.shader.locs[LOC_COLOR_SPECULAR] != -1)
-        glUniform4f(material.shader.locs[LOC_COLOR_SPECULAR], (float)material.maps[MAP_SPECULAR].color.r/255.0f,
-                                                               (float)material.maps[MAP_SPECULAR].color.g/255.0f,
-                                                               (float)material.maps[MAP_SPECULAR].color.b/255.0f,
-                                                               (float)material.maps[MAP_SPECULAR].color.a/255.0f);
+    {
+        float colSpecular[4] = { (float)material.maps[MAP_SPECULAR].color.r/255.0f, (float)material.maps[MAP_SPECULAR].color.g/255.0f,
+                                 (float)material.maps[MAP_SPECULAR].color.b/255.0f, (float)material.maps[MAP_SPECULAR].color.a/255.0f };
+        SetShaderUniform(material.shader.id, material.shader.locs[LOC_COLOR_SPECULAR], colSpecular, UNIFORM_VEC4, 1);
+    }
 
     if (material.shader.locs[LOC_MATRIX_VIEW] != -1) SetShaderValueMatrix(material.shader, material.shader.locs[LOC_MATRIX_VIEW], RLGL.State.modelview);
     if (material.shader.locs[LOC_MATRIX_PROJECTION] != -1) SetShaderValueMatrix(material.shader, material.shader.locs[LOC_MATRIX_PROJECTION], RLGL.State.projection);
@@ -2793,16 +4094,16 @@ void rlDrawMesh(Mesh mesh, Material material, Matrix transform)
     {
         if (material.maps[i].texture.id > 0)
         {
-            glActiveTexture(GL_TEXTURE0 + i);
-            if ((i == MAP_IRRADIANCE) || (i == MAP_PREFILTER) || (i == MAP_CUBEMAP)) glBindTexture(GL_TEXTURE_CUBE_MAP, material.maps[i].texture.id);
-            else glBindTexture(GL_TEXTURE_2D, material.maps[i].texture.id);
+            StateActiveTexture(GL_TEXTURE0 + i);
+            if ((i == MAP_IRRADIANCE) || (i == MAP_PREFILTER) || (i == MAP_CUBEMAP)) StateBindTexture(GL_TEXTURE_CUBE_MAP, material.maps[i].texture.id);
+            else StateBindTexture(GL_TEXTURE_2D, material.maps[i].texture.id);
 
-            glUniform1i(material.shader.locs[LOC_MAP_DIFFUSE + i], i);
+            SetShaderUniform(material.shader.id, material.shader.locs[LOC_MAP_DIFFUSE + i], &i, UNIFORM_SAMPLER2D, 1);
         }
     }
 
     // Bind vertex array objects (or VBOs)
-    if (RLGL.ExtSupported.vao) glBindVertexArray(mesh.vaoId);
+    if (RLGL.ExtSupported.vao) StateBindVertexArray(mesh.vaoId);
     else
     {
         // Bind mesh VBO data: vertex position (shader-location = 0)
@@ -2876,132 +4177,228 @@ void rlDrawMesh(Mesh mesh, Material material, Matrix transform)
         Matrix matMVP = MatrixMultiply(RLGL.State.modelview, RLGL.State.projection);        // Transform to screen-space coordinates
 
         // Send combined model-view-projection matrix to shader
-        glUniformMatrix4fv(material.shader.locs[LOC_MATRIX_MVP], 1, false, MatrixToFloat(matMVP));
+        SetShaderValueMatrix(material.shader, material.shader.locs[LOC_MATRIX_MVP], matMVP);
 
         // Draw call!
         if (mesh.indices != NULL) glDrawElements(GL_TRIANGLES, mesh.triangleCount*3, GL_UNSIGNED_SHORT, 0); // Indexed vertices draw
         else glDrawArrays(GL_TRIANGLES, 0, mesh.vertexCount);
+
+        RLGL.State.frameStats.drawCalls++;
+        RLGL.State.frameStats.vertices += mesh.vertexCount;
     }
 
-    // Unbind all binded texture maps
-    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+    RLGL.State.frameStats.meshDraws++;
+
+    // NOTE: Texture maps, VAO and shader program are kept bound for next draw,
+    // state cache skips the redundant bindings when consecutive meshes share them
+    if (!RLGL.ExtSupported.vao)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        if (mesh.indices != NULL) glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    }
+
+    // Restore RLGL.State.projection/RLGL.State.modelview matrices
+    // NOTE: In stereo rendering matrices are being modified to fit every eye
+    RLGL.State.projection = matProjection;
+    RLGL.State.modelview = matView;
+#endif
+}
+
+// Draw a 3d mesh with material and transform
+// NOTE: Transforms are uploaded to an internal instance buffer (reused between calls),
+// bound to shader attribute location LOC_MATRIX_MODEL
+void rlDrawMeshInstanced(Mesh mesh, Material material, Matrix *transforms, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.State.instanceBuffer.vboId == 0)
     {
-        glActiveTexture(GL_TEXTURE0 + i);       // Set shader active texture
-        if ((i == MAP_IRRADIANCE) || (i == MAP_PREFILTER) || (i == MAP_CUBEMAP)) glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
-        else glBindTexture(GL_TEXTURE_2D, 0);   // Unbind current active texture
+        int attribLoc = material.shader.locs[LOC_MATRIX_MODEL];
+        int attribSize = 16;
+        RLGL.State.instanceBuffer = rlLoadInstanceBuffer(count, &attribLoc, &attribSize, 1);
     }
 
-    // Unind vertex array objects (or VBOs)
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
-    else
+    // Instances are put in LOC_MATRIX_MODEL attribute location with space for 4x Vector4, eg:
+    // layout (location = 12) in mat4 instance;
+    RLGL.State.instanceBuffer.attribLocs[0] = material.shader.locs[LOC_MATRIX_MODEL];
+
+    // NOTE: Instance buffer grows on update if required (storage allocated once with the new size)
+    if (count > RLGL.State.instanceTransformsCapacity)
     {
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
-        if (mesh.indices != NULL) glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        RL_FREE(RLGL.State.instanceTransforms);
+        RLGL.State.instanceTransforms = (float16 *)RL_MALLOC(count*sizeof(float16));
+        RLGL.State.instanceTransformsCapacity = count;
     }
 
-    // Unbind shader program
-    glUseProgram(0);
+    for (int i = 0; i < count; i++) RLGL.State.instanceTransforms[i] = MatrixToFloatV(transforms[i]);
 
-    // Restore RLGL.State.projection/RLGL.State.modelview matrices
-    // NOTE: In stereo rendering matrices are being modified to fit every eye
-    RLGL.State.projection = matProjection;
-    RLGL.State.modelview = matView;
+    rlUpdateInstanceBuffer(&RLGL.State.instanceBuffer, RLGL.State.instanceTransforms, count);
+    rlDrawMeshInstancedBuffer(mesh, material, RLGL.State.instanceBuffer);
 #endif
 }
 
-// Draw a 3d mesh with material and transform
-void rlDrawMeshInstanced(Mesh mesh, Material material, Matrix *transforms, int count)
+// Draw a 3d mesh with material and per-instance attributes buffer
+// NOTE: Instance attributes are read from instances.vboId (interleaved) with attribute divisor 1,
+// they are only enabled for this draw so mesh VAO keeps working for non-instanced drawing
+void rlDrawMeshInstancedBuffer(Mesh mesh, Material material, InstanceBuffer instances)
 {
 #if defined(GRAPHICS_API_OPENGL_33)
+    if ((instances.vboId == 0) || (instances.count <= 0)) return;
+
     // Bind shader program
-    glUseProgram(material.shader.id);
+    StateUseProgram(material.shader.id);
 
     // Upload to shader material.colDiffuse
     if (material.shader.locs[LOC_COLOR_DIFFUSE] != -1)
-        glUniform4f(material.shader.locs[LOC_COLOR_DIFFUSE], (float)material.maps[MAP_DIFFUSE].color.r/255.0f,
-                                                           (float)material.maps[MAP_DIFFUSE].color.g/255.0f,
-                                                           (float)material.maps[MAP_DIFFUSE].color.b/255.0f,
-                                                           (float)material.maps[MAP_DIFFUSE].color.a/255.0f);
+    {
+        float colDiffuse[4] = { (float)material.maps[MAP_DIFFUSE].color.r/255.0f, (float)material.maps[MAP_DIFFUSE].color.g/255.0f,
+                                (float)material.maps[MAP_DIFFUSE].color.b/255.0f, (float)material.maps[MAP_DIFFUSE].color.a/255.0f };
+        SetShaderUniform(material.shader.id, material.shader.locs[LOC_COLOR_DIFFUSE], colDiffuse, UNIFORM_VEC4, 1);
+    }
 
     // Upload to shader material.colSpecular (if available)
     if (material.shader.locs[LOC_COLOR_SPECULAR] != -1)
-        glUniform4f(material.shader.locs[LOC_COLOR_SPECULAR], (float)material.maps[MAP_SPECULAR].color.r/255.0f,
-                                                               (float)material.maps[MAP_SPECULAR].color.g/255.0f,
-                                                               (float)material.maps[MAP_SPECULAR].color.b/255.0f,
-                                                               (float)material.maps[MAP_SPECULAR].color.a/255.0f);
+    {
+        float colSpecular[4] = { (float)material.maps[MAP_SPECULAR].color.r/255.0f, (float)material.maps[MAP_SPECULAR].color.g/255.0f,
+                                 (float)material.maps[MAP_SPECULAR].color.b/255.0f, (float)material.maps[MAP_SPECULAR].color.a/255.0f };
+        SetShaderUniform(material.shader.id, material.shader.locs[LOC_COLOR_SPECULAR], colSpecular, UNIFORM_VEC4, 1);
+    }
 
     // Bind active texture maps (if available)
     for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
     {
         if (material.maps[i].texture.id > 0)
         {
-            glActiveTexture(GL_TEXTURE0 + i);
+            StateActiveTexture(GL_TEXTURE0 + i);
             if ((i == MAP_IRRADIANCE) || (i == MAP_PREFILTER) || (i == MAP_CUBEMAP))
-                glBindTexture(GL_TEXTURE_CUBE_MAP, material.maps[i].texture.id);
-            else glBindTexture(GL_TEXTURE_2D, material.maps[i].texture.id);
+                StateBindTexture(GL_TEXTURE_CUBE_MAP, material.maps[i].texture.id);
+            else StateBindTexture(GL_TEXTURE_2D, material.maps[i].texture.id);
 
-            glUniform1i(material.shader.locs[LOC_MAP_DIFFUSE + i], i);
+            SetShaderUniform(material.shader.id, material.shader.locs[LOC_MAP_DIFFUSE + i], &i, UNIFORM_SAMPLER2D, 1);
         }
     }
 
     // Bind vertex array objects (or VBOs)
-    glBindVertexArray(mesh.vaoId);
+    StateBindVertexArray(mesh.vaoId);
 
     // At this point the modelview matrix just contains the view matrix (camera)
     // For instanced shaders "mvp" is not premultiplied by any instance transform, only RLGL.State.transform
-    glUniformMatrix4fv(material.shader.locs[LOC_MATRIX_MVP], 1, false,
-                       MatrixToFloat(MatrixMultiply(MatrixMultiply(RLGL.State.transform, RLGL.State.modelview), RLGL.State.projection)));
+    SetShaderValueMatrix(material.shader, material.shader.locs[LOC_MATRIX_MVP], MatrixMultiply(MatrixMultiply(RLGL.State.transform, RLGL.State.modelview), RLGL.State.projection));
 
-    float16* instances = RL_MALLOC(count*sizeof(float16));
+    // Enable per-instance attributes, matrix attributes use 4 consecutive locations (one Vector4 each)
+    glBindBuffer(GL_ARRAY_BUFFER, instances.vboId);
 
-    for (int i = 0; i < count; i++) instances[i] = MatrixToFloatV(transforms[i]);
+    for (int i = 0, offset = 0; i < instances.attribsCount; i++)
+    {
+        int locsCount = (instances.attribSizes[i] == 16)? 4 : 1;
+        int size = (instances.attribSizes[i] == 16)? 4 : instances.attribSizes[i];
 
-    // This could alternatively use a static VBO and either glMapBuffer or glBufferSubData.
-    // It isn't clear which would be reliably faster in all cases and on all platforms, and
-    // anecdotally glMapBuffer seems very slow (syncs) while glBufferSubData seems no faster
-    // since we're transferring all the transform matrices anyway.
-    unsigned int instancesB = 0;
-    glGenBuffers(1, &instancesB);
-    glBindBuffer(GL_ARRAY_BUFFER, instancesB);
-    glBufferData(GL_ARRAY_BUFFER, count*sizeof(float16), instances, GL_STATIC_DRAW);
+        if (instances.attribLocs[i] != -1)
+        {
+            for (int j = 0; j < locsCount; j++)
+            {
+                glEnableVertexAttribArray(instances.attribLocs[i] + j);
+                glVertexAttribPointer(instances.attribLocs[i] + j, size, GL_FLOAT, GL_FALSE, instances.stride, (void *)(offset + j*size*sizeof(float)));
+                glVertexAttribDivisor(instances.attribLocs[i] + j, 1);
+            }
+        }
 
-    // Instances are put in LOC_MATRIX_MODEL attribute location with space for 4x Vector4, eg:
-    // layout (location = 12) in mat4 instance;
-    unsigned int instanceA = material.shader.locs[LOC_MATRIX_MODEL];
+        offset += instances.attribSizes[i]*sizeof(float);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // Draw call!
+    if (mesh.indices != NULL) glDrawElementsInstanced(GL_TRIANGLES, mesh.triangleCount*3, GL_UNSIGNED_SHORT, 0, instances.count);
+    else glDrawArraysInstanced(GL_TRIANGLES, 0, mesh.vertexCount, instances.count);
+
+    RLGL.State.frameStats.drawCalls++;
+    RLGL.State.frameStats.vertices += mesh.vertexCount*instances.count;
+    RLGL.State.frameStats.meshDraws++;
+
+    // Disable per-instance attributes
+    for (int i = 0; i < instances.attribsCount; i++)
+    {
+        if (instances.attribLocs[i] == -1) continue;
+
+        for (int j = 0; j < ((instances.attribSizes[i] == 16)? 4 : 1); j++)
+        {
+            glVertexAttribDivisor(instances.attribLocs[i] + j, 0);
+            glDisableVertexAttribArray(instances.attribLocs[i] + j);
+        }
+    }
+
+    // NOTE: Texture maps, VAO and shader program are kept bound for next draw (see rlDrawMesh())
+#endif
+}
 
-    for (unsigned int i = 0; i < 4; i++)
+// Load instance buffer (per-instance attributes)
+// NOTE: Attributes are interleaved in the order provided, every attribute is defined
+// by its shader location and its size in floats (1 to 4 or 16 for a matrix)
+InstanceBuffer rlLoadInstanceBuffer(int capacity, int *attribLocs, int *attribSizes, int attribsCount)
+{
+    InstanceBuffer buffer = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (capacity < 1) capacity = 1;
+
+    buffer.attribsCount = attribsCount;
+    buffer.attribLocs = (int *)RL_MALLOC(attribsCount*sizeof(int));
+    buffer.attribSizes = (int *)RL_MALLOC(attribsCount*sizeof(int));
+
+    for (int i = 0; i < attribsCount; i++)
     {
-        glEnableVertexAttribArray(instanceA+i);
-        glVertexAttribPointer(instanceA + i, 4, GL_FLOAT, GL_FALSE, sizeof(Matrix), (void *)(i*sizeof(Vector4)));
-        glVertexAttribDivisor(instanceA + i, 1);
+        buffer.attribLocs[i] = attribLocs[i];
+        buffer.attribSizes[i] = attribSizes[i];
+        buffer.stride += attribSizes[i]*sizeof(float);
     }
 
+    buffer.capacity = capacity;
+
+    glGenBuffers(1, &buffer.vboId);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer.vboId);
+    glBufferData(GL_ARRAY_BUFFER, buffer.capacity*buffer.stride, NULL, GL_STREAM_DRAW);
     glBindBuffer(GL_ARRAY_BUFFER, 0);
 
-    // Draw call!
-    if (mesh.indices != NULL) glDrawElementsInstanced(GL_TRIANGLES, mesh.triangleCount*3, GL_UNSIGNED_SHORT, 0, count);
-    else glDrawArraysInstanced(GL_TRIANGLES, 0, mesh.vertexCount, count);
+    TRACELOG(LOG_INFO, "VBO: [ID %i] Instance buffer loaded successfully (%i instances, %i bytes stride)", buffer.vboId, buffer.capacity, buffer.stride);
+#endif
 
-    glDeleteBuffers(1, &instancesB);
-    RL_FREE(instances);
+    return buffer;
+}
 
-    // Unbind all binded texture maps
-    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+// Update instance buffer data (grows buffer if required)
+// NOTE: Buffer storage is orphaned before updating, so previous instanced draws using it don't stall the update,
+// data can be NULL to just reserve space for count instances
+void rlUpdateInstanceBuffer(InstanceBuffer *buffer, const void *data, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId);
+
+    if (count > buffer->capacity)
     {
-        glActiveTexture(GL_TEXTURE0 + i);       // Set shader active texture
-        if ((i == MAP_IRRADIANCE) || (i == MAP_PREFILTER) || (i == MAP_CUBEMAP)) glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
-        else glBindTexture(GL_TEXTURE_2D, 0);   // Unbind current active texture
+        buffer->capacity = (count > 2*buffer->capacity)? count : 2*buffer->capacity;
+        TRACELOG(LOG_DEBUG, "VBO: [ID %i] Instance buffer resized to %i instances", buffer->vboId, buffer->capacity);
     }
 
-    // Unind vertex array objects (or VBOs)
-    glBindVertexArray(0);
+    glBufferData(GL_ARRAY_BUFFER, buffer->capacity*buffer->stride, NULL, GL_STREAM_DRAW);
+    if (data != NULL)
+    {
+        glBufferSubData(GL_ARRAY_BUFFER, 0, count*buffer->stride, data);
+        RLGL.State.frameStats.bytesUploaded += count*buffer->stride;
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
 
-    // Unbind shader program
-    glUseProgram(0);
+    buffer->count = count;
+#endif
+}
 
-#else
-    TRACELOG(LOG_WARNING, "VAO: Instanced rendering requires GRAPHICS_API_OPENGL_33");
+// Unload instance buffer from CPU and GPU
+void rlUnloadInstanceBuffer(InstanceBuffer buffer)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    glDeleteBuffers(1, &buffer.vboId);
 #endif
+    RL_FREE(buffer.attribLocs);
+    RL_FREE(buffer.attribSizes);
 }
 
 // Unload mesh data from CPU and GPU
@@ -3024,7 +4421,7 @@ void rlUnloadMesh(Mesh mesh)
     for (int i = 0; i < 7; i++) glDeleteBuffers(1, &mesh.vboId[i]); // DEFAULT_MESH_VERTEX_BUFFERS (model.c)
     if (RLGL.ExtSupported.vao)
     {
-        glBindVertexArray(0);
+        StateBindVertexArray(0);
         glDeleteVertexArrays(1, &mesh.vaoId);
         TRACELOG(LOG_INFO, "VAO: [ID %i] Unloaded vertex data from VRAM (GPU)", mesh.vaoId);
     }
@@ -3035,30 +4432,190 @@ void rlUnloadMesh(Mesh mesh)
 // Read screen pixel data (color buffer)
 unsigned char *rlReadScreenPixels(int width, int height)
 {
-    unsigned char *screenData = (unsigned char *)RL_CALLOC(width*height*4, sizeof(unsigned char));
+    unsigned char *imgData = (unsigned char *)RL_MALLOC(width*height*4*sizeof(unsigned char));
 
     // NOTE 1: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
     // NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
-    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, screenData);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, imgData);
 
-    // Flip image vertically!
-    unsigned char *imgData = (unsigned char *)RL_MALLOC(width*height*4*sizeof(unsigned char));
+    // Flip image vertically in place, swapping lines
+    unsigned char *line = (unsigned char *)RL_MALLOC(width*4*sizeof(unsigned char));
 
-    for (int y = height - 1; y >= 0; y--)
+    for (int y = 0; y < height/2; y++)
     {
-        for (int x = 0; x < (width*4); x++)
+        unsigned char *top = imgData + y*width*4;
+        unsigned char *bottom = imgData + ((height - 1) - y)*width*4;
+
+        memcpy(line, top, width*4);
+        memcpy(top, bottom, width*4);
+        memcpy(bottom, line, width*4);
+    }
+
+    RL_FREE(line);
+
+    // Set alpha component value to 255 (no trasparent image retrieval)
+    // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
+    for (int i = 3; i < width*height*4; i += 4) imgData[i] = 255;
+
+    return imgData;     // NOTE: image data should be freed
+}
+
+// Request screen pixel data read (color buffer), returns readback id (0 if no readback available)
+// NOTE: Pixels data is retrieved with rlGetReadPixels() as provided by glReadPixels(): bottom-up lines
+// and framebuffer alpha, on OpenGL 3.3 data is copied to a pixel pack buffer without stalling the pipeline
+int rlReadScreenPixelsAsync(int width, int height)
+{
+    int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    id = BeginReadback(width*height*4);
+
+    if (id > 0)
+    {
+        ReadbackBuffer *readback = &RLGL.State.readbacks[id - 1];
+
+        rlglDraw();     // Draw pending batch data before reading framebuffer
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    #if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+        glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, (void *)0);   // Data copied to pixel pack buffer (offset 0)
+    #else
+        glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, readback->data);
+    #endif
+        EndReadback(readback);
+    }
+#endif
+
+    return id;
+}
+
+// Request texture pixel data read, returns readback id (0 if no readback available or format not supported)
+// NOTE: Pixels data is retrieved with rlGetReadPixels() in texture format, on OpenGL ES 2.0 data is
+// always RGBA (read from framebuffer attachment) and it is read synchronously, like on OpenGL 2.1
+int rlReadTexturePixelsAsync(Texture2D texture)
+{
+    int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (texture.format >= COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", texture.id, texture.format);
+        return id;
+    }
+
+    #if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(texture.format, &glInternalFormat, &glFormat, &glType);
+
+    if (glInternalFormat == (unsigned int)-1) return id;
+
+    id = BeginReadback(GetPixelDataSize(texture.width, texture.height, texture.format));
+
+    if (id > 0)
+    {
+        StateBindTexture(GL_TEXTURE_2D, texture.id);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glGetTexImage(GL_TEXTURE_2D, 0, glFormat, glType, (void *)0);             // Data copied to pixel pack buffer (offset 0)
+        StateBindTexture(GL_TEXTURE_2D, 0);
+
+        EndReadback(&RLGL.State.readbacks[id - 1]);
+    }
+    #else
+    id = BeginReadback(0);
+
+    if (id > 0)
+    {
+        ReadbackBuffer *readback = &RLGL.State.readbacks[id - 1];
+
+        readback->data = rlReadTexturePixels(texture);
+
+        if (readback->data == NULL)
+        {
+            readback->active = false;
+            id = 0;
+        }
+    }
+    #endif
+#endif
+
+    return id;
+}
+
+// Check if readback pixel data can be retrieved without stall
+bool rlIsReadPixelsReady(int readback)
+{
+    bool ready = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((readback > 0) && (readback <= MAX_READBACK_BUFFERS) && RLGL.State.readbacks[readback - 1].active)
+    {
+        ready = true;
+
+    #if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+        ReadbackBuffer *buffer = &RLGL.State.readbacks[readback - 1];
+
+        if (buffer->fence != NULL)
         {
-            imgData[((height - 1) - y)*width*4 + x] = screenData[(y*width*4) + x];  // Flip line
+            // NOTE: Commands are flushed to make sure fence is signaled at some point
+            GLenum result = glClientWaitSync((GLsync)buffer->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
 
-            // Set alpha component value to 255 (no trasparent image retrieval)
-            // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
-            if (((x + 1)%4) == 0) imgData[((height - 1) - y)*width*4 + x] = 255;
+            if ((result == GL_ALREADY_SIGNALED) || (result == GL_CONDITION_SATISFIED))
+            {
+                glDeleteSync((GLsync)buffer->fence);
+                buffer->fence = NULL;
+            }
+            else ready = false;
         }
+    #endif
     }
+#endif
 
-    RL_FREE(screenData);
+    return ready;
+}
 
-    return imgData;     // NOTE: image data should be freed
+// Get readback pixel data, readback is released
+// NOTE: If pixel data is not ready yet, function stalls (waiting on readback fence) until GPU copy is completed
+void *rlGetReadPixels(int readback)
+{
+    void *pixels = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((readback > 0) && (readback <= MAX_READBACK_BUFFERS) && RLGL.State.readbacks[readback - 1].active)
+    {
+        ReadbackBuffer *buffer = &RLGL.State.readbacks[readback - 1];
+
+    #if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+        if (buffer->fence != NULL)
+        {
+            // NOTE: Commands are flushed so fence is signaled, calling thread sleeps until then (no timeout)
+            glClientWaitSync((GLsync)buffer->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0xFFFFFFFFFFFFFFFFull);
+            glDeleteSync((GLsync)buffer->fence);
+            buffer->fence = NULL;
+        }
+
+        // NOTE: Mapping waits for the GPU copy if not completed yet
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer->pboId);
+        void *data = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, buffer->dataSize, GL_MAP_READ_BIT);
+
+        if (data != NULL)
+        {
+            pixels = RL_MALLOC(buffer->dataSize);
+            memcpy(pixels, data, buffer->dataSize);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        else TRACELOG(LOG_WARNING, "GL: Failed to map pixel pack buffer [ID %i]", buffer->pboId);
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    #else
+        pixels = buffer->data;
+        buffer->data = NULL;
+    #endif
+
+        buffer->active = false;
+    }
+#endif
+
+    return pixels;
 }
 
 // Read texture pixel data
@@ -3067,7 +4624,7 @@ void *rlReadTexturePixels(Texture2D texture)
     void *pixels = NULL;
 
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    glBindTexture(GL_TEXTURE_2D, texture.id);
+    StateBindTexture(GL_TEXTURE_2D, texture.id);
 
     // NOTE: Using texture.id, we can retrieve some texture info (but not on OpenGL ES 2.0)
     // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
@@ -3093,7 +4650,7 @@ void *rlReadTexturePixels(Texture2D texture)
     }
     else TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", texture.id, texture.format);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    StateBindTexture(GL_TEXTURE_2D, 0);
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_ES2)
@@ -3109,7 +4666,7 @@ void *rlReadTexturePixels(Texture2D texture)
     // TODO: Create depth texture/renderbuffer for fbo?
 
     glBindFramebuffer(GL_FRAMEBUFFER, fboId);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    StateBindTexture(GL_TEXTURE_2D, 0);
 
     // Attach our texture to FBO
     glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture.id, 0);
@@ -3286,6 +4843,9 @@ void UnloadShader(Shader shader)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (shader.id != RLGL.State.defaultShader.id)
     {
+        // NOTE: A deleted program in use stays in use until changed, id could be reused by a new program
+        if (RLGL.Cache.program == shader.id) RLGL.Cache.program = 0xFFFFFFFF;
+        UnloadShaderUniforms(shader.id);
         glDeleteProgram(shader.id);
         RL_FREE(shader.locs);
 
@@ -3300,7 +4860,7 @@ void BeginShaderMode(Shader shader)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.State.currentShader.id != shader.id)
     {
-        DrawRenderBatch(RLGL.currentBatch);
+        rlDrawRenderBatch(RLGL.currentBatch);
         RLGL.State.currentShader = shader;
     }
 #endif
@@ -3347,26 +4907,12 @@ void SetShaderValue(Shader shader, int uniformLoc, const void *value, int unifor
 }
 
 // Set shader uniform value vector
+// NOTE: Values are cached per shader, unchanged values are not uploaded again and values for
+// a shader not in use are uploaded when the shader is used for drawing (no program switch required)
 void SetShaderValueV(Shader shader, int uniformLoc, const void *value, int uniformType, int count)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glUseProgram(shader.id);
-
-    switch (uniformType)
-    {
-        case UNIFORM_FLOAT: glUniform1fv(uniformLoc, count, (float *)value); break;
-        case UNIFORM_VEC2: glUniform2fv(uniformLoc, count, (float *)value); break;
-        case UNIFORM_VEC3: glUniform3fv(uniformLoc, count, (float *)value); break;
-        case UNIFORM_VEC4: glUniform4fv(uniformLoc, count, (float *)value); break;
-        case UNIFORM_INT: glUniform1iv(uniformLoc, count, (int *)value); break;
-        case UNIFORM_IVEC2: glUniform2iv(uniformLoc, count, (int *)value); break;
-        case UNIFORM_IVEC3: glUniform3iv(uniformLoc, count, (int *)value); break;
-        case UNIFORM_IVEC4: glUniform4iv(uniformLoc, count, (int *)value); break;
-        case UNIFORM_SAMPLER2D: glUniform1iv(uniformLoc, count, (int *)value); break;
-        default: TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to set uniform, data type not recognized", shader.id);
-    }
-
-    //glUseProgram(0);      // Avoid reseting current shader program, in case other uniforms are set
+    SetShaderUniform(shader.id, uniformLoc, value, uniformType, count);
 #endif
 }
 
@@ -3375,11 +4921,8 @@ void SetShaderValueV(Shader shader, int uniformLoc, const void *value, int unifo
 void SetShaderValueMatrix(Shader shader, int uniformLoc, Matrix mat)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glUseProgram(shader.id);
-
-    glUniformMatrix4fv(uniformLoc, 1, false, MatrixToFloat(mat));
-
-    //glUseProgram(0);
+    float16 matValue = MatrixToFloatV(mat);
+    SetShaderUniform(shader.id, uniformLoc, matValue.v, UNIFORM_MATRIX, 1);
 #endif
 }
 
@@ -3387,18 +4930,23 @@ void SetShaderValueMatrix(Shader shader, int uniformLoc, Matrix mat)
 void SetShaderValueTexture(Shader shader, int uniformLoc, Texture2D texture)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glUseProgram(shader.id);
-
     // Check if texture is already active
     for (int i = 0; i < MAX_BATCH_ACTIVE_TEXTURES; i++) if (RLGL.State.activeTextureId[i] == texture.id) return;
 
+    // All active textures slots in use, pending batch data is drawn with current ones to free them
+    if ((RLGL.State.activeTextureId[MAX_BATCH_ACTIVE_TEXTURES - 1] > 0) && !RLGL.currentBatch->retained)
+    {
+        FlushRenderBatch(RL_FLUSH_TEXTURE_CHANGE);
+    }
+
     // Register a new active texture for the internal batch system
     // NOTE: Default texture is always activated as GL_TEXTURE0
     for (int i = 0; i < MAX_BATCH_ACTIVE_TEXTURES; i++)
     {
         if (RLGL.State.activeTextureId[i] == 0)
         {
-            glUniform1i(uniformLoc, 1 + i);             // Activate new texture unit
+            int unit = 1 + i;
+            SetShaderUniform(shader.id, uniformLoc, &unit, UNIFORM_SAMPLER2D, 1);   // Activate new texture unit
             RLGL.State.activeTextureId[i] = texture.id; // Save texture id for binding on drawing
             break;
         }
@@ -3498,8 +5046,8 @@ TextureCubemap GenTextureCubemap(Shader shader, Texture2D panorama, int size, in
 
     rlEnableShader(shader.id);
 #if !defined(GENTEXTURECUBEMAP_USE_BATCH_SYSTEM)
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, panorama.id);
+    StateActiveTexture(GL_TEXTURE0);
+    StateBindTexture(GL_TEXTURE_2D, panorama.id);
 #endif
 
     rlViewport(0, 0, size, size);   // Set viewport to current fbo dimensions
@@ -3520,7 +5068,7 @@ TextureCubemap GenTextureCubemap(Shader shader, Texture2D panorama, int size, in
         // Using internal batch system instead of raw OpenGL cube creating+drawing
         // NOTE: DrawCubeV() is actually provided by models.c! -> GenTextureCubemap() should be moved to user code!
         DrawCubeV(Vector3Zero(), Vector3One(), WHITE);
-        DrawRenderBatch(RLGL.currentBatch);
+        rlDrawRenderBatch(RLGL.currentBatch);
 #endif
     }
     //------------------------------------------------------------------------------------------
@@ -3582,8 +5130,8 @@ TextureCubemap GenTextureIrradiance(Shader shader, TextureCubemap cubemap, int s
     };
 
     rlEnableShader(shader.id);
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, cubemap.id);
+    StateActiveTexture(GL_TEXTURE0);
+    StateBindTexture(GL_TEXTURE_CUBE_MAP, cubemap.id);
 
     rlViewport(0, 0, size, size);   // Set viewport to current fbo dimensions
 
@@ -3659,8 +5207,8 @@ TextureCubemap GenTexturePrefilter(Shader shader, TextureCubemap cubemap, int si
     };
 
     rlEnableShader(shader.id);
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, cubemap.id);
+    StateActiveTexture(GL_TEXTURE0);
+    StateBindTexture(GL_TEXTURE_CUBE_MAP, cubemap.id);
 
     // TODO: Locations should be taken out of this function... too shader dependant...
     int roughnessLoc = GetShaderLocation(shader, "roughness");
@@ -3681,7 +5229,7 @@ TextureCubemap GenTexturePrefilter(Shader shader, TextureCubemap cubemap, int si
         glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, mipWidth, mipHeight);
 
         float roughness = (float)mip/(float)(MAX_MIPMAP_LEVELS - 1);
-        glUniform1f(roughnessLoc, roughness);
+        SetShaderUniform(shader.id, roughnessLoc, &roughness, UNIFORM_FLOAT, 1);
 
         for (int i = 0; i < 6; i++)
         {
@@ -3771,7 +5319,7 @@ void BeginBlendMode(int mode)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.State.currentBlendMode != mode)
     {
-        DrawRenderBatch(RLGL.currentBatch);
+        rlDrawRenderBatch(RLGL.currentBatch);
 
         switch (mode)
         {
@@ -3785,7 +5333,9 @@ void BeginBlendMode(int mode)
         }
 
         RLGL.State.currentBlendMode = mode;
+        RLGL.Cache.stats.stateCalls++;
     }
+    else RLGL.Cache.stats.stateSkipped++;
 #endif
 }
 
@@ -3991,646 +5541,1021 @@ void EndVrDrawing(void)
         rlMatrixMode(RL_MODELVIEW);                             // Enable internal modelview matrix
         rlLoadIdentity();                                       // Reset internal modelview matrix
 
-        // Draw stereo framebuffer texture using distortion shader if available
-        if (RLGL.Vr.config.distortionShader.id > 0) RLGL.State.currentShader = RLGL.Vr.config.distortionShader;
-        else RLGL.State.currentShader = GetShaderDefault();
+        // Draw stereo framebuffer texture using distortion shader if available
+        if (RLGL.Vr.config.distortionShader.id > 0) RLGL.State.currentShader = RLGL.Vr.config.distortionShader;
+        else RLGL.State.currentShader = GetShaderDefault();
+
+        rlEnableTexture(RLGL.Vr.stereoTexId);
+
+        rlPushMatrix();
+            rlBegin(RL_QUADS);
+                rlColor4ub(255, 255, 255, 255);
+                rlNormal3f(0.0f, 0.0f, 1.0f);
+
+                // Bottom-left corner for texture and quad
+                rlTexCoord2f(0.0f, 1.0f);
+                rlVertex2f(0.0f, 0.0f);
+
+                // Bottom-right corner for texture and quad
+                rlTexCoord2f(0.0f, 0.0f);
+                rlVertex2f(0.0f, (float)RLGL.State.framebufferHeight);
+
+                // Top-right corner for texture and quad
+                rlTexCoord2f(1.0f, 0.0f);
+                rlVertex2f((float)RLGL.State.framebufferWidth, (float)RLGL.State.framebufferHeight);
+
+                // Top-left corner for texture and quad
+                rlTexCoord2f(1.0f, 1.0f);
+                rlVertex2f((float)RLGL.State.framebufferWidth, 0.0f);
+            rlEnd();
+        rlPopMatrix();
+
+        rlDisableTexture();
+
+        // Update and draw render texture fbo with distortion to backbuffer
+        rlDrawRenderBatch(RLGL.currentBatch);
+
+        // Restore RLGL.State.defaultShader
+        RLGL.State.currentShader = RLGL.State.defaultShader;
+
+        // Reset viewport and default projection-modelview matrices
+        rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
+        RLGL.State.projection = MatrixOrtho(0.0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight, 0.0, 0.0, 1.0);
+        RLGL.State.modelview = MatrixIdentity();
+
+        rlDisableDepthTest();
+    }
+#endif
+}
+#endif          // SUPPORT_VR_SIMULATOR
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+// Bind texture to active unit (skipped if already bound)
+static void StateBindTexture(unsigned int target, unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned int *bound = NULL;
+    int unit = RLGL.Cache.activeTextureUnit;
+
+    if ((unit >= 0) && (unit < MAX_STATE_TEXTURE_UNITS))
+    {
+        if (target == GL_TEXTURE_2D) bound = &RLGL.Cache.textures[unit];
+        else if (target == GL_TEXTURE_CUBE_MAP) bound = &RLGL.Cache.cubemaps[unit];
+    }
+
+    if ((bound != NULL) && (*bound == id))
+    {
+        RLGL.Cache.stats.textureSkipped++;
+        return;
+    }
+
+    glBindTexture(target, id);
+    RLGL.Cache.stats.textureCalls++;
+    RLGL.State.frameStats.textureBinds++;
+
+    if (bound != NULL) *bound = id;
+#else
+    glBindTexture(target, id);
+#endif
+}
+
+// Enable/disable capability (skipped if already set)
+static void StateSetCapability(unsigned int cap, bool enabled)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int *state = NULL;
+
+    switch (cap)
+    {
+        case GL_BLEND: state = &RLGL.Cache.blend; break;
+        case GL_DEPTH_TEST: state = &RLGL.Cache.depthTest; break;
+        case GL_CULL_FACE: state = &RLGL.Cache.cullFace; break;
+        case GL_SCISSOR_TEST: state = &RLGL.Cache.scissorTest; break;
+        default: break;
+    }
+
+    if ((state != NULL) && (*state == (int)enabled))
+    {
+        RLGL.Cache.stats.stateSkipped++;
+        return;
+    }
+
+    if (enabled) glEnable(cap);
+    else glDisable(cap);
+    RLGL.Cache.stats.stateCalls++;
+
+    if (state != NULL) *state = (int)enabled;
+#else
+    if (enabled) glEnable(cap);
+    else glDisable(cap);
+#endif
+}
+
+// Enable/disable depth buffer writing (skipped if already set)
+static void StateDepthMask(bool enabled)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.Cache.depthMask == (int)enabled)
+    {
+        RLGL.Cache.stats.stateSkipped++;
+        return;
+    }
+
+    glDepthMask(enabled? GL_TRUE : GL_FALSE);
+    RLGL.Cache.stats.stateCalls++;
+
+    RLGL.Cache.depthMask = (int)enabled;
+#else
+    glDepthMask(enabled? GL_TRUE : GL_FALSE);
+#endif
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Use shader program (skipped if already in use)
+// NOTE: Uniform values set while the shader was not in use are uploaded now
+static void StateUseProgram(unsigned int id)
+{
+    if (RLGL.Cache.program == id) RLGL.Cache.stats.programSkipped++;
+    else
+    {
+        glUseProgram(id);
+        RLGL.Cache.program = id;
+        RLGL.Cache.stats.programCalls++;
+        RLGL.State.frameStats.shaderSwitches++;
+
+        FlushShaderUniforms(id);
+    }
+}
+
+// Bind vertex array object (skipped if already bound)
+static void StateBindVertexArray(unsigned int id)
+{
+    if (RLGL.Cache.vertexArray == id) RLGL.Cache.stats.vertexArraySkipped++;
+    else
+    {
+        glBindVertexArray(id);
+        RLGL.Cache.vertexArray = id;
+        RLGL.Cache.stats.vertexArrayCalls++;
+    }
+}
 
-        rlEnableTexture(RLGL.Vr.stereoTexId);
+// Set active texture unit (skipped if already active)
+// NOTE: Unit is provided as GL_TEXTURE0 + index (same as glActiveTexture())
+static void StateActiveTexture(unsigned int unit)
+{
+    if (RLGL.Cache.activeTextureUnit == (int)(unit - GL_TEXTURE0)) RLGL.Cache.stats.textureSkipped++;
+    else
+    {
+        glActiveTexture(unit);
+        RLGL.Cache.activeTextureUnit = (int)(unit - GL_TEXTURE0);
+        RLGL.Cache.stats.textureCalls++;
+    }
+}
 
-        rlPushMatrix();
-            rlBegin(RL_QUADS);
-                rlColor4ub(255, 255, 255, 255);
-                rlNormal3f(0.0f, 0.0f, 1.0f);
+// Forget texture bindings on texture unload
+// NOTE: OpenGL unbinds deleted textures (binding reverts to 0) and ids could be reused later
+static void StateForgetTexture(unsigned int id)
+{
+    for (int i = 0; i < MAX_STATE_TEXTURE_UNITS; i++)
+    {
+        if (RLGL.Cache.textures[i] == id) RLGL.Cache.textures[i] = 0;
+        if (RLGL.Cache.cubemaps[i] == id) RLGL.Cache.cubemaps[i] = 0;
+    }
+}
 
-                // Bottom-left corner for texture and quad
-                rlTexCoord2f(0.0f, 1.0f);
-                rlVertex2f(0.0f, 0.0f);
+// Set shader uniform value (cached)
+// NOTE: Value is compared with the last one set, it's uploaded only if changed and
+// only when shader is in use, otherwise it's kept pending until shader is used (StateUseProgram())
+static void SetShaderUniform(unsigned int shaderId, int location, const void *value, int type, int count)
+{
+    if (location < 0) return;
 
-                // Bottom-right corner for texture and quad
-                rlTexCoord2f(0.0f, 0.0f);
-                rlVertex2f(0.0f, (float)RLGL.State.framebufferHeight);
+    int size = 0;
+    switch (type)
+    {
+        case UNIFORM_FLOAT: size = sizeof(float); break;
+        case UNIFORM_VEC2: size = 2*sizeof(float); break;
+        case UNIFORM_VEC3: size = 3*sizeof(float); break;
+        case UNIFORM_VEC4: size = 4*sizeof(float); break;
+        case UNIFORM_INT: size = sizeof(int); break;
+        case UNIFORM_IVEC2: size = 2*sizeof(int); break;
+        case UNIFORM_IVEC3: size = 3*sizeof(int); break;
+        case UNIFORM_IVEC4: size = 4*sizeof(int); break;
+        case UNIFORM_SAMPLER2D: size = sizeof(int); break;
+        case UNIFORM_MATRIX: size = 16*sizeof(float); break;
+        default: TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to set uniform, data type not recognized", shaderId); return;
+    }
+    size *= count;
 
-                // Top-right corner for texture and quad
-                rlTexCoord2f(1.0f, 0.0f);
-                rlVertex2f((float)RLGL.State.framebufferWidth, (float)RLGL.State.framebufferHeight);
+    // Get shader uniforms store (created on first use)
+    ShaderUniformStore *store = NULL;
+    for (int i = 0; i < RLGL.State.uniformStoresCount; i++)
+    {
+        if (RLGL.State.uniformStores[i].shaderId == shaderId) { store = &RLGL.State.uniformStores[i]; break; }
+    }
 
-                // Top-left corner for texture and quad
-                rlTexCoord2f(1.0f, 1.0f);
-                rlVertex2f((float)RLGL.State.framebufferWidth, 0.0f);
-            rlEnd();
-        rlPopMatrix();
+    if (store == NULL)
+    {
+        RLGL.State.uniformStores = (ShaderUniformStore *)RL_REALLOC(RLGL.State.uniformStores, (RLGL.State.uniformStoresCount + 1)*sizeof(ShaderUniformStore));
+        store = &RLGL.State.uniformStores[RLGL.State.uniformStoresCount];
+        memset(store, 0, sizeof(ShaderUniformStore));
+        store->shaderId = shaderId;
+        RLGL.State.uniformStoresCount++;
+    }
 
-        rlDisableTexture();
+    // Get uniform value (created on first use)
+    ShaderUniformValue *uniform = NULL;
+    for (int i = 0; i < store->count; i++)
+    {
+        if (store->values[i].location == location) { uniform = &store->values[i]; break; }
+    }
 
-        // Update and draw render texture fbo with distortion to backbuffer
-        DrawRenderBatch(RLGL.currentBatch);
+    if (uniform == NULL)
+    {
+        if (store->count >= store->capacity)
+        {
+            store->capacity = (store->capacity == 0)? 8 : 2*store->capacity;
+            store->values = (ShaderUniformValue *)RL_REALLOC(store->values, store->capacity*sizeof(ShaderUniformValue));
+        }
 
-        // Restore RLGL.State.defaultShader
-        RLGL.State.currentShader = RLGL.State.defaultShader;
+        uniform = &store->values[store->count];
+        memset(uniform, 0, sizeof(ShaderUniformValue));
+        uniform->location = location;
+        store->count++;
+    }
+    else if ((uniform->type == type) && (uniform->count == count) && (memcmp(uniform->data, value, size) == 0))
+    {
+        RLGL.Cache.stats.uniformSkipped++;
+        return;
+    }
 
-        // Reset viewport and default projection-modelview matrices
-        rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
-        RLGL.State.projection = MatrixOrtho(0.0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight, 0.0, 0.0, 1.0);
-        RLGL.State.modelview = MatrixIdentity();
+    if (uniform->size != size) uniform->data = (unsigned char *)RL_REALLOC(uniform->data, size);
 
-        rlDisableDepthTest();
+    uniform->type = type;
+    uniform->count = count;
+    uniform->size = size;
+    memcpy(uniform->data, value, size);
+
+    if (RLGL.Cache.program == shaderId)
+    {
+        UploadShaderUniform(uniform);
+        uniform->dirty = false;
+    }
+    else
+    {
+        uniform->dirty = true;
+        store->dirty = true;
     }
-#endif
 }
-#endif          // SUPPORT_VR_SIMULATOR
-
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-// Compile custom shader and return shader id
-static unsigned int CompileShader(const char *shaderStr, int type)
+// Upload shader uniform value to GPU
+static void UploadShaderUniform(const ShaderUniformValue *uniform)
 {
-    unsigned int shader = glCreateShader(type);
-    glShaderSource(shader, 1, &shaderStr, NULL);
+    switch (uniform->type)
+    {
+        case UNIFORM_FLOAT: glUniform1fv(uniform->location, uniform->count, (float *)uniform->data); break;
+        case UNIFORM_VEC2: glUniform2fv(uniform->location, uniform->count, (float *)uniform->data); break;
+        case UNIFORM_VEC3: glUniform3fv(uniform->location, uniform->count, (float *)uniform->data); break;
+        case UNIFORM_VEC4: glUniform4fv(uniform->location, uniform->count, (float *)uniform->data); break;
+        case UNIFORM_INT: glUniform1iv(uniform->location, uniform->count, (int *)uniform->data); break;
+        case UNIFORM_IVEC2: glUniform2iv(uniform->location, uniform->count, (int *)uniform->data); break;
+        case UNIFORM_IVEC3: glUniform3iv(uniform->location, uniform->count, (int *)uniform->data); break;
+        case UNIFORM_IVEC4: glUniform4iv(uniform->location, uniform->count, (int *)uniform->data); break;
+        case UNIFORM_SAMPLER2D: glUniform1iv(uniform->location, uniform->count, (int *)uniform->data); break;
+        case UNIFORM_MATRIX: glUniformMatrix4fv(uniform->location, uniform->count, false, (float *)uniform->data); break;
+        default: break;
+    }
 
-    GLint success = 0;
-    glCompileShader(shader);
-    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    RLGL.Cache.stats.uniformCalls++;
+}
 
-    if (success != GL_TRUE)
+// Upload shader uniform values pending (shader must be in use)
+static void FlushShaderUniforms(unsigned int shaderId)
+{
+    for (int i = 0; i < RLGL.State.uniformStoresCount; i++)
     {
-        TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to compile shader code", shader);
-        int maxLength = 0;
-        int length;
-        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
+        ShaderUniformStore *store = &RLGL.State.uniformStores[i];
 
-#if defined(_MSC_VER)
-        char *log = RL_MALLOC(maxLength);
-#else
-        char log[maxLength];
-#endif
-        glGetShaderInfoLog(shader, maxLength, &length, log);
+        if (store->shaderId == shaderId)
+        {
+            if (store->dirty)
+            {
+                for (int j = 0; j < store->count; j++)
+                {
+                    if (store->values[j].dirty)
+                    {
+                        UploadShaderUniform(&store->values[j]);
+                        store->values[j].dirty = false;
+                    }
+                }
 
-        TRACELOG(LOG_WARNING, "SHADER: [ID %i] Compile error: %s", shader, log);
+                store->dirty = false;
+            }
 
-#if defined(_MSC_VER)
-        RL_FREE(log);
-#endif
+            break;
+        }
     }
-    else TRACELOG(LOG_INFO, "SHADER: [ID %i] Compiled successfully", shader);
-
-    return shader;
 }
 
-// Load custom shader strings and return program id
-static unsigned int LoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
+// Unload shader uniforms shadow store
+static void UnloadShaderUniforms(unsigned int shaderId)
 {
-    unsigned int program = 0;
+    for (int i = 0; i < RLGL.State.uniformStoresCount; i++)
+    {
+        if (RLGL.State.uniformStores[i].shaderId == shaderId)
+        {
+            for (int j = 0; j < RLGL.State.uniformStores[i].count; j++) RL_FREE(RLGL.State.uniformStores[i].values[j].data);
+            RL_FREE(RLGL.State.uniformStores[i].values);
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    GLint success = 0;
-    program = glCreateProgram();
+            // Move last store to the freed position
+            RLGL.State.uniformStores[i] = RLGL.State.uniformStores[RLGL.State.uniformStoresCount - 1];
+            RLGL.State.uniformStoresCount--;
+            break;
+        }
+    }
+}
 
-    glAttachShader(program, vShaderId);
-    glAttachShader(program, fShaderId);
+// Begin pixels readback, returns readback id (0 if all readbacks are pending)
+// NOTE: On OpenGL 3.3 the readback pixel pack buffer is left bound (grown if required),
+// pixels data buffer is allocated otherwise (if size provided)
+static int BeginReadback(int size)
+{
+    int id = 0;
 
-    // NOTE: Default attribute shader locations must be binded before linking
-    glBindAttribLocation(program, 0, DEFAULT_SHADER_ATTRIB_NAME_POSITION);
-    glBindAttribLocation(program, 1, DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
-    glBindAttribLocation(program, 2, DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
-    glBindAttribLocation(program, 3, DEFAULT_SHADER_ATTRIB_NAME_COLOR);
-    glBindAttribLocation(program, 4, DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
-    glBindAttribLocation(program, 5, DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+    for (int i = 0; i < MAX_READBACK_BUFFERS; i++)
+    {
+        if (!RLGL.State.readbacks[i].active) { id = i + 1; break; }
+    }
 
-    // NOTE: If some attrib name is no found on the shader, it locations becomes -1
+    if (id == 0)
+    {
+        TRACELOG(LOG_WARNING, "GL: Pixels readbacks limit reached (%i), retrieve pending readbacks", MAX_READBACK_BUFFERS);
+        return id;
+    }
 
-    glLinkProgram(program);
+    ReadbackBuffer *readback = &RLGL.State.readbacks[id - 1];
 
-    // NOTE: All uniform variables are intitialised to 0 when a program links
+    readback->active = true;
+    readback->dataSize = size;
 
-    glGetProgramiv(program, GL_LINK_STATUS, &success);
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    if (readback->pboId == 0) glGenBuffers(1, &readback->pboId);
 
-    if (success == GL_FALSE)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, readback->pboId);
+
+    if (readback->pboSize < size)
     {
-        TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to link shader program", program);
+        glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+        readback->pboSize = size;
+    }
+#else
+    if (size > 0) readback->data = RL_MALLOC(size);
+#endif
 
-        int maxLength = 0;
-        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
-        
-        if (maxLength > 0) 
-        {
-            int length;
-            char *log = RL_CALLOC(maxLength, sizeof(char));
-            glGetProgramInfoLog(program, maxLength, &length, log);
-            TRACELOG(LOG_WARNING, "SHADER: [ID %i] Link error: %s", program, log);
-            RL_FREE(log);
-        }
+    return id;
+}
 
-        glDeleteProgram(program);
+// End pixels readback
+static void EndReadback(ReadbackBuffer *readback)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
 
-        program = 0;
-    }
-    else TRACELOG(LOG_INFO, "SHADER: [ID %i] Program loaded successfully", program);
+    // Insert a fence to know when GPU has finished copying pixels to pixel pack buffer
+    readback->fence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
 #endif
-    return program;
 }
+#endif
 
 
-// Load default shader (just vertex positioning and texture coloring)
-// NOTE: This shader program is used for internal buffers
-static Shader LoadShaderDefault(void)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Get transform matrix to be stored in new draw calls
+// NOTE: Only per-draw transform mode stores current transform, vertex are already transformed on CPU otherwise
+static Matrix GetDrawTransform(void)
 {
-    Shader shader = { 0 };
-    shader.locs = (int *)RL_CALLOC(MAX_SHADER_LOCATIONS, sizeof(int));
+    if (RLGL.State.drawTransform && RLGL.State.transformRequired) return RLGL.State.transform;
+    else return MatrixIdentity();
+}
 
-    // NOTE: All locations must be reseted to -1 (no location)
-    for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+// Set render batch vertex buffer attributes (depends on vertex format)
+// NOTE: Required once on VAO creation or on every draw if VAO are not supported
+static void SetVertexBufferAttribs(const VertexBuffer *buffer, int vertexFormat)
+{
+    if (vertexFormat == RL_VERTEX_FORMAT_COMPACT_2D)
+    {
+        // Interleaved vertex attribs, vertex position z is 0.0f (shader attribute default)
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+        glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_POSITION], 2, GL_FLOAT, 0, sizeof(CompactVertex), 0);
+        glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_POSITION]);
 
-    // Vertex shader directly defined, no external file required
-    const char *defaultVShaderStr =
-#if defined(GRAPHICS_API_OPENGL_21)
-    "#version 120                       \n"
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-    "#version 100                       \n"
-#endif
-#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
-    "attribute vec3 vertexPosition;     \n"
-    "attribute vec2 vertexTexCoord;     \n"
-    "attribute vec4 vertexColor;        \n"
-    "varying vec2 fragTexCoord;         \n"
-    "varying vec4 fragColor;            \n"
-#elif defined(GRAPHICS_API_OPENGL_33)
-    "#version 330                       \n"
-    "in vec3 vertexPosition;            \n"
-    "in vec2 vertexTexCoord;            \n"
-    "in vec4 vertexColor;               \n"
-    "out vec2 fragTexCoord;             \n"
-    "out vec4 fragColor;                \n"
-#endif
-    "uniform mat4 mvp;                  \n"
-    "void main()                        \n"
-    "{                                  \n"
-    "    fragTexCoord = vertexTexCoord; \n"
-    "    fragColor = vertexColor;       \n"
-    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
-    "}                                  \n";
+        glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(CompactVertex), (void *)(2*sizeof(float)));
+        glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_TEXCOORD01]);
 
-    // Fragment shader directly defined, no external file required
-    const char *defaultFShaderStr =
-#if defined(GRAPHICS_API_OPENGL_21)
-    "#version 120                       \n"
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-    "#version 100                       \n"
-    "precision mediump float;           \n"     // precision required for OpenGL ES2 (WebGL)
-#endif
-#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
-    "varying vec2 fragTexCoord;         \n"
-    "varying vec4 fragColor;            \n"
-#elif defined(GRAPHICS_API_OPENGL_33)
-    "#version 330       \n"
-    "in vec2 fragTexCoord;              \n"
-    "in vec4 fragColor;                 \n"
-    "out vec4 finalColor;               \n"
-#endif
-    "uniform sampler2D texture0;        \n"
-    "uniform vec4 colDiffuse;           \n"
-    "void main()                        \n"
-    "{                                  \n"
-#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
-    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n" // NOTE: texture2D() is deprecated on OpenGL 3.3 and ES 3.0
-    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
-#elif defined(GRAPHICS_API_OPENGL_33)
-    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
-    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+        glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(CompactVertex), (void *)(2*sizeof(float) + 2*sizeof(unsigned short)));
+        glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_COLOR]);
+    }
+    else
+    {
+        // Vertex attrib: position (shader-location = 0)
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+        glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_POSITION]);
+
+        // Vertex attrib: texcoord (shader-location = 1)
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[1]);
+        glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_TEXCOORD01]);
+
+        // Vertex attrib: color (shader-location = 3)
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[2]);
+        glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_COLOR]);
+    }
+}
+
+// Generate draw indices for non-indexed vertex data on indexed draws
+// NOTE: QUADS are split in two triangles (same as quads index buffer), LINES and TRIANGLES indices are sequential
+static void GenDrawIndices(VertexBuffer *buffer, DrawCall *draw, int firstVertex, int vertexCount)
+{
+    int indexCount = (draw->mode == RL_QUADS)? vertexCount/4*6 : vertexCount;
+
+    // Retained batches grow instead of dropping indices
+    if (((buffer->iCounter + indexCount) > (buffer->elementsCount*BATCH_ELEMENT_INDICES)) && RLGL.currentBatch->retained)
+    {
+        GrowRenderBatch(RLGL.currentBatch, (buffer->iCounter + indexCount)/BATCH_ELEMENT_INDICES + 1, 0);
+    }
+
+    if ((buffer->iCounter + indexCount) > (buffer->elementsCount*BATCH_ELEMENT_INDICES))
+    {
+        TRACELOG(LOG_ERROR, "RLGL: Batch indices overflow");
+        return;
+    }
+
+    if (draw->mode == RL_QUADS)
+    {
+        for (int i = firstVertex; i < (firstVertex + vertexCount/4*4); i += 4)
+        {
+            buffer->drawIndices[buffer->iCounter] = i;
+            buffer->drawIndices[buffer->iCounter + 1] = i + 1;
+            buffer->drawIndices[buffer->iCounter + 2] = i + 2;
+            buffer->drawIndices[buffer->iCounter + 3] = i;
+            buffer->drawIndices[buffer->iCounter + 4] = i + 2;
+            buffer->drawIndices[buffer->iCounter + 5] = i + 3;
+            buffer->iCounter += 6;
+        }
+    }
+    else
+    {
+        for (int i = firstVertex; i < (firstVertex + vertexCount); i++)
+        {
+            buffer->drawIndices[buffer->iCounter] = i;
+            buffer->iCounter++;
+        }
+    }
+
+    draw->indexCount += indexCount;
+}
+
+// Grow render batch current buffer elements and draw calls capacity (capacities are doubled until required ones fit)
+// NOTE: Used by retained batches, they can not be drawn to free space because their data is kept for re-submission;
+// vertex data is kept on CPU and GPU buffers are re-created with the new size, so all data is uploaded again
+static bool GrowRenderBatch(RenderBatch *batch, int elementsCount, int drawsCapacity)
+{
+    VertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+    int maxElements = 0x7fffffff/(4*4*4*sizeof(float));     // Limited by vertex data size in bytes
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    maxElements = 65536/4;      // Limited by 16 bit quads indices
 #endif
-    "}                                  \n";
 
-    // NOTE: Compiled vertex/fragment shaders are kept for re-use
-    RLGL.State.defaultVShaderId = CompileShader(defaultVShaderStr, GL_VERTEX_SHADER);     // Compile default vertex shader
-    RLGL.State.defaultFShaderId = CompileShader(defaultFShaderStr, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+    if ((elementsCount > maxElements) || (drawsCapacity > maxElements*4))
+    {
+        TRACELOG(LOG_WARNING, "RLGL: Retained batch can not grow over %i elements", maxElements);
+        return false;
+    }
 
-    shader.id = LoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId);
+    int newElements = buffer->elementsCount;
+    int newDraws = batch->drawsCapacity;
 
-    if (shader.id > 0)
+    while (newElements < elementsCount) newElements = (newElements < maxElements/2)? 2*newElements : maxElements;
+    while (newDraws < drawsCapacity) newDraws *= 2;
+
+    if (newDraws > batch->drawsCapacity)
     {
-        TRACELOG(LOG_INFO, "SHADER: [ID %i] Default shader loaded successfully", shader.id);
+        DrawCall *draws = (DrawCall *)RL_REALLOC(batch->draws, newDraws*sizeof(DrawCall));
 
-        // Set default shader locations: attributes locations
-        shader.locs[LOC_VERTEX_POSITION] = glGetAttribLocation(shader.id, "vertexPosition");
-        shader.locs[LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(shader.id, "vertexTexCoord");
-        shader.locs[LOC_VERTEX_COLOR] = glGetAttribLocation(shader.id, "vertexColor");
+        if (draws == NULL)
+        {
+            TRACELOG(LOG_WARNING, "RLGL: Retained batch draw calls could not be allocated");
+            return false;
+        }
 
-        // Set default shader locations: uniform locations
-        shader.locs[LOC_MATRIX_MVP]  = glGetUniformLocation(shader.id, "mvp");
-        shader.locs[LOC_COLOR_DIFFUSE] = glGetUniformLocation(shader.id, "colDiffuse");
-        shader.locs[LOC_MAP_DIFFUSE] = glGetUniformLocation(shader.id, "texture0");
+        for (int i = batch->drawsCapacity; i < newDraws; i++)
+        {
+            draws[i] = draws[batch->drawsCapacity - 1];
+            draws[i].vertexCount = 0;
+            draws[i].vertexAlignment = 0;
+            draws[i].indexCount = 0;
+        }
 
-        // NOTE: We could also use below function but in case DEFAULT_ATTRIB_* points are
-        // changed for external custom shaders, we just use direct bindings above
-        //SetShaderDefaultLocations(&shader);
+        batch->draws = draws;
+        batch->drawsCapacity = newDraws;
     }
-    else TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to load default shader", shader.id);
 
-    return shader;
-}
+    if (newElements > buffer->elementsCount)
+    {
+        void *vertices = RL_REALLOC(buffer->vertices, newElements*3*4*sizeof(float));
+        if (vertices != NULL) buffer->vertices = (float *)vertices;
+        void *texcoords = RL_REALLOC(buffer->texcoords, newElements*2*4*sizeof(float));
+        if (texcoords != NULL) buffer->texcoords = (float *)texcoords;
+        void *colors = RL_REALLOC(buffer->colors, newElements*4*4*sizeof(unsigned char));
+        if (colors != NULL) buffer->colors = (unsigned char *)colors;
+        void *indices = RL_REALLOC(buffer->indices, newElements*6*sizeof(buffer->indices[0]));
+        if (indices != NULL) buffer->indices = indices;
+        void *drawIndices = RL_REALLOC(buffer->drawIndices, newElements*BATCH_ELEMENT_INDICES*sizeof(buffer->drawIndices[0]));
+        if (drawIndices != NULL) buffer->drawIndices = drawIndices;
+        void *interleaved = NULL;
+        if (batch->vertexFormat == RL_VERTEX_FORMAT_COMPACT_2D)
+        {
+            interleaved = RL_REALLOC(buffer->interleaved, newElements*4*sizeof(CompactVertex));
+            if (interleaved != NULL) buffer->interleaved = (unsigned char *)interleaved;
+        }
 
-// Get location handlers to for shader attributes and uniforms
-// NOTE: If any location is not found, loc point becomes -1
-static void SetShaderDefaultLocations(Shader *shader)
-{
-    // NOTE: Default shader attrib locations have been fixed before linking:
-    //          vertex position location    = 0
-    //          vertex texcoord location    = 1
-    //          vertex normal location      = 2
-    //          vertex color location       = 3
-    //          vertex tangent location     = 4
-    //          vertex texcoord2 location   = 5
+        if ((vertices == NULL) || (texcoords == NULL) || (colors == NULL) || (indices == NULL) || (drawIndices == NULL) ||
+            ((batch->vertexFormat == RL_VERTEX_FORMAT_COMPACT_2D) && (interleaved == NULL)))
+        {
+            TRACELOG(LOG_WARNING, "RLGL: Retained batch vertex data could not be allocated");
+            return false;   // NOTE: Arrays successfully reallocated are bigger, previous elementsCount is still valid
+        }
 
-    // Get handles to GLSL input attibute locations
-    shader->locs[LOC_VERTEX_POSITION] = glGetAttribLocation(shader->id, DEFAULT_SHADER_ATTRIB_NAME_POSITION);
-    shader->locs[LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(shader->id, DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
-    shader->locs[LOC_VERTEX_TEXCOORD02] = glGetAttribLocation(shader->id, DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
-    shader->locs[LOC_VERTEX_NORMAL] = glGetAttribLocation(shader->id, DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
-    shader->locs[LOC_VERTEX_TANGENT] = glGetAttribLocation(shader->id, DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
-    shader->locs[LOC_VERTEX_COLOR] = glGetAttribLocation(shader->id, DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+        // Quads indices for new elements
+        for (int k = buffer->elementsCount; k < newElements; k++)
+        {
+            buffer->indices[6*k] = 4*k;
+            buffer->indices[6*k + 1] = 4*k + 1;
+            buffer->indices[6*k + 2] = 4*k + 2;
+            buffer->indices[6*k + 3] = 4*k;
+            buffer->indices[6*k + 4] = 4*k + 2;
+            buffer->indices[6*k + 5] = 4*k + 3;
+        }
 
-    // Get handles to GLSL uniform locations (vertex shader)
-    shader->locs[LOC_MATRIX_MVP]  = glGetUniformLocation(shader->id, "mvp");
-    shader->locs[LOC_MATRIX_PROJECTION]  = glGetUniformLocation(shader->id, "projection");
-    shader->locs[LOC_MATRIX_VIEW]  = glGetUniformLocation(shader->id, "view");
+        buffer->elementsCount = newElements;
 
-    // Get handles to GLSL uniform locations (fragment shader)
-    shader->locs[LOC_COLOR_DIFFUSE] = glGetUniformLocation(shader->id, "colDiffuse");
-    shader->locs[LOC_MAP_DIFFUSE] = glGetUniformLocation(shader->id, "texture0");
-    shader->locs[LOC_MAP_SPECULAR] = glGetUniformLocation(shader->id, "texture1");
-    shader->locs[LOC_MAP_NORMAL] = glGetUniformLocation(shader->id, "texture2");
-}
+        // Re-create GPU buffers storage with new size, vertex data is uploaded again on next draw
+        // NOTE: Element array buffer binding is part of VAO state, quads index buffer is bound last
+        if (RLGL.ExtSupported.vao) StateBindVertexArray(buffer->vaoId);
 
-// Unload default shader
-static void UnloadShaderDefault(void)
-{
-    glUseProgram(0);
+        if (batch->vertexFormat == RL_VERTEX_FORMAT_COMPACT_2D)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+            glBufferData(GL_ARRAY_BUFFER, newElements*4*sizeof(CompactVertex), NULL, GL_DYNAMIC_DRAW);
+        }
+        else
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+            glBufferData(GL_ARRAY_BUFFER, newElements*3*4*sizeof(float), NULL, GL_DYNAMIC_DRAW);
+            glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[1]);
+            glBufferData(GL_ARRAY_BUFFER, newElements*2*4*sizeof(float), NULL, GL_DYNAMIC_DRAW);
+            glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[2]);
+            glBufferData(GL_ARRAY_BUFFER, newElements*4*4*sizeof(unsigned char), NULL, GL_DYNAMIC_DRAW);
+        }
 
-    glDetachShader(RLGL.State.defaultShader.id, RLGL.State.defaultVShaderId);
-    glDetachShader(RLGL.State.defaultShader.id, RLGL.State.defaultFShaderId);
-    glDeleteShader(RLGL.State.defaultVShaderId);
-    glDeleteShader(RLGL.State.defaultFShaderId);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer->vboId[4]);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, newElements*BATCH_ELEMENT_INDICES*sizeof(buffer->drawIndices[0]), NULL, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer->vboId[3]);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, newElements*6*sizeof(buffer->indices[0]), buffer->indices, GL_STATIC_DRAW);
 
-    glDeleteProgram(RLGL.State.defaultShader.id);
+        if (RLGL.ExtSupported.vao) StateBindVertexArray(0);
+        else
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        }
 
-    RL_FREE(RLGL.State.defaultShader.locs);
+        buffer->uploadCounter = 0;
+        buffer->indexUploadCounter = 0;
+    }
+
+    TRACELOGD("RLGL: Retained batch grown to %i elements and %i draw calls", buffer->elementsCount, batch->drawsCapacity);
+
+    return true;
 }
 
-// Load render batch
-static RenderBatch LoadRenderBatch(int numBuffers, int bufferElements)
+// Draw current render batch forced by batch limits, reason is registered for frame statistics
+// NOTE: Retained batches only get here if they could not grow, their data is drawn and discarded
+// (not kept for next frames) so vertex data submission can continue
+static void FlushRenderBatch(int reason)
 {
-    RenderBatch batch = { 0 };
-
-    // Initialize CPU (RAM) vertex buffers (position, texcoord, color data and indexes)
-    //--------------------------------------------------------------------------------------------
-    batch.vertexBuffer = (VertexBuffer *)RL_MALLOC(sizeof(VertexBuffer)*numBuffers);
+    RLGL.State.flushReason = reason;
+    rlDrawRenderBatch(RLGL.currentBatch);
 
-    for (int i = 0; i < numBuffers; i++)
+    if (RLGL.currentBatch->retained)
     {
-        batch.vertexBuffer[i].elementsCount = bufferElements;
+        TRACELOG(LOG_WARNING, "RLGL: Retained batch limits reached, batch data drawn and discarded");
+        rlResetRenderBatch(RLGL.currentBatch);
+    }
+}
 
-        batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
-        batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
-#if defined(GRAPHICS_API_OPENGL_33)
-        batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-        batch.vertexBuffer[i].indices = (unsigned short *)RL_MALLOC(bufferElements*6*sizeof(unsigned short));  // 6 int by quad (indices)
-#endif
+// Sort render batch draw calls by layer, texture and mode, merging contiguous draws with same state
+// NOTE: Vertex data is reordered to follow the new draw calls order, draws are submitted in ascending
+// layer order and inside a layer every texture/mode pair is drawn once, keeping submission order among them;
+// open draw call (last one) state is preserved so next vertex data can be appended to it
+static void SortRenderBatch(RenderBatch *batch)
+{
+    VertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+    DrawCall openDraw = batch->draws[batch->drawsCounter - 1];
 
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
-        for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
-        for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
+    // Make sure auxiliar draw calls arrays can store all batch draw calls
+    if (RLGL.State.sortDrawsCapacity < batch->drawsCounter)
+    {
+        RLGL.State.sortKeys = (DrawCallKey *)RL_REALLOC(RLGL.State.sortKeys, batch->drawsCapacity*sizeof(DrawCallKey));
+        RLGL.State.sortDraws = (DrawCall *)RL_REALLOC(RLGL.State.sortDraws, batch->drawsCapacity*sizeof(DrawCall));
+        RLGL.State.sortDrawsCapacity = batch->drawsCapacity;
+    }
 
-        int k = 0;
+    DrawCallKey *keys = RLGL.State.sortKeys;
+    DrawCall *merged = RLGL.State.sortDraws;
+    int keysCount = 0;
 
-        // Indices can be initialized right now
-        for (int j = 0; j < (6*bufferElements); j += 6)
+    // Get non-empty draw calls keys and vertex (and indices) offsets
+    for (int i = 0, vertexOffset = 0, indexOffset = 0; i < batch->drawsCounter; i++)
+    {
+        if (batch->draws[i].vertexCount > 0)
         {
-            batch.vertexBuffer[i].indices[j] = 4*k;
-            batch.vertexBuffer[i].indices[j + 1] = 4*k + 1;
-            batch.vertexBuffer[i].indices[j + 2] = 4*k + 2;
-            batch.vertexBuffer[i].indices[j + 3] = 4*k;
-            batch.vertexBuffer[i].indices[j + 4] = 4*k + 2;
-            batch.vertexBuffer[i].indices[j + 5] = 4*k + 3;
-
-            k++;
+            keys[keysCount].layer = batch->draws[i].layer;
+            keys[keysCount].textureId = batch->draws[i].textureId;
+            keys[keysCount].mode = batch->draws[i].mode;
+            keys[keysCount].index = i;
+            keys[keysCount].offset = vertexOffset;
+            keys[keysCount].vertexCount = batch->draws[i].vertexCount;
+            keys[keysCount].indexOffset = indexOffset;
+            keys[keysCount].indexCount = batch->draws[i].indexCount;
+            keysCount++;
         }
 
-        batch.vertexBuffer[i].vCounter = 0;
-        batch.vertexBuffer[i].tcCounter = 0;
-        batch.vertexBuffer[i].cCounter = 0;
+        vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+        indexOffset += batch->draws[i].indexCount;
     }
 
-    TRACELOG(LOG_INFO, "RLGL: Internal vertex buffers initialized successfully in RAM (CPU)");
-    //--------------------------------------------------------------------------------------------
+    qsort(keys, keysCount, sizeof(DrawCallKey), CompareDrawCallKeys);
 
-    // Upload to GPU (VRAM) vertex data and initialize VAOs/VBOs
-    //--------------------------------------------------------------------------------------------
-    for (int i = 0; i < numBuffers; i++)
+    // Merge draw calls with same state, computing reordered vertex positions
+    // NOTE: Indexed and non-indexed draw calls are never merged
+    int mergedCount = 0;
+    int counter = 0;
+    int indexCounter = 0;
+
+    for (int k = 0; k < keysCount; k++)
     {
-        if (RLGL.ExtSupported.vao)
+        if ((mergedCount == 0) || (merged[mergedCount - 1].layer != keys[k].layer) ||
+            (merged[mergedCount - 1].textureId != keys[k].textureId) || (merged[mergedCount - 1].mode != keys[k].mode) ||
+            ((merged[mergedCount - 1].indexCount > 0) != (keys[k].indexCount > 0)) ||
+            (memcmp(&merged[mergedCount - 1].transform, &batch->draws[keys[k].index].transform, sizeof(Matrix)) != 0))
         {
-            // Initialize Quads VAO
-            glGenVertexArrays(1, &batch.vertexBuffer[i].vaoId);
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
+            // Align previous draw call to a multiple of 4 vertex (required by QUADS index processing)
+            if (mergedCount > 0)
+            {
+                merged[mergedCount - 1].vertexAlignment = (4 - merged[mergedCount - 1].vertexCount%4)%4;
+                counter += merged[mergedCount - 1].vertexAlignment;
+            }
+
+            merged[mergedCount] = batch->draws[keys[k].index];
+            merged[mergedCount].vertexCount = 0;
+            merged[mergedCount].vertexAlignment = 0;
+            merged[mergedCount].indexCount = 0;
+            mergedCount++;
         }
 
-        // Quads - Vertex buffers binding and attributes enable
-        // Vertex position buffer (shader-location = 0)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_POSITION]);
-        glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+        keys[k].target = counter;
+        merged[mergedCount - 1].vertexCount += keys[k].vertexCount;
+        counter += keys[k].vertexCount;
 
-        // Vertex texcoord buffer (shader-location = 1)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_TEXCOORD01]);
-        glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+        keys[k].indexTarget = indexCounter;
+        merged[mergedCount - 1].indexCount += keys[k].indexCount;
+        indexCounter += keys[k].indexCount;
+    }
 
-        // Vertex color buffer (shader-location = 3)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_COLOR]);
-        glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+    // Open draw call state must be kept for next vertex data, reuse last draw call if it matches
+    // NOTE: If no draw call could be merged there is no space left for a new draw call,
+    // in that case last draw call stays open (batch is expected to be drawn immediately)
+    bool openMerged = ((openDraw.vertexCount > 0) && (merged[mergedCount - 1].layer == openDraw.layer) &&
+        (merged[mergedCount - 1].textureId == openDraw.textureId) && (merged[mergedCount - 1].mode == openDraw.mode) &&
+        ((merged[mergedCount - 1].indexCount > 0) == (openDraw.indexCount > 0)) &&
+        (memcmp(&merged[mergedCount - 1].transform, &openDraw.transform, sizeof(Matrix)) == 0));
+    bool openAppend = (!openMerged && (mergedCount < batch->drawsCapacity));
 
-        // Fill index buffer
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
-#if defined(GRAPHICS_API_OPENGL_33)
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(int), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(short), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
-#endif
+    if (openAppend && (mergedCount > 0))
+    {
+        merged[mergedCount - 1].vertexAlignment = (4 - merged[mergedCount - 1].vertexCount%4)%4;
+        counter += merged[mergedCount - 1].vertexAlignment;
     }
 
-    TRACELOG(LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully");
-
-    // Unbind the current VAO
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
-    //--------------------------------------------------------------------------------------------
+    // Alignment vertex could exceed buffer size when open draw call gets aligned, keep submission order
+    if (counter > buffer->elementsCount*4) return;
 
-    // Init draw calls tracking system
-    //--------------------------------------------------------------------------------------------
-    batch.draws = (DrawCall *)RL_MALLOC(DEFAULT_BATCH_DRAWCALLS*sizeof(DrawCall));
+    // Make sure auxiliar buffer can store the full batch buffer
+    if (RLGL.State.sortBuffer.elementsCount < buffer->elementsCount)
+    {
+        RLGL.State.sortBuffer.vertices = (float *)RL_REALLOC(RLGL.State.sortBuffer.vertices, buffer->elementsCount*3*4*sizeof(float));
+        RLGL.State.sortBuffer.texcoords = (float *)RL_REALLOC(RLGL.State.sortBuffer.texcoords, buffer->elementsCount*2*4*sizeof(float));
+        RLGL.State.sortBuffer.colors = (unsigned char *)RL_REALLOC(RLGL.State.sortBuffer.colors, buffer->elementsCount*4*4*sizeof(unsigned char));
+        RLGL.State.sortBuffer.drawIndices = RL_REALLOC(RLGL.State.sortBuffer.drawIndices, buffer->elementsCount*BATCH_ELEMENT_INDICES*sizeof(buffer->drawIndices[0]));
+        RLGL.State.sortBuffer.elementsCount = buffer->elementsCount;
+    }
 
-    for (int i = 0; i < DEFAULT_BATCH_DRAWCALLS; i++)
+    // Copy vertex data in sorted order
+    for (int k = 0; k < keysCount; k++)
     {
-        batch.draws[i].mode = RL_QUADS;
-        batch.draws[i].vertexCount = 0;
-        batch.draws[i].vertexAlignment = 0;
-        //batch.draws[i].vaoId = 0;
-        //batch.draws[i].shaderId = 0;
-        batch.draws[i].textureId = RLGL.State.defaultTextureId;
-        //batch.draws[i].RLGL.State.projection = MatrixIdentity();
-        //batch.draws[i].RLGL.State.modelview = MatrixIdentity();
+        memcpy(RLGL.State.sortBuffer.vertices + 3*keys[k].target, buffer->vertices + 3*keys[k].offset, 3*keys[k].vertexCount*sizeof(float));
+        memcpy(RLGL.State.sortBuffer.texcoords + 2*keys[k].target, buffer->texcoords + 2*keys[k].offset, 2*keys[k].vertexCount*sizeof(float));
+        memcpy(RLGL.State.sortBuffer.colors + 4*keys[k].target, buffer->colors + 4*keys[k].offset, 4*keys[k].vertexCount*sizeof(unsigned char));
+
+        // Draw indices point to vertex positions, they must be moved along with vertex data
+        for (int j = 0; j < keys[k].indexCount; j++) RLGL.State.sortBuffer.drawIndices[keys[k].indexTarget + j] = buffer->drawIndices[keys[k].indexOffset + j] - keys[k].offset + keys[k].target;
     }
 
-    batch.buffersCount = numBuffers;    // Record buffer count
-    batch.drawsCounter = 1;             // Reset draws counter
-    batch.currentDepth = -1.0f;         // Reset depth value
-    //--------------------------------------------------------------------------------------------
+    memcpy(buffer->vertices, RLGL.State.sortBuffer.vertices, 3*counter*sizeof(float));
+    memcpy(buffer->texcoords, RLGL.State.sortBuffer.texcoords, 2*counter*sizeof(float));
+    memcpy(buffer->colors, RLGL.State.sortBuffer.colors, 4*counter*sizeof(unsigned char));
+    memcpy(buffer->drawIndices, RLGL.State.sortBuffer.drawIndices, indexCounter*sizeof(buffer->drawIndices[0]));
 
-    return batch;
-}
+    buffer->vCounter = counter;
+    buffer->tcCounter = counter;
+    buffer->cCounter = counter;
+    buffer->iCounter = indexCounter;
+    buffer->uploadCounter = 0;      // Reordered vertex data must be uploaded again
+    buffer->indexUploadCounter = 0;
 
-// Draw render batch
-// NOTE: We require a pointer to reset batch and increase current buffer (multi-buffer)
-static void DrawRenderBatch(RenderBatch *batch)
-{
-    // Update batch vertex buffers
-    //------------------------------------------------------------------------------------------------------------
-    // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
-    // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (change flag required)
-    if (batch->vertexBuffer[batch->currentBuffer].vCounter > 0)
+    for (int i = 0; i < mergedCount; i++) batch->draws[i] = merged[i];
+
+    batch->drawsCounter = mergedCount;
+
+    if (openAppend)
     {
-        // Activate elements VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+        batch->draws[mergedCount] = openDraw;
+        batch->draws[mergedCount].vertexCount = 0;
+        batch->draws[mergedCount].vertexAlignment = 0;
+        batch->draws[mergedCount].indexCount = 0;
+        batch->drawsCounter++;
+    }
 
-        // Vertex positions buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, batch->vertexBuffer[batch->currentBuffer].vCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementsCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
+    // Unused draw calls are kept empty, they could be opened later
+    for (int i = batch->drawsCounter; i < batch->drawsCapacity; i++)
+    {
+        batch->draws[i].vertexCount = 0;
+        batch->draws[i].vertexAlignment = 0;
+        batch->draws[i].indexCount = 0;
+    }
+}
 
-        // Texture coordinates buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, batch->vertexBuffer[batch->currentBuffer].vCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementsCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
+// Compare draw calls sorting keys (used by qsort())
+static int CompareDrawCallKeys(const void *a, const void *b)
+{
+    const DrawCallKey *keyA = (const DrawCallKey *)a;
+    const DrawCallKey *keyB = (const DrawCallKey *)b;
 
-        // Colors buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, batch->vertexBuffer[batch->currentBuffer].vCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementsCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
+    if (keyA->layer != keyB->layer) return (keyA->layer < keyB->layer)? -1 : 1;
+    if (keyA->textureId != keyB->textureId) return (keyA->textureId < keyB->textureId)? -1 : 1;
+    if (keyA->mode != keyB->mode) return (keyA->mode < keyB->mode)? -1 : 1;
+    if ((keyA->indexCount > 0) != (keyB->indexCount > 0)) return (keyA->indexCount > 0)? 1 : -1;
 
-        // NOTE: glMapBuffer() causes sync issue.
-        // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
-        // To avoid waiting (idle), you can call first glBufferData() with NULL pointer before glMapBuffer().
-        // If you do that, the previous data in PBO will be discarded and glMapBuffer() returns a new
-        // allocated pointer immediately even if GPU is still working with the previous data.
-
-        // Another option: map the buffer object into client's memory
-        // Probably this code could be moved somewhere else...
-        // batch->vertexBuffer[batch->currentBuffer].vertices = (float *)glMapBuffer(GL_ARRAY_BUFFER, GL_READ_WRITE);
-        // if (batch->vertexBuffer[batch->currentBuffer].vertices)
-        // {
-            // Update vertex data
-        // }
-        // glUnmapBuffer(GL_ARRAY_BUFFER);
-
-        // Unbind the current VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0);
-    }
-    //------------------------------------------------------------------------------------------------------------
+    return (keyA->index - keyB->index);
+}
 
-    // Draw batch vertex buffers (considering VR stereo if required)
-    //------------------------------------------------------------------------------------------------------------
-    Matrix matProjection = RLGL.State.projection;
-    Matrix matModelView = RLGL.State.modelview;
+// Compile custom shader and return shader id
+static unsigned int CompileShader(const char *shaderStr, int type)
+{
+    unsigned int shader = glCreateShader(type);
+    glShaderSource(shader, 1, &shaderStr, NULL);
 
-    int eyesCount = 1;
-#if defined(SUPPORT_VR_SIMULATOR)
-    if (RLGL.Vr.stereoRender) eyesCount = 2;
-#endif
+    GLint success = 0;
+    glCompileShader(shader);
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
 
-    for (int eye = 0; eye < eyesCount; eye++)
+    if (success != GL_TRUE)
     {
-#if defined(SUPPORT_VR_SIMULATOR)
-        if (eyesCount == 2) SetStereoView(eye, matProjection, matModelView);
+        TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to compile shader code", shader);
+        int maxLength = 0;
+        int length;
+        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
+
+#if defined(_MSC_VER)
+        char *log = RL_MALLOC(maxLength);
+#else
+        char log[maxLength];
 #endif
-        // Draw buffers
-        if (batch->vertexBuffer[batch->currentBuffer].vCounter > 0)
-        {
-            // Set current shader and upload current MVP matrix
-            glUseProgram(RLGL.State.currentShader.id);
+        glGetShaderInfoLog(shader, maxLength, &length, log);
 
-            // Create modelview-projection matrix and upload to shader
-            Matrix matMVP = MatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
-            glUniformMatrix4fv(RLGL.State.currentShader.locs[LOC_MATRIX_MVP], 1, false, MatrixToFloat(matMVP));
+        TRACELOG(LOG_WARNING, "SHADER: [ID %i] Compile error: %s", shader, log);
 
-            if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
-            else
-            {
-                // Bind vertex attrib: position (shader-location = 0)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-                glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_POSITION]);
+#if defined(_MSC_VER)
+        RL_FREE(log);
+#endif
+    }
+    else TRACELOG(LOG_INFO, "SHADER: [ID %i] Compiled successfully", shader);
 
-                // Bind vertex attrib: texcoord (shader-location = 1)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-                glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_TEXCOORD01]);
+    return shader;
+}
 
-                // Bind vertex attrib: color (shader-location = 3)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-                glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_COLOR]);
+// Load custom shader strings and return program id
+static unsigned int LoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
+{
+    unsigned int program = 0;
 
-                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
-            }
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    GLint success = 0;
+    program = glCreateProgram();
 
-            // Setup some default shader values
-            glUniform4f(RLGL.State.currentShader.locs[LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
-            glUniform1i(RLGL.State.currentShader.locs[LOC_MAP_DIFFUSE], 0);  // Active default sampler2D: texture0
+    glAttachShader(program, vShaderId);
+    glAttachShader(program, fShaderId);
 
-            // Activate additional sampler textures
-            // Those additional textures will be common for all draw calls of the batch
-            for (int i = 0; i < MAX_BATCH_ACTIVE_TEXTURES; i++)
-            {
-                if (RLGL.State.activeTextureId[i] > 0)
-                {
-                    glActiveTexture(GL_TEXTURE0 + 1 + i);
-                    glBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
-                }
-            }
+    // NOTE: Default attribute shader locations must be binded before linking
+    glBindAttribLocation(program, 0, DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+    glBindAttribLocation(program, 1, DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
+    glBindAttribLocation(program, 2, DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
+    glBindAttribLocation(program, 3, DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+    glBindAttribLocation(program, 4, DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
+    glBindAttribLocation(program, 5, DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
 
-            // Activate default sampler2D texture0 (one texture is always active for default batch shader)
-            // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
-            glActiveTexture(GL_TEXTURE0);
+    // NOTE: If some attrib name is no found on the shader, it locations becomes -1
 
-            for (int i = 0, vertexOffset = 0; i < batch->drawsCounter; i++)
-            {
-                // Bind current draw call texture, activated as GL_TEXTURE0 and binded to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+    glLinkProgram(program);
 
-                if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
-                else
-                {
-#if defined(GRAPHICS_API_OPENGL_33)
-                    // We need to define the number of indices to be processed: quadsCount*6
-                    // NOTE: The final parameter tells the GPU the offset in bytes from the
-                    // start of the index buffer to the location of the first index to process
-                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)));
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(vertexOffset/4*6*sizeof(GLushort)));
-#endif
-                }
+    // NOTE: All uniform variables are intitialised to 0 when a program links
 
-                vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
-            }
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
 
-            if (!RLGL.ExtSupported.vao)
-            {
-                glBindBuffer(GL_ARRAY_BUFFER, 0);
-                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-            }
+    if (success == GL_FALSE)
+    {
+        TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to link shader program", program);
 
-            glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
+        int maxLength = 0;
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+        
+        if (maxLength > 0) 
+        {
+            int length;
+            char *log = RL_CALLOC(maxLength, sizeof(char));
+            glGetProgramInfoLog(program, maxLength, &length, log);
+            TRACELOG(LOG_WARNING, "SHADER: [ID %i] Link error: %s", program, log);
+            RL_FREE(log);
         }
 
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0); // Unbind VAO
+        glDeleteProgram(program);
 
-        glUseProgram(0);    // Unbind shader program
+        program = 0;
     }
-    //------------------------------------------------------------------------------------------------------------
-
-    // Reset batch buffers
-    //------------------------------------------------------------------------------------------------------------
-    // Reset vertex counters for next frame
-    batch->vertexBuffer[batch->currentBuffer].vCounter = 0;
-    batch->vertexBuffer[batch->currentBuffer].tcCounter = 0;
-    batch->vertexBuffer[batch->currentBuffer].cCounter = 0;
+    else TRACELOG(LOG_INFO, "SHADER: [ID %i] Program loaded successfully", program);
+#endif
+    return program;
+}
 
-    // Reset depth for next draw
-    batch->currentDepth = -1.0f;
 
-    // Restore projection/modelview matrices
-    RLGL.State.projection = matProjection;
-    RLGL.State.modelview = matModelView;
+// Load default shader (just vertex positioning and texture coloring)
+// NOTE: This shader program is used for internal buffers
+static Shader LoadShaderDefault(void)
+{
+    Shader shader = { 0 };
+    shader.locs = (int *)RL_CALLOC(MAX_SHADER_LOCATIONS, sizeof(int));
 
-    // Reset RLGL.currentBatch->draws array
-    for (int i = 0; i < DEFAULT_BATCH_DRAWCALLS; i++)
-    {
-        batch->draws[i].mode = RL_QUADS;
-        batch->draws[i].vertexCount = 0;
-        batch->draws[i].textureId = RLGL.State.defaultTextureId;
-    }
+    // NOTE: All locations must be reseted to -1 (no location)
+    for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
 
-    // Reset active texture units for next batch
-    for (int i = 0; i < MAX_BATCH_ACTIVE_TEXTURES; i++) RLGL.State.activeTextureId[i] = 0;
+    // Vertex shader directly defined, no external file required
+    const char *defaultVShaderStr =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
 
-    // Reset draws counter to one draw for the batch
-    batch->drawsCounter = 1;
-    //------------------------------------------------------------------------------------------------------------
+    // Fragment shader directly defined, no external file required
+    const char *defaultFShaderStr =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // precision required for OpenGL ES2 (WebGL)
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+#endif
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n" // NOTE: texture2D() is deprecated on OpenGL 3.3 and ES 3.0
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+#endif
+    "}                                  \n";
 
-    // Change to next buffer in the list (in case of multi-buffering)
-    batch->currentBuffer++;
-    if (batch->currentBuffer >= batch->buffersCount) batch->currentBuffer = 0;
-}
+    // NOTE: Compiled vertex/fragment shaders are kept for re-use
+    RLGL.State.defaultVShaderId = CompileShader(defaultVShaderStr, GL_VERTEX_SHADER);     // Compile default vertex shader
+    RLGL.State.defaultFShaderId = CompileShader(defaultFShaderStr, GL_FRAGMENT_SHADER);   // Compile default fragment shader
 
-// Unload default internal buffers vertex data from CPU and GPU
-static void UnloadRenderBatch(RenderBatch batch)
-{
-    // Unbind everything
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
-    glDisableVertexAttribArray(0);
-    glDisableVertexAttribArray(1);
-    glDisableVertexAttribArray(2);
-    glDisableVertexAttribArray(3);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    shader.id = LoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId);
 
-    // Unload all vertex buffers data
-    for (int i = 0; i < batch.buffersCount; i++)
+    if (shader.id > 0)
     {
-        // Delete VBOs from GPU (VRAM)
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[3]);
+        TRACELOG(LOG_INFO, "SHADER: [ID %i] Default shader loaded successfully", shader.id);
 
-        // Delete VAOs from GPU (VRAM)
-        if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
+        // Set default shader locations: attributes locations
+        shader.locs[LOC_VERTEX_POSITION] = glGetAttribLocation(shader.id, "vertexPosition");
+        shader.locs[LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(shader.id, "vertexTexCoord");
+        shader.locs[LOC_VERTEX_COLOR] = glGetAttribLocation(shader.id, "vertexColor");
 
-        // Free vertex arrays memory from CPU (RAM)
-        RL_FREE(batch.vertexBuffer[i].vertices);
-        RL_FREE(batch.vertexBuffer[i].texcoords);
-        RL_FREE(batch.vertexBuffer[i].colors);
-        RL_FREE(batch.vertexBuffer[i].indices);
+        // Set default shader locations: uniform locations
+        shader.locs[LOC_MATRIX_MVP]  = glGetUniformLocation(shader.id, "mvp");
+        shader.locs[LOC_COLOR_DIFFUSE] = glGetUniformLocation(shader.id, "colDiffuse");
+        shader.locs[LOC_MAP_DIFFUSE] = glGetUniformLocation(shader.id, "texture0");
+
+        // NOTE: We could also use below function but in case DEFAULT_ATTRIB_* points are
+        // changed for external custom shaders, we just use direct bindings above
+        //SetShaderDefaultLocations(&shader);
     }
+    else TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to load default shader", shader.id);
 
-    // Unload arrays
-    RL_FREE(batch.vertexBuffer);
-    RL_FREE(batch.draws);
+    return shader;
 }
 
-// Set the active render batch for rlgl
-static void SetRenderBatchActive(RenderBatch *batch)
+// Get location handlers to for shader attributes and uniforms
+// NOTE: If any location is not found, loc point becomes -1
+static void SetShaderDefaultLocations(Shader *shader)
 {
-    DrawRenderBatch(RLGL.currentBatch);
-    RLGL.currentBatch = batch;
+    // NOTE: Default shader attrib locations have been fixed before linking:
+    //          vertex position location    = 0
+    //          vertex texcoord location    = 1
+    //          vertex normal location      = 2
+    //          vertex color location       = 3
+    //          vertex tangent location     = 4
+    //          vertex texcoord2 location   = 5
+
+    // Get handles to GLSL input attibute locations
+    shader->locs[LOC_VERTEX_POSITION] = glGetAttribLocation(shader->id, DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+    shader->locs[LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(shader->id, DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
+    shader->locs[LOC_VERTEX_TEXCOORD02] = glGetAttribLocation(shader->id, DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+    shader->locs[LOC_VERTEX_NORMAL] = glGetAttribLocation(shader->id, DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
+    shader->locs[LOC_VERTEX_TANGENT] = glGetAttribLocation(shader->id, DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
+    shader->locs[LOC_VERTEX_COLOR] = glGetAttribLocation(shader->id, DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+
+    // Get handles to GLSL uniform locations (vertex shader)
+    shader->locs[LOC_MATRIX_MVP]  = glGetUniformLocation(shader->id, "mvp");
+    shader->locs[LOC_MATRIX_PROJECTION]  = glGetUniformLocation(shader->id, "projection");
+    shader->locs[LOC_MATRIX_VIEW]  = glGetUniformLocation(shader->id, "view");
+
+    // Get handles to GLSL uniform locations (fragment shader)
+    shader->locs[LOC_COLOR_DIFFUSE] = glGetUniformLocation(shader->id, "colDiffuse");
+    shader->locs[LOC_MAP_DIFFUSE] = glGetUniformLocation(shader->id, "texture0");
+    shader->locs[LOC_MAP_SPECULAR] = glGetUniformLocation(shader->id, "texture1");
+    shader->locs[LOC_MAP_NORMAL] = glGetUniformLocation(shader->id, "texture2");
 }
 
-// Set default render batch for rlgl
-static void SetRenderBatchDefault(void)
+// Unload default shader
+static void UnloadShaderDefault(void)
 {
-    DrawRenderBatch(RLGL.currentBatch);
-    RLGL.currentBatch = &RLGL.defaultBatch;
+    StateUseProgram(0);
+
+    glDetachShader(RLGL.State.defaultShader.id, RLGL.State.defaultVShaderId);
+    glDetachShader(RLGL.State.defaultShader.id, RLGL.State.defaultFShaderId);
+    glDeleteShader(RLGL.State.defaultVShaderId);
+    glDeleteShader(RLGL.State.defaultFShaderId);
+
+    UnloadShaderUniforms(RLGL.State.defaultShader.id);
+    glDeleteProgram(RLGL.State.defaultShader.id);
+
+    RL_FREE(RLGL.State.defaultShader.locs);
 }
 
 // Renders a 1x1 XY quad in NDC
@@ -4649,7 +6574,7 @@ static void GenDrawQuad(void)
 
     // Gen VAO to contain VBO
     glGenVertexArrays(1, &quadVAO);
-    glBindVertexArray(quadVAO);
+    StateBindVertexArray(quadVAO);
 
     // Gen and fill vertex buffer (VBO)
     glGenBuffers(1, &quadVBO);
@@ -4663,12 +6588,13 @@ static void GenDrawQuad(void)
     glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)(3*sizeof(float))); // Texcoords
 
     // Draw quad
-    glBindVertexArray(quadVAO);
+    StateBindVertexArray(quadVAO);
     glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-    glBindVertexArray(0);
+    StateBindVertexArray(0);
 
     // Delete buffers (VBO and VAO)
     glDeleteBuffers(1, &quadVBO);
+    StateBindVertexArray(0);
     glDeleteVertexArrays(1, &quadVAO);
 }
 
@@ -4720,7 +6646,7 @@ static void GenDrawCube(void)
 
     // Gen VAO to contain VBO
     glGenVertexArrays(1, &cubeVAO);
-    glBindVertexArray(cubeVAO);
+    StateBindVertexArray(cubeVAO);
 
     // Gen and fill vertex buffer (VBO)
     glGenBuffers(1, &cubeVBO);
@@ -4728,7 +6654,7 @@ static void GenDrawCube(void)
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
     // Bind vertex attributes (position, normals, texcoords)
-    glBindVertexArray(cubeVAO);
+    StateBindVertexArray(cubeVAO);
     glEnableVertexAttribArray(0);
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)0); // Positions
     glEnableVertexAttribArray(1);
@@ -4736,15 +6662,16 @@ static void GenDrawCube(void)
     glEnableVertexAttribArray(2);
     glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(6*sizeof(float))); // Texcoords
     glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    StateBindVertexArray(0);
 
     // Draw cube
-    glBindVertexArray(cubeVAO);
+    StateBindVertexArray(cubeVAO);
     glDrawArrays(GL_TRIANGLES, 0, 36);
-    glBindVertexArray(0);
+    StateBindVertexArray(0);
 
     // Delete VBO and VAO
     glDeleteBuffers(1, &cubeVBO);
+    StateBindVertexArray(0);
     glDeleteVertexArrays(1, &cubeVAO);
 }
 
@@ -4979,12 +6906,15 @@ int GetPixelDataSize(int width, int height, int format)
 
     dataSize = width*height*bpp/8;  // Total data size in bytes
 
-    // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
+    // Most compressed formats works on 4x4 blocks, data size is rounded up to full blocks
+    if (((format >= COMPRESSED_DXT1_RGB) && (format <= COMPRESSED_ETC2_EAC_RGBA)) || (format == COMPRESSED_ASTC_4x4_RGBA))
+    {
+        dataSize = ((width + 3)/4)*((height + 3)/4)*bpp*2;     // Block size in bytes: 4*4*bpp/8
+    }
+    else if ((width < 4) && (height < 4))
     {
-        if ((format >= COMPRESSED_DXT1_RGB) && (format < COMPRESSED_DXT3_RGBA)) dataSize = 8;
-        else if ((format >= COMPRESSED_DXT3_RGBA) && (format < COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
+        // PVRT: if texture is smaller, minimum dataSize is 16
+        if ((format == COMPRESSED_PVRT_RGB) || (format == COMPRESSED_PVRT_RGBA)) dataSize = 16;
     }
 
     return dataSize;
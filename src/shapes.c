@@ -12,6 +12,10 @@
 *       Use QUADS instead of TRIANGLES for drawing when possible.
 *       Some lines-based shapes could still use lines
 *
+*   #define SUPPORT_INDEXED_DRAW_MODE
+*       Use indexed vertex data (rlIndex()) for fans and strips (circles, rings, polygons...),
+*       shared vertex are submitted only once. Not supported on OpenGL 1.1
+*
 *   LICENSE: zlib/libpng
 *
 *   Copyright (c) 2013-2021 Ramon Santamaria (@raysan5)
@@ -54,6 +58,11 @@
     #define SMOOTH_CIRCLE_ERROR_RATE  0.5f
 #endif
 
+// Indexed vertex data is not supported on OpenGL 1.1 immediate mode
+#if defined(GRAPHICS_API_OPENGL_11) && defined(SUPPORT_INDEXED_DRAW_MODE)
+    #undef SUPPORT_INDEXED_DRAW_MODE
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -68,6 +77,9 @@
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static float EaseCubicInOut(float t, float b, float c, float d);    // Cubic easing
+#if defined(SUPPORT_INDEXED_DRAW_MODE)
+static Vector2 GetShapesTexcoord(void);                             // Get shapes texture coordinates (center of shapes texture rectangle)
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -211,7 +223,7 @@ void DrawLineStrip(Vector2 *points, int pointsCount, Color color)
 {
     if (pointsCount >= 2)
     {
-        if (rlCheckBufferLimit(pointsCount)) rlglDraw();
+        rlCheckRenderBatchLimit(pointsCount);
 
         rlBegin(RL_LINES);
             rlColor4ub(color.r, color.g, color.b, color.a);
@@ -257,8 +269,39 @@ void DrawCircleSector(Vector2 center, float radius, int startAngle, int endAngle
     float stepLength = (float)(endAngle - startAngle)/(float)segments;
     float angle = (float)startAngle;
 
-#if defined(SUPPORT_QUADS_DRAW_MODE)
-    if (rlCheckBufferLimit(4*segments/2)) rlglDraw();
+#if defined(SUPPORT_INDEXED_DRAW_MODE)
+    rlCheckRenderBatchLimitEx(segments + 2, 3*segments);
+
+    Vector2 texcoord = GetShapesTexcoord();
+
+    rlEnableTexture(GetShapesTexture().id);
+
+    // NOTE: Triangle fan, center vertex is shared by all segments
+    rlBegin(RL_QUADS);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+
+        rlTexCoord2f(texcoord.x, texcoord.y);
+        rlVertex2f(center.x, center.y);
+
+        for (int i = 0; i <= segments; i++)
+        {
+            rlTexCoord2f(texcoord.x, texcoord.y);
+            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+
+            angle += stepLength;
+        }
+
+        for (int i = 0; i < segments; i++)
+        {
+            rlIndex(0);
+            rlIndex(i + 1);
+            rlIndex(i + 2);
+        }
+    rlEnd();
+
+    rlDisableTexture();
+#elif defined(SUPPORT_QUADS_DRAW_MODE)
+    rlCheckRenderBatchLimit(4*segments/2);
 
     rlEnableTexture(GetShapesTexture().id);
 
@@ -304,7 +347,7 @@ void DrawCircleSector(Vector2 center, float radius, int startAngle, int endAngle
 
     rlDisableTexture();
 #else
-    if (rlCheckBufferLimit(3*segments)) rlglDraw();
+    rlCheckRenderBatchLimit(3*segments);
 
     rlBegin(RL_TRIANGLES);
         for (int i = 0; i < segments; i++)
@@ -351,7 +394,7 @@ void DrawCircleSectorLines(Vector2 center, float radius, int startAngle, int end
     int limit = 2*(segments + 2);
     if ((endAngle - startAngle)%360 == 0) { limit = 2*segments; showCapLines = false; }
 
-    if (rlCheckBufferLimit(limit)) rlglDraw();
+    rlCheckRenderBatchLimit(limit);
 
     rlBegin(RL_LINES);
         if (showCapLines)
@@ -384,7 +427,7 @@ void DrawCircleSectorLines(Vector2 center, float radius, int startAngle, int end
 // NOTE: Gradient goes from center (color1) to border (color2)
 void DrawCircleGradient(int centerX, int centerY, float radius, Color color1, Color color2)
 {
-    if (rlCheckBufferLimit(3*36)) rlglDraw();
+    rlCheckRenderBatchLimit(3*36);
 
     rlBegin(RL_TRIANGLES);
         for (int i = 0; i < 360; i += 10)
@@ -409,7 +452,7 @@ void DrawCircleV(Vector2 center, float radius, Color color)
 // Draw circle outline
 void DrawCircleLines(int centerX, int centerY, float radius, Color color)
 {
-    if (rlCheckBufferLimit(2*36)) rlglDraw();
+    rlCheckRenderBatchLimit(2*36);
 
     rlBegin(RL_LINES);
         rlColor4ub(color.r, color.g, color.b, color.a);
@@ -426,7 +469,7 @@ void DrawCircleLines(int centerX, int centerY, float radius, Color color)
 // Draw ellipse
 void DrawEllipse(int centerX, int centerY, float radiusH, float radiusV, Color color)
 {
-    if (rlCheckBufferLimit(3*36)) rlglDraw();
+    rlCheckRenderBatchLimit(3*36);
 
     rlBegin(RL_TRIANGLES);
         for (int i = 0; i < 360; i += 10)
@@ -442,7 +485,7 @@ void DrawEllipse(int centerX, int centerY, float radiusH, float radiusV, Color c
 // Draw ellipse outline
 void DrawEllipseLines(int centerX, int centerY, float radiusH, float radiusV, Color color)
 {
-    if (rlCheckBufferLimit(2*36)) rlglDraw();
+    rlCheckRenderBatchLimit(2*36);
 
     rlBegin(RL_LINES);
         for (int i = 0; i < 360; i += 10)
@@ -496,8 +539,43 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, int startAng
     float stepLength = (float)(endAngle - startAngle)/(float)segments;
     float angle = (float)startAngle;
 
-#if defined(SUPPORT_QUADS_DRAW_MODE)
-    if (rlCheckBufferLimit(4*segments)) rlglDraw();
+#if defined(SUPPORT_INDEXED_DRAW_MODE)
+    rlCheckRenderBatchLimitEx(2*(segments + 1), 6*segments);
+
+    Vector2 texcoord = GetShapesTexcoord();
+
+    rlEnableTexture(GetShapesTexture().id);
+
+    // NOTE: Triangle strip, every segment shares its inner and outer vertex with the next one
+    rlBegin(RL_QUADS);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+
+        for (int i = 0; i <= segments; i++)
+        {
+            rlTexCoord2f(texcoord.x, texcoord.y);
+            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
+
+            rlTexCoord2f(texcoord.x, texcoord.y);
+            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
+
+            angle += stepLength;
+        }
+
+        for (int i = 0; i < segments; i++)
+        {
+            rlIndex(2*i);
+            rlIndex(2*i + 1);
+            rlIndex(2*i + 3);
+
+            rlIndex(2*i);
+            rlIndex(2*i + 3);
+            rlIndex(2*i + 2);
+        }
+    rlEnd();
+
+    rlDisableTexture();
+#elif defined(SUPPORT_QUADS_DRAW_MODE)
+    rlCheckRenderBatchLimit(4*segments);
 
     rlEnableTexture(GetShapesTexture().id);
 
@@ -524,7 +602,7 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, int startAng
 
     rlDisableTexture();
 #else
-    if (rlCheckBufferLimit(6*segments)) rlglDraw();
+    rlCheckRenderBatchLimit(6*segments);
 
     rlBegin(RL_TRIANGLES);
         for (int i = 0; i < segments; i++)
@@ -590,7 +668,7 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, int sta
     int limit = 4*(segments + 1);
     if ((endAngle - startAngle)%360 == 0) { limit = 4*segments; showCapLines = false; }
 
-    if (rlCheckBufferLimit(limit)) rlglDraw();
+    rlCheckRenderBatchLimit(limit);
 
     rlBegin(RL_LINES);
         if (showCapLines)
@@ -644,7 +722,7 @@ void DrawRectangleRec(Rectangle rec, Color color)
 // Draw a color-filled rectangle with pro parameters
 void DrawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color)
 {
-    if (rlCheckBufferLimit(4)) rlglDraw();
+    rlCheckRenderBatchLimit(4);
 
     rlEnableTexture(GetShapesTexture().id);
 
@@ -816,8 +894,63 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
     const Vector2 centers[4] = { point[8], point[9], point[10], point[11] };
     const float angles[4] = { 180.0f, 90.0f, 0.0f, 270.0f };
 
-#if defined(SUPPORT_QUADS_DRAW_MODE)
-    if (rlCheckBufferLimit(16*segments/2 + 5*4)) rlglDraw();
+#if defined(SUPPORT_INDEXED_DRAW_MODE)
+    rlCheckRenderBatchLimitEx(12 + 4*(segments + 1), 12*segments + 30);  // 12 points + 4 corners with (segments + 1) vertices each, 4 corners with 3 indices per segment + 5 rectangles with 6 indices each
+
+    Vector2 texcoord = GetShapesTexcoord();
+
+    rlEnableTexture(GetShapesTexture().id);
+
+    rlBegin(RL_QUADS);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+
+        // Points P0..P11 are vertex 0..11, shared by corners and rectangles
+        for (int i = 0; i < 12; i++)
+        {
+            rlTexCoord2f(texcoord.x, texcoord.y);
+            rlVertex2f(point[i].x, point[i].y);
+        }
+
+        // Draw all of the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
+        // NOTE: Every corner is a triangle fan around its center point (P8, P9, P10, P11)
+        for (int k = 0; k < 4; ++k)
+        {
+            float angle = angles[k];
+            const Vector2 center = centers[k];
+            int firstVertex = 12 + k*(segments + 1);
+
+            for (int i = 0; i <= segments; i++)
+            {
+                rlTexCoord2f(texcoord.x, texcoord.y);
+                rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+                angle += stepLength;
+            }
+
+            for (int i = 0; i < segments; i++)
+            {
+                rlIndex(8 + k);
+                rlIndex(firstVertex + i);
+                rlIndex(firstVertex + i + 1);
+            }
+        }
+
+        // [2] Upper Rectangle, [4] Right Rectangle, [6] Bottom Rectangle, [8] Left Rectangle, [9] Middle Rectangle
+        const int rects[5][4] = { { 0, 8, 9, 1 }, { 2, 9, 10, 3 }, { 11, 5, 4, 10 }, { 7, 6, 11, 8 }, { 8, 11, 10, 9 } };
+
+        for (int i = 0; i < 5; i++)
+        {
+            rlIndex(rects[i][0]);
+            rlIndex(rects[i][1]);
+            rlIndex(rects[i][2]);
+
+            rlIndex(rects[i][0]);
+            rlIndex(rects[i][2]);
+            rlIndex(rects[i][3]);
+        }
+    rlEnd();
+    rlDisableTexture();
+#elif defined(SUPPORT_QUADS_DRAW_MODE)
+    rlCheckRenderBatchLimit(16*segments/2 + 5*4);
 
     rlEnableTexture(GetShapesTexture().id);
 
@@ -914,7 +1047,7 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
     rlEnd();
     rlDisableTexture();
 #else
-    if (rlCheckBufferLimit(12*segments + 5*6)) rlglDraw(); // 4 corners with 3 vertices per segment + 5 rectangles with 6 vertices each
+    rlCheckRenderBatchLimit(12*segments + 5*6); // 4 corners with 3 vertices per segment + 5 rectangles with 6 vertices each
 
     rlBegin(RL_TRIANGLES);
         // Draw all of the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
@@ -1046,7 +1179,7 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, int
     if (lineThick > 1)
     {
 #if defined(SUPPORT_QUADS_DRAW_MODE)
-        if (rlCheckBufferLimit(4*4*segments + 4*4)) rlglDraw(); // 4 corners with 4 vertices for each segment + 4 rectangles with 4 vertices each
+        rlCheckRenderBatchLimit(4*4*segments + 4*4); // 4 corners with 4 vertices for each segment + 4 rectangles with 4 vertices each
 
         rlEnableTexture(GetShapesTexture().id);
 
@@ -1119,7 +1252,7 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, int
         rlEnd();
         rlDisableTexture();
 #else
-        if (rlCheckBufferLimit(4*6*segments + 4*6)) rlglDraw(); // 4 corners with 6(2*3) vertices for each segment + 4 rectangles with 6 vertices each
+        rlCheckRenderBatchLimit(4*6*segments + 4*6); // 4 corners with 6(2*3) vertices for each segment + 4 rectangles with 6 vertices each
 
         rlBegin(RL_TRIANGLES);
 
@@ -1186,7 +1319,7 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, int
     else
     {
         // Use LINES to draw the outline
-        if (rlCheckBufferLimit(8*segments + 4*2)) rlglDraw(); // 4 corners with 2 vertices for each segment + 4 rectangles with 2 vertices each
+        rlCheckRenderBatchLimit(8*segments + 4*2); // 4 corners with 2 vertices for each segment + 4 rectangles with 2 vertices each
 
         rlBegin(RL_LINES);
 
@@ -1221,7 +1354,7 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, int
 // NOTE: Vertex must be provided in counter-clockwise order
 void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color)
 {
-    if (rlCheckBufferLimit(4)) rlglDraw();
+    rlCheckRenderBatchLimit(4);
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlEnableTexture(GetShapesTexture().id);
@@ -1257,7 +1390,7 @@ void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color)
 // NOTE: Vertex must be provided in counter-clockwise order
 void DrawTriangleLines(Vector2 v1, Vector2 v2, Vector2 v3, Color color)
 {
-    if (rlCheckBufferLimit(6)) rlglDraw();
+    rlCheckRenderBatchLimit(6);
 
     rlBegin(RL_LINES);
         rlColor4ub(color.r, color.g, color.b, color.a);
@@ -1279,7 +1412,31 @@ void DrawTriangleFan(Vector2 *points, int pointsCount, Color color)
 {
     if (pointsCount >= 3)
     {
-        if (rlCheckBufferLimit((pointsCount - 2)*4)) rlglDraw();
+#if defined(SUPPORT_INDEXED_DRAW_MODE)
+        rlCheckRenderBatchLimitEx(pointsCount, 3*(pointsCount - 2));
+
+        Vector2 texcoord = GetShapesTexcoord();
+
+        rlEnableTexture(GetShapesTexture().id);
+        rlBegin(RL_QUADS);
+            rlColor4ub(color.r, color.g, color.b, color.a);
+
+            for (int i = 0; i < pointsCount; i++)
+            {
+                rlTexCoord2f(texcoord.x, texcoord.y);
+                rlVertex2f(points[i].x, points[i].y);
+            }
+
+            for (int i = 1; i < pointsCount - 1; i++)
+            {
+                rlIndex(0);
+                rlIndex(i);
+                rlIndex(i + 1);
+            }
+        rlEnd();
+        rlDisableTexture();
+#else
+        rlCheckRenderBatchLimit((pointsCount - 2)*4);
 
         rlEnableTexture(GetShapesTexture().id);
         rlBegin(RL_QUADS);
@@ -1301,6 +1458,7 @@ void DrawTriangleFan(Vector2 *points, int pointsCount, Color color)
             }
         rlEnd();
         rlDisableTexture();
+#endif
     }
 }
 
@@ -1310,7 +1468,40 @@ void DrawTriangleStrip(Vector2 *points, int pointsCount, Color color)
 {
     if (pointsCount >= 3)
     {
-        if (rlCheckBufferLimit(3*(pointsCount - 2))) rlglDraw();
+#if defined(SUPPORT_INDEXED_DRAW_MODE)
+        rlCheckRenderBatchLimitEx(pointsCount, 3*(pointsCount - 2));
+
+        Vector2 texcoord = GetShapesTexcoord();
+
+        rlEnableTexture(GetShapesTexture().id);
+        rlBegin(RL_QUADS);
+            rlColor4ub(color.r, color.g, color.b, color.a);
+
+            for (int i = 0; i < pointsCount; i++)
+            {
+                rlTexCoord2f(texcoord.x, texcoord.y);
+                rlVertex2f(points[i].x, points[i].y);
+            }
+
+            for (int i = 2; i < pointsCount; i++)
+            {
+                rlIndex(i);
+
+                if ((i%2) == 0)
+                {
+                    rlIndex(i - 2);
+                    rlIndex(i - 1);
+                }
+                else
+                {
+                    rlIndex(i - 1);
+                    rlIndex(i - 2);
+                }
+            }
+        rlEnd();
+        rlDisableTexture();
+#else
+        rlCheckRenderBatchLimit(3*(pointsCount - 2));
 
         rlBegin(RL_TRIANGLES);
             rlColor4ub(color.r, color.g, color.b, color.a);
@@ -1331,6 +1522,7 @@ void DrawTriangleStrip(Vector2 *points, int pointsCount, Color color)
                 }
             }
         rlEnd();
+#endif
     }
 }
 
@@ -1340,13 +1532,45 @@ void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color col
     if (sides < 3) sides = 3;
     float centralAngle = 0.0f;
 
-    if (rlCheckBufferLimit(4*(360/sides))) rlglDraw();
+#if defined(SUPPORT_INDEXED_DRAW_MODE)
+    rlCheckRenderBatchLimitEx(sides + 1, 3*sides);
+#else
+    rlCheckRenderBatchLimit(4*(360/sides));
+#endif
 
     rlPushMatrix();
         rlTranslatef(center.x, center.y, 0.0f);
         rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
 
-#if defined(SUPPORT_QUADS_DRAW_MODE)
+#if defined(SUPPORT_INDEXED_DRAW_MODE)
+        Vector2 texcoord = GetShapesTexcoord();
+
+        rlEnableTexture(GetShapesTexture().id);
+
+        // NOTE: Triangle fan, center and every side vertex are shared by adjacent triangles
+        rlBegin(RL_QUADS);
+            rlColor4ub(color.r, color.g, color.b, color.a);
+
+            rlTexCoord2f(texcoord.x, texcoord.y);
+            rlVertex2f(0, 0);
+
+            for (int i = 0; i < sides; i++)
+            {
+                rlTexCoord2f(texcoord.x, texcoord.y);
+                rlVertex2f(sinf(DEG2RAD*centralAngle)*radius, cosf(DEG2RAD*centralAngle)*radius);
+
+                centralAngle += 360.0f/(float)sides;
+            }
+
+            for (int i = 0; i < sides; i++)
+            {
+                rlIndex(0);
+                rlIndex(i + 1);
+                rlIndex((i + 1)%sides + 1);
+            }
+        rlEnd();
+        rlDisableTexture();
+#elif defined(SUPPORT_QUADS_DRAW_MODE)
         rlEnableTexture(GetShapesTexture().id);
 
         rlBegin(RL_QUADS);
@@ -1392,7 +1616,7 @@ void DrawPolyLines(Vector2 center, int sides, float radius, float rotation, Colo
     if (sides < 3) sides = 3;
     float centralAngle = 0.0f;
 
-    if (rlCheckBufferLimit(3*(360/sides))) rlglDraw();
+    rlCheckRenderBatchLimit(3*(360/sides));
 
     rlPushMatrix();
         rlTranslatef(center.x, center.y, 0.0f);
@@ -1602,3 +1826,15 @@ static float EaseCubicInOut(float t, float b, float c, float d)
 
     return 0.5f*c*(t*t*t + 2.0f) + b;
 }
+
+#if defined(SUPPORT_INDEXED_DRAW_MODE)
+// Get shapes texture coordinates (center of shapes texture rectangle)
+// NOTE: Indexed shapes share vertex between triangles, all of them use the same texcoord
+static Vector2 GetShapesTexcoord(void)
+{
+    Texture2D texture = GetShapesTexture();
+    Rectangle rec = GetShapesTextureRec();
+
+    return (Vector2){ (rec.x + rec.width/2.0f)/texture.width, (rec.y + rec.height/2.0f)/texture.height };
+}
+#endif
@@ -60,6 +60,7 @@
 #include <ctype.h>          // Requried for: toupper(), tolower() [Used in TextToUpper(), TextToLower()]
 
 #include "utils.h"          // Required for: LoadFileText()
+#include "rlgl.h"           // Required for: rlGetFrameStats()
 
 #if defined(SUPPORT_FILEFORMAT_TTF)
     #define STB_RECT_PACK_IMPLEMENTATION
@@ -83,11 +84,128 @@
 #ifndef MAX_TEXTSPLIT_COUNT
     #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: TextSplit()
 #endif
+#ifndef TEXT_LAYOUT_BATCH_GLYPHS
+    #define TEXT_LAYOUT_BATCH_GLYPHS             256        // Maximum glyphs drawn per vertex buffer check: DrawTextLayout()
+#endif
+#ifndef GLYPH_LOOKUP_PAGE_MIN_CHARS
+    #define GLYPH_LOOKUP_PAGE_MIN_CHARS            8        // Minimum characters in a 256 codepoints page to use a direct lookup page
+#endif
+
+#ifndef FONT_SDF_OVERSAMPLING
+    #define FONT_SDF_OVERSAMPLING                  3        // SDF font glyphs bitmap oversampling for distance transform generation
+#endif
+#ifndef FONT_CACHE_ATLAS_SIZE
+    #define FONT_CACHE_ATLAS_SIZE               1024        // Dynamic font glyphs cache atlas default size: LoadFontDynamic()
+#endif
+#ifndef FONT_CACHE_ATLAS_PAGES
+    #define FONT_CACHE_ATLAS_PAGES                 4        // Dynamic font glyphs cache atlas pages per side, glyphs evicted by page
+#endif
+#ifndef FONT_CACHE_UNCACHED_CHARS
+    #define FONT_CACHE_UNCACHED_CHARS           1024        // Dynamic font codepoints remembered as missing or not fitting atlas pages
+#endif
+
+#define GLYPH_LOOKUP_PAGES                      4352        // Unicode codepoints pages (0x110000/256)
+#define FONT_CACHE_FILE_VERSION                    1        // Font cache file format version: LoadFontCached()
+#define FONT_CACHE_MAX_ATLAS_SIZE              16384        // Font cache file max atlas width and height
+#define FONT_CACHE_MAX_CHARS_PADDING             256        // Font cache file max padding around characters
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Font cache file header, followed by characters data and atlas pixels data
+typedef struct FontCacheHeader {
+    char id[4];                 // Font cache file identifier: "rFNC"
+    int version;                // Font cache file format version
+    unsigned long long key;     // Font cache key: font file data, size, charset and type hash
+    int baseSize;               // Font base size
+    int charsCount;             // Number of characters
+    int charsPadding;           // Padding around characters in atlas
+    int atlasWidth;             // Atlas image width
+    int atlasHeight;            // Atlas image height
+    int atlasFormat;            // Atlas image pixel format
+} FontCacheHeader;
+
+// Font cache file character data
+typedef struct FontCacheChar {
+    int value;                  // Character value (Unicode)
+    int offsetX;                // Character offset X when drawing
+    int offsetY;                // Character offset Y when drawing
+    int advanceX;               // Character advance position X
+    Rectangle rec;              // Character rectangle in atlas
+} FontCacheChar;
+
+// Font characters glyphs rasterization job data
+typedef struct FontDataJob {
+    const stbtt_fontinfo *fontInfo;     // TTF font info (copied by every band)
+    const int *fontChars;               // Characters codepoints
+    CharInfo *chars;                    // Characters info output
+    int fontSize;                       // Font size
+    float scaleFactor;                  // Font scale factor for size
+    int ascent;                         // Font ascent (unscaled)
+    int type;                           // Font type: FONT_DEFAULT, FONT_BITMAP, FONT_SDF
+} FontDataJob;
+
+// Dynamic font glyphs cache atlas shelf, glyphs packed left to right
+typedef struct GlyphCacheShelf {
+    int y;                      // Shelf position Y in page
+    int height;                 // Shelf height
+    int offsetX;                // Next glyph position X in shelf
+} GlyphCacheShelf;
+
+// Dynamic font glyphs cache atlas page, glyphs packed in shelves and evicted together
+typedef struct GlyphCachePage {
+    int x;                      // Page position X in atlas
+    int y;                      // Page position Y in atlas
+    int nextY;                  // Next shelf position Y in page
+    int shelvesCount;           // Number of shelves in page
+    GlyphCacheShelf *shelves;   // Page shelves
+    unsigned int lastUsed;      // Last use tick of any page glyph (for LRU eviction)
+} GlyphCachePage;
+
+// Dynamic font glyphs cache, glyphs rasterized on demand from TTF data
+// NOTE: Font chars, recs and texture point to cache slots, slot 0 is kept empty
+typedef struct GlyphCache {
+    stbtt_fontinfo fontInfo;    // TTF font info (requires font data kept loaded)
+    unsigned char *fontData;    // TTF font data
+    bool fontDataMapped;        // TTF font data loaded with LoadFileDataMapped()
+    float scaleFactor;          // Font scale factor for base size
+    int ascent;                 // Font ascent scaled to base size
+    int padding;                // Padding around glyphs in atlas
+
+    Texture2D texture;          // Glyphs atlas texture (shared with font)
+    CharInfo *chars;            // Characters slots info (shared with font)
+    Rectangle *recs;            // Characters slots rectangles (shared with font)
+    int charsCount;             // Number of characters slots
+    int *charsPage;             // Atlas page of every character slot (-1 if slot is free)
+    int *freeSlots;             // Free characters slots stack
+    int freeSlotsCount;         // Number of free characters slots
+
+    int hashSize;               // Cached codepoints hash table size (power of two)
+    int *hashCodepoints;        // Hash table codepoints (-1 on empty slots)
+    int *hashIndices;           // Hash table characters slots (0 if glyph can not be cached, -1 if codepoint not available)
+    int hashUncachedCount;      // Hash table entries of codepoints without character slot (no atlas page)
+
+    int pageSize;               // Atlas page size
+    int pagesCount;             // Number of atlas pages
+    GlyphCachePage *pages;      // Atlas pages
+    unsigned int useCounter;    // Glyphs use tick counter
+} GlyphCache;
+#else
+typedef struct GlyphCache GlyphCache;
+#endif
+
+// Font codepoints to characters index lookup
+// NOTE: Codepoints are grouped in pages of 256 codepoints, pages with enough characters use
+// a direct index array, characters of sparse pages are stored in an open-addressing hash table
+typedef struct GlyphLookup {
+    unsigned short pages[GLYPH_LOOKUP_PAGES];   // Direct page slot + 1 for every codepoints page (0 if page is not direct)
+    int *pageIndices;                           // Direct pages characters indices (256 per page, -1 if not available)
+    int hashSize;                               // Hash table size (power of two, 0 if not used)
+    int *hashCodepoints;                        // Hash table codepoints (-1 on empty slots)
+    int *hashIndices;                           // Hash table characters indices
+    GlyphCache *cache;                          // Glyphs cache (dynamic fonts only, lookup tables not used)
+} GlyphLookup;
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -98,6 +216,8 @@
 static Font defaultFont = { 0 };
 #endif
 
+static int fontThreads = 1;     // Threads used to rasterize font glyphs on loading (1 means serial processing)
+
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
 //----------------------------------------------------------------------------------
@@ -109,6 +229,31 @@ static Font defaultFont = { 0 };
 #if defined(SUPPORT_FILEFORMAT_FNT)
 static Font LoadBMFont(const char *fileName);     // Load a BMFont file (AngelCode font file)
 #endif
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static Font LoadFontCache(const char *fileName, unsigned long long key);                 // Load font from font cache file (if key matches)
+static bool ExportFontCache(Font font, const char *fileName, unsigned long long key);    // Export font to font cache file
+static unsigned long long GetFontCacheKey(const unsigned char *fileData, unsigned int dataSize, int fontSize, const int *fontChars, int charsCount, int type);    // Get font cache key
+#endif
+static GlyphLookup *LoadGlyphLookup(const CharInfo *chars, int charsCount);   // Load codepoints to characters index lookup
+static void UnloadGlyphLookup(GlyphLookup *lookup);                             // Unload codepoints to characters index lookup
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static void LoadFontDataBand(void *data, int start, int end);    // Font glyphs rasterization job: characters band
+#if defined(SUPPORT_FONT_SDF_DISTANCE_TRANSFORM)
+static unsigned char *LoadGlyphSDF(const stbtt_fontinfo *fontInfo, float scale, int codepoint, int padding, unsigned char onEdgeValue, float pixelDistScale, int *width, int *height, int *offsetX, int *offsetY);  // Load glyph SDF using distance transform
+static void DistanceTransform(float *grid, int *sources, int width, int height);      // Compute squared euclidean distance and nearest source transform (in-place)
+static void DistanceTransform1D(const float *f, const int *fs, float *d, int *ds, int *v, float *z, int n);    // Compute 1D squared distance transform
+#endif
+static Font LoadFontDynamicData(unsigned char *fontData, bool fontDataMapped, int fontSize, int atlasSize);    // Load dynamic font from TTF data (data owned by font)
+static void UnloadGlyphCache(GlyphCache *cache);                                 // Unload glyphs cache (including TTF font data)
+static int GetGlyphCacheIndex(GlyphCache *cache, int codepoint);                 // Get glyphs cache character slot for codepoint, rasterized if not cached
+static int LoadGlyphCacheChar(GlyphCache *cache, int codepoint);                 // Rasterize codepoint glyph into glyphs cache atlas
+static bool PackGlyphCachePage(GlyphCachePage *page, int pageSize, int width, int height, int *x, int *y);    // Pack rectangle into page shelves
+static void EvictGlyphCachePage(GlyphCache *cache, int page);                    // Evict all page glyphs from glyphs cache
+static int GetGlyphCacheLRUPage(GlyphCache *cache, bool used);                   // Get least recently used glyphs cache page (optionally only pages holding glyphs)
+static void InsertGlyphCacheHash(GlyphCache *cache, int codepoint, int index);   // Insert codepoint into glyphs cache hash table
+static void RemoveGlyphCacheHash(GlyphCache *cache, int codepoint);              // Remove codepoint from glyphs cache hash table
+#endif
 
 #if defined(SUPPORT_DEFAULT_FONT)
 extern void LoadFontDefault(void);
@@ -265,6 +410,7 @@ extern void LoadFontDefault(void)
     UnloadImage(imFont);
 
     defaultFont.baseSize = (int)defaultFont.recs[0].height;
+    defaultFont.glyphLookup = LoadGlyphLookup(defaultFont.chars, defaultFont.charsCount);
 
     TRACELOG(LOG_INFO, "FONT: Default font loaded successfully");
 }
@@ -276,6 +422,7 @@ extern void UnloadFontDefault(void)
     UnloadTexture(defaultFont.texture);
     RL_FREE(defaultFont.chars);
     RL_FREE(defaultFont.recs);
+    UnloadGlyphLookup((GlyphLookup *)defaultFont.glyphLookup);
 }
 #endif      // SUPPORT_DEFAULT_FONT
 
@@ -356,6 +503,39 @@ Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int charsCou
     return font;
 }
 
+// Load Font from TTF font file using a font cache file, skipping glyphs rasterization if cache is valid
+// NOTE: Cache is generated (or regenerated) when font file, size or charset do not match cache
+Font LoadFontCached(const char *fileName, int fontSize, int *fontChars, int charsCount, const char *cacheFileName)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    unsigned int fileSize = 0;
+    unsigned char *fileData = LoadFileDataMapped(fileName, &fileSize);
+
+    if (fileData != NULL)
+    {
+        unsigned long long key = GetFontCacheKey(fileData, fileSize, fontSize, fontChars, charsCount, FONT_DEFAULT);
+
+        font = LoadFontCache(cacheFileName, key);
+
+        if (font.texture.id == 0)
+        {
+            font = LoadFontFromMemory(GetFileExtension(fileName), fileData, fileSize, fontSize, fontChars, charsCount);
+
+            if ((font.texture.id > 0) && (font.texture.id != GetFontDefault().texture.id)) ExportFontCache(font, cacheFileName, key);
+        }
+
+        UnloadFileDataMapped(fileData);
+    }
+    else font = GetFontDefault();
+#else
+    font = LoadFontEx(fileName, fontSize, fontChars, charsCount);
+#endif
+
+    return font;
+}
+
 // Load an Image font file (XNA style)
 Font LoadFontFromImage(Image image, Color key, int firstChar)
 {
@@ -475,6 +655,7 @@ Font LoadFontFromImage(Image image, Color key, int firstChar)
     UnloadImage(fontClear);     // Unload processed image once converted to texture
 
     font.baseSize = (int)font.recs[0].height;
+    font.glyphLookup = LoadGlyphLookup(font.chars, font.charsCount);
 
     return font;
 }
@@ -511,6 +692,8 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
             }
 
             UnloadImage(atlas);
+
+            font.glyphLookup = LoadGlyphLookup(font.chars, font.charsCount);
         }
         else font = GetFontDefault();
     }
@@ -521,6 +704,76 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     return font;
 }
 
+// Load font with glyphs rasterized on demand into a glyphs cache atlas of atlasSize (0 for default)
+// NOTE: TTF font data is kept loaded (memory mapped if supported) while font is in use,
+// least recently used atlas pages are evicted when no space is left for new glyphs
+// WARNING: Font must be used from the main thread with an active OpenGL context (check GetGlyphIndex())
+Font LoadFontDynamic(const char *fileName, int fontSize, int atlasSize)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (IsFileExtension(fileName, ".ttf;.otf"))
+    {
+        unsigned int fileSize = 0;
+        unsigned char *fileData = LoadFileDataMapped(fileName, &fileSize);
+
+        if (fileData != NULL)
+        {
+            font = LoadFontDynamicData(fileData, true, fontSize, atlasSize);
+            if (font.texture.id == 0) UnloadFileDataMapped(fileData);
+        }
+    }
+#endif
+
+    if (font.texture.id == 0)
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load dynamic font -> Using default font", fileName);
+        font = GetFontDefault();
+    }
+
+    return font;
+}
+
+// Load dynamic font from memory buffer, fileType refers to extension: i.e. "ttf"
+// NOTE: Font data is copied, provided buffer can be freed after loading
+Font LoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int atlasSize)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    char fileExtLower[16] = { 0 };
+    strcpy(fileExtLower, TextToLower(fileType));
+
+    if ((fileData != NULL) && (dataSize > 0) && (TextIsEqual(fileExtLower, "ttf") || TextIsEqual(fileExtLower, "otf")))
+    {
+        unsigned char *fontData = (unsigned char *)RL_MALLOC(dataSize);
+        memcpy(fontData, fileData, dataSize);
+
+        font = LoadFontDynamicData(fontData, false, fontSize, atlasSize);
+        if (font.texture.id == 0) RL_FREE(fontData);
+    }
+#endif
+
+    if (font.texture.id == 0) font = GetFontDefault();
+
+    return font;
+}
+
+// Set threads used to rasterize font glyphs on loading (1 means serial processing)
+// NOTE: Characters are split in bands, loaded font data is the same as serial processing
+// NOTE: Default is 1, parallel loading is opt-in (caller should choose threads count, i.e. available cores)
+void SetFontLoadingThreads(int count)
+{
+    if (count < 1) count = 1;
+
+#if !defined(SUPPORT_THREADS)
+    if (count > 1) TRACELOG(LOG_WARNING, "FONT: Threads support not enabled, font loading is serial");
+#endif
+
+    fontThreads = count;
+}
+
 // Load font data for further use
 // NOTE: Requires TTF font memory data and can generate SDF data
 CharInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int charsCount, int type)
@@ -573,69 +826,12 @@ CharInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize
                 genFontChars = true;
             }
 
-            chars = (CharInfo *)RL_MALLOC(charsCount*sizeof(CharInfo));
-
-            // NOTE: Using simple packaging, one char after another
-            for (int i = 0; i < charsCount; i++)
-            {
-                int chw = 0, chh = 0;   // Character width and height (on generation)
-                int ch = fontChars[i];  // Character value to get info for
-                chars[i].value = ch;
-
-                //  Render a unicode codepoint to a bitmap
-                //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
-                //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
-                //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
-
-                if (type != FONT_SDF) chars[i].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
-                else if (ch != 32) chars[i].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
-                else chars[i].image.data = NULL;
-
-                stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                // Load characters images
-                chars[i].image.width = chw;
-                chars[i].image.height = chh;
-                chars[i].image.mipmaps = 1;
-                chars[i].image.format = UNCOMPRESSED_GRAYSCALE;
-
-                chars[i].offsetY += (int)((float)ascent*scaleFactor);
-
-                // NOTE: We create an empty image for space character, it could be further required for atlas packing
-                if (ch == 32)
-                {
-                    Image imSpace = {
-                        .data = calloc(chars[i].advanceX*fontSize, 2),
-                        .width = chars[i].advanceX,
-                        .height = fontSize,
-                        .format = UNCOMPRESSED_GRAYSCALE,
-                        .mipmaps = 1
-                    };
-
-                    chars[i].image = imSpace;
-                }
-
-                if (type == FONT_BITMAP)
-                {
-                    // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
-                    // NOTE: For optimum results, bitmap font should be generated at base pixel size
-                    for (int p = 0; p < chw*chh; p++)
-                    {
-                        if (((unsigned char *)chars[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
-                        else ((unsigned char *)chars[i].image.data)[p] = 255;
-                    }
-                }
-
-                // Get bounding box for character (may be offset to account for chars that dip above or below the line)
-                /*
-                int chX1, chY1, chX2, chY2;
-                stbtt_GetCodepointBitmapBox(&fontInfo, ch, scaleFactor, scaleFactor, &chX1, &chY1, &chX2, &chY2);
+            chars = (CharInfo *)RL_CALLOC(charsCount, sizeof(CharInfo));
 
-                TRACELOGD("FONT: Character box measures: %i, %i, %i, %i", chX1, chY1, chX2 - chX1, chY2 - chY1);
-                TRACELOGD("FONT: Character offsetY: %i", (int)((float)ascent*scaleFactor) + chY1);
-                */
-            }
+            // Rasterize characters glyphs, split in bands across font loading threads
+            // NOTE: Every glyph is processed independently, results do not depend on threads count
+            FontDataJob job = { &fontInfo, fontChars, chars, fontSize, scaleFactor, ascent, type };
+            RunParallelJob(LoadFontDataBand, &job, charsCount, fontThreads);
         }
         else TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
 
@@ -808,6 +1004,7 @@ void UnloadFont(Font font)
         UnloadFontData(font.chars, font.charsCount);
         UnloadTexture(font.texture);
         RL_FREE(font.recs);
+        UnloadGlyphLookup((GlyphLookup *)font.glyphLookup);
 
         TRACELOGD("FONT: Unloaded font data from RAM and VRAM");
     }
@@ -820,6 +1017,18 @@ void DrawFPS(int posX, int posY)
     DrawText(TextFormat("%2i FPS", GetFPS()), posX, posY, 20, LIME);
 }
 
+// Shows last frame rendering statistics (draw calls, vertices, batch flushes, uploads, state changes)
+// NOTE: Uses default font, statistics are only available on OpenGL 3.3+ and ES2
+void DrawFrameStats(int posX, int posY)
+{
+    FrameStats stats = rlGetFrameStats();
+
+    DrawText(TextFormat("DRAW CALLS: %i  VERTICES: %i  MESHES: %i", stats.drawCalls, stats.vertices, stats.meshDraws), posX, posY, 10, LIME);
+    DrawText(TextFormat("FLUSHES: explicit %i  buffer %i  draws %i  texture %i", stats.flushes[RL_FLUSH_EXPLICIT], stats.flushes[RL_FLUSH_BUFFER_FULL],
+             stats.flushes[RL_FLUSH_DRAWCALLS_LIMIT], stats.flushes[RL_FLUSH_TEXTURE_CHANGE]), posX, posY + 12, 10, LIME);
+    DrawText(TextFormat("UPLOADED: %.2f KB  TEXTURE BINDS: %i  SHADER SWITCHES: %i", (float)stats.bytesUploaded/1024.0f, stats.textureBinds, stats.shaderSwitches), posX, posY + 24, 10, LIME);
+}
+
 // Draw text (using default font)
 // NOTE: fontSize work like in any drawing program but if fontSize is lower than font-base-size, then font-base-size is used
 // NOTE: chars spacing is proportional to fontSize
@@ -1043,6 +1252,239 @@ void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSiz
     DrawTexturePro(font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
 }
 
+// Load text layout, glyphs positioned once with lines wrapped at wrapWidth (0 for no wrapping)
+// NOTE: Glyphs placement is the same as DrawTextEx(), words are moved to next line if not fitting
+// wrapWidth, words longer than wrapWidth are broken by characters
+TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing, float wrapWidth)
+{
+    TextLayout layout = { 0 };
+    int length = (int)TextLength(text); // Total length in bytes of the text, scanned by codepoints
+
+    layout.font = font;
+    layout.fontSize = fontSize;
+    layout.spacing = spacing;
+    layout.wrapWidth = wrapWidth;
+
+    // NOTE: Empty text (or too long to be indexed) layout does not allocate any data
+    if (length <= 0) return layout;
+
+    layout.text = (char *)RL_MALLOC((size_t)length + 1);
+    memcpy(layout.text, text, (size_t)length + 1);
+
+    if ((font.chars == NULL) || (font.baseSize <= 0)) return layout;
+
+    float scaleFactor = fontSize/font.baseSize;     // Character quad scaling factor
+    int lineHeight = (int)((font.baseSize + font.baseSize/2)*scaleFactor);     // NOTE: Fixed line spacing of 1.5 line-height, same as DrawTextEx()
+
+    // Decode text codepoints and get glyphs advances
+    int *codepoints = (int *)RL_MALLOC((size_t)length*sizeof(int));
+    float *advances = (float *)RL_MALLOC((size_t)length*sizeof(float));
+    bool *breaks = (bool *)RL_CALLOC((size_t)length, sizeof(bool));     // Line break before glyph (wrapping)
+    int count = 0;
+
+    for (int i = 0; i < length;)
+    {
+        int codepointByteCount = 0;
+        int codepoint = GetNextCodepoint(&text[i], &codepointByteCount);
+        int index = GetGlyphIndex(font, codepoint);
+
+        // NOTE: Normally we exit the decoding sequence as soon as a bad byte is found (and return 0x3f)
+        // but we need to draw all of the bad bytes using the '?' symbol moving one byte
+        if (codepoint == 0x3f) codepointByteCount = 1;
+
+        codepoints[count] = codepoint;
+
+        if (codepoint == '\n') advances[count] = 0.0f;
+        else if (font.chars[index].advanceX == 0) advances[count] = (float)font.recs[index].width*scaleFactor + spacing;
+        else advances[count] = (float)font.chars[index].advanceX*scaleFactor + spacing;
+
+        count++;
+        i += codepointByteCount;
+    }
+
+    // Compute lines wrapping, break at last space fitting line or at character if no space available
+    if (wrapWidth > 0.0f)
+    {
+        float lineWidth = 0.0f;
+        float widthAfterSpace = 0.0f;
+        int lineStart = 0;
+        int lastSpace = -1;
+
+        for (int g = 0; g < count; g++)
+        {
+            bool space = ((codepoints[g] == ' ') || (codepoints[g] == '\t'));
+
+            if (codepoints[g] == '\n')
+            {
+                lineWidth = 0.0f;
+                lineStart = g + 1;
+                lastSpace = -1;
+                continue;
+            }
+
+            // NOTE: Spaces are allowed to overflow line, they are not drawn
+            if (!space && (g > lineStart) && ((lineWidth + advances[g] - spacing) > wrapWidth))
+            {
+                if (lastSpace >= lineStart)
+                {
+                    breaks[lastSpace + 1] = true;
+                    lineStart = lastSpace + 1;
+                    lineWidth -= widthAfterSpace;
+                }
+
+                if ((g > lineStart) && ((lineWidth + advances[g] - spacing) > wrapWidth))
+                {
+                    breaks[g] = true;
+                    lineStart = g;
+                    lineWidth = 0.0f;
+                }
+
+                lastSpace = -1;
+            }
+
+            lineWidth += advances[g];
+
+            if (space)
+            {
+                lastSpace = g;
+                widthAfterSpace = lineWidth;
+            }
+        }
+    }
+
+    // Position glyphs quads, same as DrawTextCodepoint()
+    layout.codepoints = (int *)RL_MALLOC((size_t)count*sizeof(int));
+    layout.srcRecs = (Rectangle *)RL_MALLOC((size_t)count*sizeof(Rectangle));
+    layout.dstRecs = (Rectangle *)RL_MALLOC((size_t)count*sizeof(Rectangle));
+
+    float padding = (float)font.charsPadding;
+    float textOffsetX = 0.0f;       // Offset X to next character to draw
+    int textOffsetY = 0;            // Offset between lines (on line break '\n' or wrapping)
+
+    for (int g = 0; g < count; g++)
+    {
+        int codepoint = codepoints[g];
+
+        if ((codepoint == '\n') || breaks[g])
+        {
+            textOffsetY += lineHeight;
+            textOffsetX = 0.0f;
+
+            if (codepoint == '\n') continue;
+        }
+
+        bool space = ((codepoint == ' ') || (codepoint == '\t'));
+
+        if (!space)
+        {
+            int index = GetGlyphIndex(font, codepoint);
+            Rectangle rec = font.recs[index];
+
+            layout.codepoints[layout.glyphsCount] = codepoint;
+            layout.srcRecs[layout.glyphsCount] = (Rectangle){ rec.x - padding, rec.y - padding, rec.width + 2.0f*padding, rec.height + 2.0f*padding };
+            layout.dstRecs[layout.glyphsCount] = (Rectangle){ textOffsetX + font.chars[index].offsetX*scaleFactor - padding*scaleFactor,
+                                                              textOffsetY + font.chars[index].offsetY*scaleFactor - padding*scaleFactor,
+                                                              (rec.width + 2.0f*padding)*scaleFactor, (rec.height + 2.0f*padding)*scaleFactor };
+            layout.glyphsCount++;
+        }
+
+        textOffsetX += advances[g];
+
+        // NOTE: Spaces overflowing a wrapped line are not measured
+        if (!(space && ((g + 1) < count) && breaks[g + 1]) && ((textOffsetX - spacing) > layout.size.x)) layout.size.x = textOffsetX - spacing;
+    }
+
+    layout.size.y = (float)textOffsetY + font.baseSize*scaleFactor;
+
+    RL_FREE(breaks);
+    RL_FREE(advances);
+    RL_FREE(codepoints);
+
+    return layout;
+}
+
+// Update text layout if any input changed, returns true if layout was rebuilt
+bool UpdateTextLayout(TextLayout *layout, Font font, const char *text, float fontSize, float spacing, float wrapWidth)
+{
+    // NOTE: Empty text layouts keep text as NULL
+    if ((layout->font.texture.id == font.texture.id) && (layout->font.chars == font.chars) &&
+        (layout->font.baseSize == font.baseSize) && (layout->fontSize == fontSize) && (layout->spacing == spacing) &&
+        (layout->wrapWidth == wrapWidth) && (strcmp((layout->text != NULL)? layout->text : "", (text != NULL)? text : "") == 0)) return false;
+
+    UnloadTextLayout(*layout);
+    *layout = LoadTextLayout(font, text, fontSize, spacing, wrapWidth);
+
+    return true;
+}
+
+// Unload text layout data
+void UnloadTextLayout(TextLayout layout)
+{
+    RL_FREE(layout.text);
+    RL_FREE(layout.codepoints);
+    RL_FREE(layout.srcRecs);
+    RL_FREE(layout.dstRecs);
+}
+
+// Draw text layout, glyphs quads are pushed directly to internal render batch
+// NOTE: Glyphs of dynamic fonts are drawn one by one, refreshing glyphs rectangles
+// (glyphs could be evicted from cache and rasterized again, flushing the render batch)
+void DrawTextLayout(TextLayout layout, Vector2 position, Color tint)
+{
+    if ((layout.font.texture.id == 0) || (layout.glyphsCount == 0)) return;
+
+    GlyphLookup *lookup = (GlyphLookup *)layout.font.glyphLookup;
+    bool dynamic = ((lookup != NULL) && (lookup->cache != NULL));
+
+    int batchGlyphs = dynamic? 1 : TEXT_LAYOUT_BATCH_GLYPHS;
+    float width = (float)layout.font.texture.width;
+    float height = (float)layout.font.texture.height;
+    float padding = (float)layout.font.charsPadding;
+
+    for (int i = 0; i < layout.glyphsCount; i += batchGlyphs)
+    {
+        int end = ((i + batchGlyphs) < layout.glyphsCount)? (i + batchGlyphs) : layout.glyphsCount;
+
+        if (dynamic)
+        {
+            Rectangle rec = layout.font.recs[GetGlyphIndex(layout.font, layout.codepoints[i])];
+            layout.srcRecs[i] = (Rectangle){ rec.x - padding, rec.y - padding, rec.width + 2.0f*padding, rec.height + 2.0f*padding };
+        }
+
+        rlCheckRenderBatchLimit(4*(end - i));
+
+        rlEnableTexture(layout.font.texture.id);
+
+        rlBegin(RL_QUADS);
+            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+            rlNormal3f(0.0f, 0.0f, 1.0f);      // Normal vector pointing towards viewer
+
+            for (int g = i; g < end; g++)
+            {
+                Rectangle src = layout.srcRecs[g];
+                Rectangle dst = layout.dstRecs[g];
+
+                dst.x += position.x;
+                dst.y += position.y;
+
+                rlTexCoord2f(src.x/width, src.y/height);
+                rlVertex2f(dst.x, dst.y);
+
+                rlTexCoord2f(src.x/width, (src.y + src.height)/height);
+                rlVertex2f(dst.x, dst.y + dst.height);
+
+                rlTexCoord2f((src.x + src.width)/width, (src.y + src.height)/height);
+                rlVertex2f(dst.x + dst.width, dst.y + dst.height);
+
+                rlTexCoord2f((src.x + src.width)/width, src.y/height);
+                rlVertex2f(dst.x + dst.width, dst.y);
+            }
+        rlEnd();
+    }
+
+    rlDisableTexture();
+}
+
 // Measure string width for default font
 int MeasureText(const char *text, int fontSize)
 {
@@ -1116,12 +1558,49 @@ Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing
 }
 
 // Returns index position for a unicode character on spritefont
+// WARNING: Dynamic fonts rasterize glyphs on lookup, uploading them to atlas texture (UpdateTextureRec()) and
+// drawing batched quads on page eviction (rlglDraw()), so they must be used from the main thread with an active
+// OpenGL context, also through MeasureTextEx() or LoadTextLayout(); returned index is only valid until next lookup
 int GetGlyphIndex(Font font, int codepoint)
 {
 #ifndef GLYPH_NOTFOUND_CHAR_FALLBACK
     #define GLYPH_NOTFOUND_CHAR_FALLBACK     63      // Character used if requested codepoint is not found: '?'
 #endif
 
+    GlyphLookup *lookup = (GlyphLookup *)font.glyphLookup;
+
+    // Use codepoints lookup if available (fonts loaded by raylib)
+    if (lookup != NULL)
+    {
+#if defined(SUPPORT_FILEFORMAT_TTF)
+        // Dynamic fonts get glyphs from cache, rasterized on first use
+        if (lookup->cache != NULL) return GetGlyphCacheIndex(lookup->cache, codepoint);
+#endif
+        int index = -1;
+
+        if ((codepoint >= 0) && (codepoint < GLYPH_LOOKUP_PAGES*256) && (lookup->pages[codepoint >> 8] > 0))
+        {
+            index = lookup->pageIndices[(lookup->pages[codepoint >> 8] - 1)*256 + (codepoint & 0xff)];
+        }
+        else if (lookup->hashSize > 0)
+        {
+            unsigned int slot = ((unsigned int)codepoint*2654435761u) & (lookup->hashSize - 1);
+
+            while (lookup->hashCodepoints[slot] != -1)
+            {
+                if (lookup->hashCodepoints[slot] == codepoint)
+                {
+                    index = lookup->hashIndices[slot];
+                    break;
+                }
+
+                slot = (slot + 1) & (lookup->hashSize - 1);
+            }
+        }
+
+        return (index >= 0)? index : GLYPH_NOTFOUND_CHAR_FALLBACK;
+    }
+
 // Support charsets with any characters order
 #define SUPPORT_UNORDERED_CHARSET
 #if defined(SUPPORT_UNORDERED_CHARSET)
@@ -1708,37 +2187,802 @@ int GetNextCodepoint(const char *text, int *bytesProcessed)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
-#if defined(SUPPORT_FILEFORMAT_FNT)
-
-// Read a line from memory
-// NOTE: Returns the number of bytes read
-static int GetLine(const char *origin, char *buffer, int maxLength)
+// Load codepoints to characters index lookup
+// NOTE: Duplicated codepoints keep first character index (same as linear search)
+static GlyphLookup *LoadGlyphLookup(const CharInfo *chars, int charsCount)
 {
-    int count = 0;
-    for (; count < maxLength; count++) if (origin[count] == '\n') break;
-    memcpy(buffer, origin, count);
-    return count;
-}
+    if ((chars == NULL) || (charsCount <= 0)) return NULL;
 
-// Load a BMFont file (AngelCode font file)
-// REQUIRES: strstr(), sscanf(), strrchr(), memcpy()
-static Font LoadBMFont(const char *fileName)
-{
-    #define MAX_BUFFER_SIZE     256
+    GlyphLookup *lookup = (GlyphLookup *)RL_CALLOC(1, sizeof(GlyphLookup));
+    int *pageCounts = (int *)RL_CALLOC(GLYPH_LOOKUP_PAGES, sizeof(int));
+    int directPages = 0;
+    int hashedCount = 0;
 
-    Font font = { 0 };
+    for (int i = 0; i < charsCount; i++)
+    {
+        int codepoint = chars[i].value;
+        if ((codepoint >= 0) && (codepoint < GLYPH_LOOKUP_PAGES*256)) pageCounts[codepoint >> 8]++;
+    }
 
-    char buffer[MAX_BUFFER_SIZE] = { 0 };
-    char *searchPoint = NULL;
+    for (int page = 0; page < GLYPH_LOOKUP_PAGES; page++)
+    {
+        if (pageCounts[page] >= GLYPH_LOOKUP_PAGE_MIN_CHARS)
+        {
+            directPages++;
+            lookup->pages[page] = (unsigned short)directPages;
+        }
+    }
 
-    int fontSize = 0;
-    int charsCount = 0;
+    if (directPages > 0)
+    {
+        lookup->pageIndices = (int *)RL_MALLOC(directPages*256*sizeof(int));
+        for (int i = 0; i < directPages*256; i++) lookup->pageIndices[i] = -1;
+    }
 
-    int imWidth = 0;
-    int imHeight = 0;
-    char imFileName[129];
+    for (int i = 0; i < charsCount; i++)
+    {
+        int codepoint = chars[i].value;
+        if ((codepoint < 0) || (codepoint >= GLYPH_LOOKUP_PAGES*256) || (lookup->pages[codepoint >> 8] == 0)) hashedCount++;
+    }
 
-    int base = 0;   // Useless data
+    if (hashedCount > 0)
+    {
+        lookup->hashSize = 1;
+        while (lookup->hashSize < hashedCount*2) lookup->hashSize <<= 1;
+
+        lookup->hashCodepoints = (int *)RL_MALLOC(lookup->hashSize*sizeof(int));
+        lookup->hashIndices = (int *)RL_MALLOC(lookup->hashSize*sizeof(int));
+        for (int i = 0; i < lookup->hashSize; i++) lookup->hashCodepoints[i] = -1;
+    }
+
+    for (int i = 0; i < charsCount; i++)
+    {
+        int codepoint = chars[i].value;
+
+        if ((codepoint >= 0) && (codepoint < GLYPH_LOOKUP_PAGES*256) && (lookup->pages[codepoint >> 8] > 0))
+        {
+            int *index = &lookup->pageIndices[(lookup->pages[codepoint >> 8] - 1)*256 + (codepoint & 0xff)];
+            if (*index < 0) *index = i;
+        }
+        else if (codepoint != -1)   // NOTE: -1 marks empty hash slots, it can not be looked up
+        {
+            unsigned int slot = ((unsigned int)codepoint*2654435761u) & (lookup->hashSize - 1);
+
+            while ((lookup->hashCodepoints[slot] != -1) && (lookup->hashCodepoints[slot] != codepoint)) slot = (slot + 1) & (lookup->hashSize - 1);
+
+            if (lookup->hashCodepoints[slot] == -1)
+            {
+                lookup->hashCodepoints[slot] = codepoint;
+                lookup->hashIndices[slot] = i;
+            }
+        }
+    }
+
+    RL_FREE(pageCounts);
+
+    return lookup;
+}
+
+// Unload codepoints to characters index lookup
+static void UnloadGlyphLookup(GlyphLookup *lookup)
+{
+    if (lookup == NULL) return;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (lookup->cache != NULL) UnloadGlyphCache(lookup->cache);
+#endif
+    RL_FREE(lookup->pageIndices);
+    RL_FREE(lookup->hashCodepoints);
+    RL_FREE(lookup->hashIndices);
+    RL_FREE(lookup);
+}
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Font glyphs rasterization job: characters band
+// NOTE: Every band uses its own font info copy, stb_truetype only reads font data
+static void LoadFontDataBand(void *data, int start, int end)
+{
+    FontDataJob *job = (FontDataJob *)data;
+    stbtt_fontinfo fontInfo = *job->fontInfo;
+
+    for (int i = start; i < end; i++)
+    {
+        int chw = 0, chh = 0;   // Character width and height (on generation)
+        int ch = job->fontChars[i];  // Character value to get info for
+        job->chars[i].value = ch;
+
+        //  Render a unicode codepoint to a bitmap
+        //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
+        //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
+        //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
+
+        if (job->type != FONT_SDF) job->chars[i].image.data = stbtt_GetCodepointBitmap(&fontInfo, job->scaleFactor, job->scaleFactor, ch, &chw, &chh, &job->chars[i].offsetX, &job->chars[i].offsetY);
+#if defined(SUPPORT_FONT_SDF_DISTANCE_TRANSFORM)
+        else if (ch != 32) job->chars[i].image.data = LoadGlyphSDF(&fontInfo, job->scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &job->chars[i].offsetX, &job->chars[i].offsetY);
+#else
+        else if (ch != 32) job->chars[i].image.data = stbtt_GetCodepointSDF(&fontInfo, job->scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &job->chars[i].offsetX, &job->chars[i].offsetY);
+#endif
+        else job->chars[i].image.data = NULL;
+
+        stbtt_GetCodepointHMetrics(&fontInfo, ch, &job->chars[i].advanceX, NULL);
+        job->chars[i].advanceX = (int)((float)job->chars[i].advanceX*job->scaleFactor);
+
+        // Load characters images
+        job->chars[i].image.width = chw;
+        job->chars[i].image.height = chh;
+        job->chars[i].image.mipmaps = 1;
+        job->chars[i].image.format = UNCOMPRESSED_GRAYSCALE;
+
+        job->chars[i].offsetY += (int)((float)job->ascent*job->scaleFactor);
+
+        // NOTE: We create an empty image for space character, it could be further required for atlas packing
+        if (ch == 32)
+        {
+            Image imSpace = {
+                .data = calloc(job->chars[i].advanceX*job->fontSize, 2),
+                .width = job->chars[i].advanceX,
+                .height = job->fontSize,
+                .format = UNCOMPRESSED_GRAYSCALE,
+                .mipmaps = 1
+            };
+
+            job->chars[i].image = imSpace;
+        }
+
+        if (job->type == FONT_BITMAP)
+        {
+            // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
+            // NOTE: For optimum results, bitmap font should be generated at base pixel size
+            for (int p = 0; p < chw*chh; p++)
+            {
+                if (((unsigned char *)job->chars[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)job->chars[i].image.data)[p] = 0;
+                else ((unsigned char *)job->chars[i].image.data)[p] = 255;
+            }
+        }
+
+        // Get bounding box for character (may be offset to account for chars that dip above or below the line)
+        /*
+        int chX1, chY1, chX2, chY2;
+        stbtt_GetCodepointBitmapBox(&fontInfo, ch, job->scaleFactor, job->scaleFactor, &chX1, &chY1, &chX2, &chY2);
+
+        TRACELOGD("FONT: Character box measures: %i, %i, %i, %i", chX1, chY1, chX2 - chX1, chY2 - chY1);
+        TRACELOGD("FONT: Character offsetY: %i", (int)((float)job->ascent*job->scaleFactor) + chY1);
+        */
+    }
+}
+
+#if defined(SUPPORT_FONT_SDF_DISTANCE_TRANSFORM)
+// Load glyph SDF using distance transform of an oversampled glyph bitmap
+// NOTE: Same output size, offsets and values range than stbtt_GetCodepointSDF(),
+// computed in linear time instead of measuring distance to every glyph curve on every pixel
+static unsigned char *LoadGlyphSDF(const stbtt_fontinfo *fontInfo, float scale, int codepoint, int padding, unsigned char onEdgeValue, float pixelDistScale, int *width, int *height, int *offsetX, int *offsetY)
+{
+    #define SDF_DISTANCE_INF    1e20f
+
+    int glyph = stbtt_FindGlyphIndex(fontInfo, codepoint);
+    int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+
+    stbtt_GetGlyphBitmapBox(fontInfo, glyph, scale, scale, &x0, &y0, &x1, &y1);
+
+    // NOTE: Same as stb_truetype, no SDF generated for empty glyphs
+    if ((x0 == x1) || (y0 == y1)) return NULL;
+
+    x0 -= padding;
+    y0 -= padding;
+    x1 += padding;
+    y1 += padding;
+
+    int sdfWidth = x1 - x0;
+    int sdfHeight = y1 - y0;
+    int overWidth = sdfWidth*FONT_SDF_OVERSAMPLING;
+    int overHeight = sdfHeight*FONT_SDF_OVERSAMPLING;
+
+    // Render glyph bitmap at oversampled scale, aligned to SDF pixels grid
+    // NOTE: Oversampled glyph box always fits inside oversampled SDF box
+    unsigned char *coverage = (unsigned char *)RL_CALLOC(overWidth*overHeight, 1);
+    int bx0 = 0, by0 = 0, bx1 = 0, by1 = 0;
+
+    stbtt_GetGlyphBitmapBox(fontInfo, glyph, scale*FONT_SDF_OVERSAMPLING, scale*FONT_SDF_OVERSAMPLING, &bx0, &by0, &bx1, &by1);
+
+    int bitmapX = bx0 - x0*FONT_SDF_OVERSAMPLING;
+    int bitmapY = by0 - y0*FONT_SDF_OVERSAMPLING;
+    int bitmapWidth = ((bitmapX + bx1 - bx0) <= overWidth)? (bx1 - bx0) : (overWidth - bitmapX);
+    int bitmapHeight = ((bitmapY + by1 - by0) <= overHeight)? (by1 - by0) : (overHeight - bitmapY);
+
+    if ((bitmapX >= 0) && (bitmapY >= 0) && (bitmapWidth > 0) && (bitmapHeight > 0))
+    {
+        stbtt_MakeGlyphBitmap(fontInfo, coverage + bitmapY*overWidth + bitmapX, bitmapWidth, bitmapHeight, overWidth, scale*FONT_SDF_OVERSAMPLING, scale*FONT_SDF_OVERSAMPLING, glyph);
+    }
+
+    // Compute squared distances to edge pixels (pixels with a neighbour on the other side of outline)
+    float *distances = (float *)RL_MALLOC(overWidth*overHeight*sizeof(float));
+    int *sources = (int *)RL_MALLOC(overWidth*overHeight*sizeof(int));
+
+    for (int y = 0; y < overHeight; y++)
+    {
+        for (int x = 0; x < overWidth; x++)
+        {
+            int k = y*overWidth + x;
+            bool inside = (coverage[k] >= 128);
+            bool edge = false;
+
+            if ((x > 0) && ((coverage[k - 1] >= 128) != inside)) edge = true;
+            else if ((x < (overWidth - 1)) && ((coverage[k + 1] >= 128) != inside)) edge = true;
+            else if ((y > 0) && ((coverage[k - overWidth] >= 128) != inside)) edge = true;
+            else if ((y < (overHeight - 1)) && ((coverage[k + overWidth] >= 128) != inside)) edge = true;
+
+            distances[k] = edge? 0.0f : SDF_DISTANCE_INF;
+            sources[k] = k;
+        }
+    }
+
+    DistanceTransform(distances, sources, overWidth, overHeight);
+
+    // Average oversampled signed distances on every SDF pixel, positive inside glyph
+    // NOTE: Nearest edge pixel coverage places outline at (coverage - 0.5) from its center
+    unsigned char *sdf = (unsigned char *)RL_MALLOC(sdfWidth*sdfHeight);
+    float samplesScale = 1.0f/(float)(FONT_SDF_OVERSAMPLING*FONT_SDF_OVERSAMPLING*FONT_SDF_OVERSAMPLING);
+
+    for (int y = 0; y < sdfHeight; y++)
+    {
+        for (int x = 0; x < sdfWidth; x++)
+        {
+            float distance = 0.0f;
+
+            for (int sy = 0; sy < FONT_SDF_OVERSAMPLING; sy++)
+            {
+                for (int sx = 0; sx < FONT_SDF_OVERSAMPLING; sx++)
+                {
+                    int k = (y*FONT_SDF_OVERSAMPLING + sy)*overWidth + x*FONT_SDF_OVERSAMPLING + sx;
+                    float edgeOffset = (float)coverage[sources[k]]/255.0f - 0.5f;
+
+                    if (coverage[k] >= 128) distance += (sqrtf(distances[k]) + edgeOffset);
+                    else distance += (edgeOffset - sqrtf(distances[k]));
+                }
+            }
+
+            float value = (float)onEdgeValue + pixelDistScale*distance*samplesScale;
+
+            if (value < 0.0f) value = 0.0f;
+            else if (value > 255.0f) value = 255.0f;
+
+            sdf[y*sdfWidth + x] = (unsigned char)value;
+        }
+    }
+
+    RL_FREE(sources);
+    RL_FREE(distances);
+    RL_FREE(coverage);
+
+    *width = sdfWidth;
+    *height = sdfHeight;
+    *offsetX = x0;
+    *offsetY = y0;
+
+    return sdf;
+}
+
+// Compute squared euclidean distance and nearest source transform (in-place), zero values are distance sources
+// NOTE: Separable linear-time algorithm by Felzenszwalb and Huttenlocher, columns then rows
+static void DistanceTransform(float *grid, int *sources, int width, int height)
+{
+    int size = (width > height)? width : height;
+
+    float *f = (float *)RL_MALLOC(size*sizeof(float));
+    float *d = (float *)RL_MALLOC(size*sizeof(float));
+    float *z = (float *)RL_MALLOC((size + 1)*sizeof(float));
+    int *fs = (int *)RL_MALLOC(size*sizeof(int));
+    int *ds = (int *)RL_MALLOC(size*sizeof(int));
+    int *v = (int *)RL_MALLOC(size*sizeof(int));
+
+    for (int x = 0; x < width; x++)
+    {
+        for (int y = 0; y < height; y++)
+        {
+            f[y] = grid[y*width + x];
+            fs[y] = sources[y*width + x];
+        }
+
+        DistanceTransform1D(f, fs, d, ds, v, z, height);
+
+        for (int y = 0; y < height; y++)
+        {
+            grid[y*width + x] = d[y];
+            sources[y*width + x] = ds[y];
+        }
+    }
+
+    for (int y = 0; y < height; y++)
+    {
+        DistanceTransform1D(grid + y*width, sources + y*width, d, ds, v, z, width);
+
+        memcpy(grid + y*width, d, width*sizeof(float));
+        memcpy(sources + y*width, ds, width*sizeof(int));
+    }
+
+    RL_FREE(v);
+    RL_FREE(ds);
+    RL_FREE(fs);
+    RL_FREE(z);
+    RL_FREE(d);
+    RL_FREE(f);
+}
+
+// Compute 1D squared distance transform, lower envelope of parabolas rooted at every sample
+// NOTE: Source of every sample minimum is also provided (ds)
+static void DistanceTransform1D(const float *f, const int *fs, float *d, int *ds, int *v, float *z, int n)
+{
+    int k = 0;
+
+    v[0] = 0;
+    z[0] = -SDF_DISTANCE_INF;
+    z[1] = SDF_DISTANCE_INF;
+
+    for (int q = 1; q < n; q++)
+    {
+        float s = ((f[q] + (float)(q*q)) - (f[v[k]] + (float)(v[k]*v[k])))/(float)(2*q - 2*v[k]);
+
+        while ((k > 0) && (s <= z[k]))
+        {
+            k--;
+            s = ((f[q] + (float)(q*q)) - (f[v[k]] + (float)(v[k]*v[k])))/(float)(2*q - 2*v[k]);
+        }
+
+        k++;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = SDF_DISTANCE_INF;
+    }
+
+    k = 0;
+
+    for (int q = 0; q < n; q++)
+    {
+        while (z[k + 1] < (float)q) k++;
+
+        d[q] = (float)((q - v[k])*(q - v[k])) + f[v[k]];
+        ds[q] = fs[v[k]];
+    }
+}
+#endif      // SUPPORT_FONT_SDF_DISTANCE_TRANSFORM
+
+// Load dynamic font from TTF data, font data is owned by font if loading succeeds
+static Font LoadFontDynamicData(unsigned char *fontData, bool fontDataMapped, int fontSize, int atlasSize)
+{
+    Font font = { 0 };
+    stbtt_fontinfo fontInfo = { 0 };
+
+    if (atlasSize <= 0) atlasSize = FONT_CACHE_ATLAS_SIZE;
+
+    if ((fontSize > 0) && stbtt_InitFont(&fontInfo, fontData, 0))
+    {
+        GlyphCache *cache = (GlyphCache *)RL_CALLOC(1, sizeof(GlyphCache));
+
+        int ascent = 0, descent = 0, lineGap = 0;
+        stbtt_GetFontVMetrics(&fontInfo, &ascent, &descent, &lineGap);
+
+        cache->fontInfo = fontInfo;
+        cache->fontData = fontData;
+        cache->fontDataMapped = fontDataMapped;
+        cache->scaleFactor = stbtt_ScaleForPixelHeight(&fontInfo, (float)fontSize);
+        cache->ascent = (int)((float)ascent*cache->scaleFactor);
+        cache->padding = FONT_TTF_DEFAULT_CHARS_PADDING;
+
+        // Split atlas in pages, pages should fit a few glyphs to avoid evicting too often
+        int pagesPerSide = FONT_CACHE_ATLAS_PAGES;
+        while ((pagesPerSide > 1) && ((atlasSize/pagesPerSide) < 2*(fontSize + 2*cache->padding))) pagesPerSide /= 2;
+        if (pagesPerSide < 1) pagesPerSide = 1;
+
+        cache->pageSize = atlasSize/pagesPerSide;
+        cache->pagesCount = pagesPerSide*pagesPerSide;
+        cache->pages = (GlyphCachePage *)RL_CALLOC(cache->pagesCount, sizeof(GlyphCachePage));
+
+        // NOTE: Glyphs rectangles are at least (2*padding) high, it limits shelves per page
+        int maxShelves = cache->pageSize/((cache->padding > 0)? 2*cache->padding : 1) + 1;
+
+        for (int i = 0; i < cache->pagesCount; i++)
+        {
+            cache->pages[i].x = (i%pagesPerSide)*cache->pageSize;
+            cache->pages[i].y = (i/pagesPerSide)*cache->pageSize;
+            cache->pages[i].shelves = (GlyphCacheShelf *)RL_MALLOC(maxShelves*sizeof(GlyphCacheShelf));
+        }
+
+        // Characters slots estimated for glyphs of half the font size width on average
+        // NOTE: At least one slot per page (besides slot 0), big font sizes could not fit a full cell
+        int cellsPerSide = cache->pageSize/(fontSize/2 + 2*cache->padding + 1);
+        if (cellsPerSide < 1) cellsPerSide = 1;
+        cache->charsCount = 1 + cache->pagesCount*cellsPerSide*cellsPerSide;
+        cache->chars = (CharInfo *)RL_CALLOC(cache->charsCount, sizeof(CharInfo));
+        cache->recs = (Rectangle *)RL_CALLOC(cache->charsCount, sizeof(Rectangle));
+        cache->charsPage = (int *)RL_MALLOC(cache->charsCount*sizeof(int));
+        cache->freeSlots = (int *)RL_MALLOC(cache->charsCount*sizeof(int));
+
+        for (int i = 0; i < cache->charsCount; i++) cache->charsPage[i] = -1;
+
+        // NOTE: Slot 0 is never used, it is returned for glyphs that can not be cached
+        for (int i = cache->charsCount - 1; i > 0; i--) cache->freeSlots[cache->freeSlotsCount++] = i;
+
+        // NOTE: Hash table also keeps codepoints without character slot (missing or not fitting glyphs)
+        cache->hashSize = 1;
+        while (cache->hashSize < (cache->charsCount + FONT_CACHE_UNCACHED_CHARS)*2) cache->hashSize <<= 1;
+
+        cache->hashCodepoints = (int *)RL_MALLOC(cache->hashSize*sizeof(int));
+        cache->hashIndices = (int *)RL_MALLOC(cache->hashSize*sizeof(int));
+        for (int i = 0; i < cache->hashSize; i++) cache->hashCodepoints[i] = -1;
+
+        // Load empty glyphs atlas texture, glyphs are updated on texture when rasterized
+        Image atlas = {
+            .data = RL_CALLOC(atlasSize*atlasSize, 2),
+            .width = atlasSize,
+            .height = atlasSize,
+            .format = UNCOMPRESSED_GRAY_ALPHA,
+            .mipmaps = 1
+        };
+
+        for (int i = 0; i < atlasSize*atlasSize; i++) ((unsigned char *)atlas.data)[i*2] = 255;
+
+        cache->texture = LoadTextureFromImage(atlas);
+        UnloadImage(atlas);
+
+        if (cache->texture.id > 0)
+        {
+            font.baseSize = fontSize;
+            font.charsCount = cache->charsCount;
+            font.charsPadding = cache->padding;
+            font.texture = cache->texture;
+            font.recs = cache->recs;
+            font.chars = cache->chars;
+
+            GlyphLookup *lookup = (GlyphLookup *)RL_CALLOC(1, sizeof(GlyphLookup));
+            lookup->cache = cache;
+            font.glyphLookup = lookup;
+
+            TRACELOG(LOG_INFO, "FONT: Dynamic font loaded successfully (%i pixels, %ix%i glyphs atlas, %i pages)", fontSize, atlasSize, atlasSize, cache->pagesCount);
+        }
+        else
+        {
+            // NOTE: Font data is not unloaded, it is freed by caller on failure
+            cache->fontData = NULL;
+            RL_FREE(cache->chars);
+            RL_FREE(cache->recs);
+            UnloadGlyphCache(cache);
+        }
+    }
+    else TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
+
+    return font;
+}
+
+// Unload glyphs cache (including TTF font data)
+// NOTE: Characters data, rectangles and texture are unloaded with font
+static void UnloadGlyphCache(GlyphCache *cache)
+{
+    if (cache->fontData != NULL)
+    {
+        if (cache->fontDataMapped) UnloadFileDataMapped(cache->fontData);
+        else RL_FREE(cache->fontData);
+    }
+
+    for (int i = 0; i < cache->pagesCount; i++) RL_FREE(cache->pages[i].shelves);
+
+    RL_FREE(cache->pages);
+    RL_FREE(cache->charsPage);
+    RL_FREE(cache->freeSlots);
+    RL_FREE(cache->hashCodepoints);
+    RL_FREE(cache->hashIndices);
+    RL_FREE(cache);
+}
+
+// Get glyphs cache character slot for codepoint, rasterized if not cached
+// NOTE: Codepoints not available in font use '?' glyph, slot 0 (empty) returned if glyph can not be cached,
+// both cases are kept in hash table (no atlas page) to avoid font lookups and rasterization on every call
+static int GetGlyphCacheIndex(GlyphCache *cache, int codepoint)
+{
+    bool found = false;
+    int index = 0;
+    unsigned int slot = ((unsigned int)codepoint*2654435761u) & (cache->hashSize - 1);
+
+    while (cache->hashCodepoints[slot] != -1)
+    {
+        if (cache->hashCodepoints[slot] == codepoint)
+        {
+            index = cache->hashIndices[slot];
+            found = true;
+            break;
+        }
+
+        slot = (slot + 1) & (cache->hashSize - 1);
+    }
+
+    if (!found)
+    {
+        if ((codepoint != '?') && (stbtt_FindGlyphIndex(&cache->fontInfo, codepoint) == 0))
+        {
+            InsertGlyphCacheHash(cache, codepoint, -1);
+            index = -1;
+        }
+        else index = LoadGlyphCacheChar(cache, codepoint);
+    }
+
+    if (index < 0) return GetGlyphCacheIndex(cache, '?');
+
+    if (index > 0) cache->pages[cache->charsPage[index]].lastUsed = ++cache->useCounter;
+
+    return index;
+}
+
+// Rasterize codepoint glyph into glyphs cache atlas
+// NOTE: Returns character slot, 0 if glyph does not fit in an atlas page or no slot is available
+static int LoadGlyphCacheChar(GlyphCache *cache, int codepoint)
+{
+    int index = 0;
+    int width = 0, height = 0, offsetX = 0, offsetY = 0, advanceX = 0;
+
+    unsigned char *bitmap = stbtt_GetCodepointBitmap(&cache->fontInfo, cache->scaleFactor, cache->scaleFactor, codepoint, &width, &height, &offsetX, &offsetY);
+    stbtt_GetCodepointHMetrics(&cache->fontInfo, codepoint, &advanceX, NULL);
+
+    if (bitmap == NULL) { width = 0; height = 0; }
+
+    int recWidth = width + 2*cache->padding;
+    int recHeight = height + 2*cache->padding;
+    if (recWidth < 1) recWidth = 1;
+    if (recHeight < 1) recHeight = 1;
+
+    if ((recWidth <= cache->pageSize) && (recHeight <= cache->pageSize))
+    {
+        int page = -1, x = 0, y = 0;
+
+        // No characters slots available, evict least recently used pages holding glyphs
+        while (cache->freeSlotsCount == 0)
+        {
+            int usedPage = GetGlyphCacheLRUPage(cache, true);
+
+            if (usedPage < 0) break;
+            EvictGlyphCachePage(cache, usedPage);
+        }
+
+        if (cache->freeSlotsCount == 0)
+        {
+            TRACELOG(LOG_WARNING, "FONT: No characters slots available in glyphs cache for codepoint (0x%x)", codepoint);
+            InsertGlyphCacheHash(cache, codepoint, 0);
+            stbtt_FreeBitmap(bitmap, NULL);
+            return 0;
+        }
+
+        for (int i = 0; i < cache->pagesCount; i++)
+        {
+            if (PackGlyphCachePage(&cache->pages[i], cache->pageSize, recWidth, recHeight, &x, &y))
+            {
+                page = i;
+                break;
+            }
+        }
+
+        // No atlas space available, evict least recently used page and use it
+        if (page == -1)
+        {
+            page = GetGlyphCacheLRUPage(cache, false);
+            EvictGlyphCachePage(cache, page);
+            PackGlyphCachePage(&cache->pages[page], cache->pageSize, recWidth, recHeight, &x, &y);
+        }
+
+        // Update glyph (including padding) into atlas texture, converted to GRAY_ALPHA
+        unsigned char *pixels = (unsigned char *)RL_MALLOC(recWidth*recHeight*2);
+
+        for (int py = 0, k = 0; py < recHeight; py++)
+        {
+            for (int px = 0; px < recWidth; px++, k += 2)
+            {
+                int gx = px - cache->padding;
+                int gy = py - cache->padding;
+
+                pixels[k] = 255;
+                pixels[k + 1] = ((gx >= 0) && (gx < width) && (gy >= 0) && (gy < height))? bitmap[gy*width + gx] : 0;
+            }
+        }
+
+        UpdateTextureRec(cache->texture, (Rectangle){ (float)x, (float)y, (float)recWidth, (float)recHeight }, pixels);
+        RL_FREE(pixels);
+
+        index = cache->freeSlots[--cache->freeSlotsCount];
+
+        cache->chars[index].value = codepoint;
+        cache->chars[index].offsetX = offsetX;
+        cache->chars[index].offsetY = offsetY + cache->ascent;
+        cache->chars[index].advanceX = (int)((float)advanceX*cache->scaleFactor);
+
+        // Keep character image for CPU text drawing, required by ImageDrawText()
+        if ((width > 0) && (height > 0))
+        {
+            Image image = {
+                .data = RL_MALLOC(width*height*2),
+                .width = width,
+                .height = height,
+                .format = UNCOMPRESSED_GRAY_ALPHA,
+                .mipmaps = 1
+            };
+
+            for (int i = 0; i < width*height; i++)
+            {
+                ((unsigned char *)image.data)[i*2] = 255;
+                ((unsigned char *)image.data)[i*2 + 1] = bitmap[i];
+            }
+
+            cache->chars[index].image = image;
+        }
+
+        cache->recs[index] = (Rectangle){ (float)(x + cache->padding), (float)(y + cache->padding), (float)width, (float)height };
+        cache->charsPage[index] = page;
+
+        InsertGlyphCacheHash(cache, codepoint, index);
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "FONT: Glyph for codepoint (0x%x) does not fit in glyphs cache page", codepoint);
+        InsertGlyphCacheHash(cache, codepoint, 0);
+    }
+
+    stbtt_FreeBitmap(bitmap, NULL);
+
+    return index;
+}
+
+// Pack rectangle into page shelves, using the lowest shelf fitting it
+// NOTE: A new shelf is opened if no shelf fits or best one wastes too much height
+static bool PackGlyphCachePage(GlyphCachePage *page, int pageSize, int width, int height, int *x, int *y)
+{
+    GlyphCacheShelf *shelf = NULL;
+
+    for (int i = 0; i < page->shelvesCount; i++)
+    {
+        GlyphCacheShelf *current = &page->shelves[i];
+
+        if ((current->height >= height) && ((current->offsetX + width) <= pageSize) &&
+            ((shelf == NULL) || (current->height < shelf->height))) shelf = current;
+    }
+
+    if (((shelf == NULL) || (shelf->height > (height + height/2))) && ((page->nextY + height) <= pageSize))
+    {
+        shelf = &page->shelves[page->shelvesCount];
+        shelf->y = page->nextY;
+        shelf->height = height;
+        shelf->offsetX = 0;
+
+        page->shelvesCount++;
+        page->nextY += height;
+    }
+
+    if (shelf == NULL) return false;
+
+    *x = page->x + shelf->offsetX;
+    *y = page->y + shelf->y;
+    shelf->offsetX += width;
+
+    return true;
+}
+
+// Evict all page glyphs from glyphs cache
+static void EvictGlyphCachePage(GlyphCache *cache, int page)
+{
+    // Draw batched quads before page is overwritten, they could use evicted glyphs
+    rlglDraw();
+
+    for (int i = 1; i < cache->charsCount; i++)
+    {
+        if (cache->charsPage[i] == page)
+        {
+            RemoveGlyphCacheHash(cache, cache->chars[i].value);
+            UnloadImage(cache->chars[i].image);
+
+            cache->chars[i] = (CharInfo){ 0 };
+            cache->recs[i] = (Rectangle){ 0 };
+            cache->charsPage[i] = -1;
+            cache->freeSlots[cache->freeSlotsCount++] = i;
+        }
+    }
+
+    cache->pages[page].nextY = 0;
+    cache->pages[page].shelvesCount = 0;
+    cache->pages[page].lastUsed = 0;
+
+    TRACELOGD("FONT: Glyphs cache page %i evicted", page);
+}
+
+// Get least recently used glyphs cache page
+// NOTE: If only used pages are requested (pages holding glyphs), returns -1 if all pages are empty
+static int GetGlyphCacheLRUPage(GlyphCache *cache, bool used)
+{
+    int page = -1;
+
+    for (int i = 0; i < cache->pagesCount; i++)
+    {
+        if (used && (cache->pages[i].shelvesCount == 0)) continue;
+
+        if ((page == -1) || (cache->pages[i].lastUsed < cache->pages[page].lastUsed)) page = i;
+    }
+
+    return page;
+}
+
+// Insert codepoint into glyphs cache hash table
+// NOTE: Codepoints without character slot (index <= 0) are never evicted, they are limited
+// to FONT_CACHE_UNCACHED_CHARS to keep hash table load low, further ones are not inserted
+static void InsertGlyphCacheHash(GlyphCache *cache, int codepoint, int index)
+{
+    if (index <= 0)
+    {
+        if (cache->hashUncachedCount >= FONT_CACHE_UNCACHED_CHARS) return;
+        cache->hashUncachedCount++;
+    }
+
+    unsigned int slot = ((unsigned int)codepoint*2654435761u) & (cache->hashSize - 1);
+    while (cache->hashCodepoints[slot] != -1) slot = (slot + 1) & (cache->hashSize - 1);
+
+    cache->hashCodepoints[slot] = codepoint;
+    cache->hashIndices[slot] = index;
+}
+
+// Remove codepoint from glyphs cache hash table
+// NOTE: Following entries are moved back to keep linear probing sequences valid
+static void RemoveGlyphCacheHash(GlyphCache *cache, int codepoint)
+{
+    unsigned int mask = cache->hashSize - 1;
+    unsigned int slot = ((unsigned int)codepoint*2654435761u) & mask;
+
+    while (cache->hashCodepoints[slot] != codepoint)
+    {
+        if (cache->hashCodepoints[slot] == -1) return;
+        slot = (slot + 1) & mask;
+    }
+
+    for (unsigned int next = (slot + 1) & mask; cache->hashCodepoints[next] != -1; next = (next + 1) & mask)
+    {
+        unsigned int home = ((unsigned int)cache->hashCodepoints[next]*2654435761u) & mask;
+
+        // Entry can be moved to the empty slot if its home slot is not between empty slot and entry
+        if (((next - home) & mask) >= ((next - slot) & mask))
+        {
+            cache->hashCodepoints[slot] = cache->hashCodepoints[next];
+            cache->hashIndices[slot] = cache->hashIndices[next];
+            slot = next;
+        }
+    }
+
+    cache->hashCodepoints[slot] = -1;
+}
+#endif      // SUPPORT_FILEFORMAT_TTF
+
+#if defined(SUPPORT_FILEFORMAT_FNT)
+
+// Read a line from memory
+// NOTE: Returns the number of bytes read
+static int GetLine(const char *origin, char *buffer, int maxLength)
+{
+    int count = 0;
+    for (; count < maxLength; count++) if (origin[count] == '\n') break;
+    memcpy(buffer, origin, count);
+    return count;
+}
+
+// Load a BMFont file (AngelCode font file)
+// REQUIRES: strstr(), sscanf(), strrchr(), memcpy()
+static Font LoadBMFont(const char *fileName)
+{
+    #define MAX_BUFFER_SIZE     256
+
+    Font font = { 0 };
+
+    char buffer[MAX_BUFFER_SIZE] = { 0 };
+    char *searchPoint = NULL;
+
+    int fontSize = 0;
+    int charsCount = 0;
+
+    int imWidth = 0;
+    int imHeight = 0;
+    char imFileName[129];
+
+    int base = 0;   // Useless data
 
     char *fileText = LoadFileText(fileName);
 
@@ -1851,6 +3095,8 @@ static Font LoadBMFont(const char *fileName)
     UnloadImage(imFont);
     RL_FREE(fileText);
 
+    font.glyphLookup = LoadGlyphLookup(font.chars, font.charsCount);
+
     if (font.texture.id == 0)
     {
         UnloadFont(font);
@@ -1862,3 +3108,184 @@ static Font LoadBMFont(const char *fileName)
     return font;
 }
 #endif
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Load font from font cache file, atlas pixels are uploaded directly from file data
+// NOTE: Returns empty font if cache file is not available, not valid or key does not match
+static Font LoadFontCache(const char *fileName, unsigned long long key)
+{
+    Font font = { 0 };
+
+    if (!FileExists(fileName)) return font;
+
+    unsigned int dataSize = 0;
+    unsigned char *fileData = LoadFileDataMapped(fileName, &dataSize);
+
+    if (fileData != NULL)
+    {
+        FontCacheHeader header = { 0 };
+        bool valid = false;
+
+        if (dataSize >= sizeof(FontCacheHeader))
+        {
+            memcpy(&header, fileData, sizeof(FontCacheHeader));
+
+            // NOTE: Atlas size is bounded and data size computed in 64 bit, header values could overflow int arithmetic
+            if ((memcmp(header.id, "rFNC", 4) == 0) && (header.version == FONT_CACHE_FILE_VERSION) && (header.key == key) && (header.charsCount > 0) &&
+                (header.charsPadding >= 0) && (header.charsPadding <= FONT_CACHE_MAX_CHARS_PADDING) && (header.atlasFormat == UNCOMPRESSED_GRAY_ALPHA) &&
+                (header.atlasWidth > 0) && (header.atlasWidth <= FONT_CACHE_MAX_ATLAS_SIZE) && (header.atlasHeight > 0) && (header.atlasHeight <= FONT_CACHE_MAX_ATLAS_SIZE))
+            {
+                unsigned long long expectedSize = sizeof(FontCacheHeader) + (unsigned long long)header.charsCount*sizeof(FontCacheChar) +
+                                                  (unsigned long long)header.atlasWidth*header.atlasHeight*2;     // GRAY_ALPHA data size
+
+                valid = (dataSize == expectedSize);
+            }
+        }
+
+        const FontCacheChar *cacheChars = (const FontCacheChar *)(fileData + sizeof(FontCacheHeader));
+
+        // Check characters rectangles are inside atlas
+        // NOTE: Comparisons are negated so not valid values (NaN) fail the check
+        for (int i = 0; valid && (i < header.charsCount); i++)
+        {
+            Rectangle rec = cacheChars[i].rec;
+
+            if (!((rec.x >= 0) && (rec.y >= 0) && (rec.width >= 0) && (rec.height >= 0) &&
+                  ((rec.x + rec.width) <= header.atlasWidth) && ((rec.y + rec.height) <= header.atlasHeight))) valid = false;
+        }
+
+        if (valid)
+        {
+            Image atlas = {
+                .data = fileData + sizeof(FontCacheHeader) + header.charsCount*sizeof(FontCacheChar),
+                .width = header.atlasWidth,
+                .height = header.atlasHeight,
+                .format = header.atlasFormat,
+                .mipmaps = 1
+            };
+
+            font.texture = LoadTextureFromImage(atlas);
+
+            if (font.texture.id > 0)
+            {
+                font.baseSize = header.baseSize;
+                font.charsCount = header.charsCount;
+                font.charsPadding = header.charsPadding;
+                font.chars = (CharInfo *)RL_MALLOC(font.charsCount*sizeof(CharInfo));
+                font.recs = (Rectangle *)RL_MALLOC(font.charsCount*sizeof(Rectangle));
+
+                for (int i = 0; i < font.charsCount; i++)
+                {
+                    font.chars[i].value = cacheChars[i].value;
+                    font.chars[i].offsetX = cacheChars[i].offsetX;
+                    font.chars[i].offsetY = cacheChars[i].offsetY;
+                    font.chars[i].advanceX = cacheChars[i].advanceX;
+                    font.recs[i] = cacheChars[i].rec;
+
+                    // Characters images are required by ImageDrawText()
+                    font.chars[i].image = ImageFromImage(atlas, font.recs[i]);
+                }
+
+                font.glyphLookup = LoadGlyphLookup(font.chars, font.charsCount);
+
+                TRACELOG(LOG_INFO, "FONT: [%s] Font loaded from cache successfully", fileName);
+            }
+        }
+        else TRACELOG(LOG_INFO, "FONT: [%s] Font cache not valid for requested font, regenerating it", fileName);
+
+        UnloadFileDataMapped(fileData);
+    }
+
+    return font;
+}
+
+// Export font to font cache file, atlas is composed from characters images
+// NOTE: Characters images are copies of atlas (GRAY_ALPHA) generated by LoadFontFromMemory()
+static bool ExportFontCache(Font font, const char *fileName, unsigned long long key)
+{
+    bool success = false;
+
+    if ((font.chars == NULL) || (font.recs == NULL) || (font.texture.format != UNCOMPRESSED_GRAY_ALPHA)) return false;
+
+    int atlasDataSize = GetPixelDataSize(font.texture.width, font.texture.height, UNCOMPRESSED_GRAY_ALPHA);
+    unsigned int dataSize = sizeof(FontCacheHeader) + font.charsCount*sizeof(FontCacheChar) + atlasDataSize;
+    unsigned char *fileData = (unsigned char *)RL_CALLOC(dataSize, 1);
+
+    FontCacheHeader header = { 0 };
+    memcpy(header.id, "rFNC", 4);
+    header.version = FONT_CACHE_FILE_VERSION;
+    header.key = key;
+    header.baseSize = font.baseSize;
+    header.charsCount = font.charsCount;
+    header.charsPadding = font.charsPadding;
+    header.atlasWidth = font.texture.width;
+    header.atlasHeight = font.texture.height;
+    header.atlasFormat = UNCOMPRESSED_GRAY_ALPHA;
+    memcpy(fileData, &header, sizeof(FontCacheHeader));
+
+    FontCacheChar *cacheChars = (FontCacheChar *)(fileData + sizeof(FontCacheHeader));
+    unsigned char *atlasData = fileData + sizeof(FontCacheHeader) + font.charsCount*sizeof(FontCacheChar);
+
+    // Atlas background is white fully transparent, same as GenImageFontAtlas()
+    for (int i = 0; i < font.texture.width*font.texture.height; i++) atlasData[i*2] = 255;
+
+    for (int i = 0; i < font.charsCount; i++)
+    {
+        cacheChars[i].value = font.chars[i].value;
+        cacheChars[i].offsetX = font.chars[i].offsetX;
+        cacheChars[i].offsetY = font.chars[i].offsetY;
+        cacheChars[i].advanceX = font.chars[i].advanceX;
+        cacheChars[i].rec = font.recs[i];
+
+        Image image = font.chars[i].image;
+        int x = (int)font.recs[i].x;
+        int y = (int)font.recs[i].y;
+
+        if ((image.data != NULL) && (image.format == UNCOMPRESSED_GRAY_ALPHA) &&
+            ((x + image.width) <= font.texture.width) && ((y + image.height) <= font.texture.height))
+        {
+            for (int row = 0; row < image.height; row++)
+            {
+                memcpy(atlasData + ((y + row)*font.texture.width + x)*2, (unsigned char *)image.data + row*image.width*2, image.width*2);
+            }
+        }
+    }
+
+    success = SaveFileData(fileName, fileData, dataSize);
+    RL_FREE(fileData);
+
+    if (success) TRACELOG(LOG_INFO, "FONT: [%s] Font cache exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FONT: [%s] Failed to export font cache", fileName);
+
+    return success;
+}
+
+// Get font cache key, hash of font file data and generation parameters
+// NOTE: FNV-1a based hash, file data processed 8 bytes per step
+static unsigned long long GetFontCacheKey(const unsigned char *fileData, unsigned int dataSize, int fontSize, const int *fontChars, int charsCount, int type)
+{
+    unsigned long long hash = 14695981039346656037ull;
+    unsigned int i = 0;
+
+    for (; (i + 8) <= dataSize; i += 8)
+    {
+        unsigned long long word = 0;
+        memcpy(&word, fileData + i, 8);
+
+        hash = (hash ^ word)*1099511628211ull;
+        hash ^= (hash >> 29);
+    }
+
+    for (; i < dataSize; i++) hash = (hash ^ fileData[i])*1099511628211ull;
+
+    // NOTE: Default charset (32..126) used if no characters provided, same as LoadFontData()
+    charsCount = (charsCount > 0)? charsCount : 95;
+
+    int params[4] = { fontSize, type, FONT_TTF_DEFAULT_CHARS_PADDING, charsCount };
+
+    for (int p = 0; p < 4; p++) hash = (hash ^ (unsigned int)params[p])*1099511628211ull;
+    for (int c = 0; c < charsCount; c++) hash = (hash ^ (unsigned int)((fontChars != NULL)? fontChars[c] : (c + 32)))*1099511628211ull;
+
+    return hash;
+}
+#endif      // SUPPORT_FILEFORMAT_TTF
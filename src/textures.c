@@ -30,6 +30,10 @@
 *   #define SUPPORT_IMAGE_GENERATION
 *       Support procedural image generation functionality (gradient, spot, perlin-noise, cellular)
 *
+*   #define SUPPORT_THREADS
+*       Support parallel image processing (ImageResize(), ImageMipmaps(), ImageColor*()) split in rows bands,
+*       disabled by default, enabled with SetImageProcessingThreads()
+*
 *   DEPENDENCIES:
 *       stb_image        - Multiple image formats loading (JPEG, PNG, BMP, TGA, PSD, GIF, PIC)
 *                          NOTE: stb_image has been slightly modified to support Android platform.
@@ -67,7 +71,9 @@
 #include <stdlib.h>             // Required for: malloc(), free()
 #include <stdio.h>              // Required for: FILE, fopen(), fclose(), fread()
 #include <string.h>             // Required for: strlen() [Used in ImageTextEx()]
-#include <math.h>               // Required for: fabsf()
+#include <math.h>               // Required for: fabsf(), sqrtf()
+#include <limits.h>             // Required for: INT_MAX [Used in ImageCompress()]
+#include <ctype.h>              // Required for: tolower() [Used in LoadImageFromMemory()]
 
 #include "utils.h"              // Required for: fopen() Android mapping
 
@@ -152,15 +158,171 @@
     #define UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD  50    // Threshold over 255 to set alpha as 0
 #endif
 
+#ifndef QUANTIZE_BINS
+    #define QUANTIZE_BINS            262144     // Color quantizer histogram bins (RGB 5 bits, alpha 3 bits)
+#endif
+#ifndef QUANTIZE_KMEANS_STEPS
+    #define QUANTIZE_KMEANS_STEPS         2     // Color quantizer k-means refinement steps over median-cut palette
+#endif
+
+#ifndef IMAGE_PARALLEL_MIN_PIXELS
+    #define IMAGE_PARALLEL_MIN_PIXELS     65536     // Minimum image pixels to split processing across threads
+#endif
+
+#ifndef IMAGE_STREAM_BUFFER_FRAMES
+    #define IMAGE_STREAM_BUFFER_FRAMES        3     // Image stream frames decoded ahead of current frame
+#endif
+
+#ifndef ASYNC_TEXTURE_UPLOAD_BUDGET_MS
+    #define ASYNC_TEXTURE_UPLOAD_BUDGET_MS     4.0f     // Default per-frame time budget for async textures upload (milliseconds)
+#endif
+#ifndef ASYNC_TEXTURE_UPLOAD_BUDGET_BYTES
+    #define ASYNC_TEXTURE_UPLOAD_BUDGET_BYTES 16777216  // Default per-frame data budget for async textures upload (bytes)
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Image resize job data (parallel image processing)
+typedef struct ResizeJob {
+    const unsigned char *input; // Input pixel data
+    int width;                  // Input width
+    int height;                 // Input height
+    unsigned char *output;      // Output pixel data
+    int newWidth;               // Output width
+    int newHeight;              // Output height
+    int channels;               // Pixel channels (8bit per channel)
+} ResizeJob;
+
+// Image colors job data (parallel image processing)
+typedef struct ColorsJob {
+    Color *pixels;              // Pixels data (RGBA - 32bit)
+    int width;                  // Image width
+    Color color;                // Color parameter (tint)
+    float contrast;             // Contrast parameter (already scaled)
+    int brightness;             // Brightness parameter
+} ColorsJob;
+
+// Image block compression job data (parallel image processing)
+typedef struct CompressJob {
+    const Color *pixels;        // Input pixels data (RGBA - 32bit)
+    int width;                  // Image width
+    int height;                 // Image height
+    unsigned char *output;      // Output compressed blocks data
+    int format;                 // Compressed pixel format
+    int quality;                // Compression quality: 0 (fastest) to 2 (best)
+} CompressJob;
+
+// Color quantizer histogram color
+typedef struct QuantizeColor {
+    float color[4];             // Bin mean color (RGBA)
+    unsigned int count;         // Bin pixels count
+} QuantizeColor;
+
+// Color quantizer median-cut box, range of histogram colors
+typedef struct QuantizeBox {
+    int first;                  // First histogram color
+    int count;                  // Histogram colors count
+    unsigned long long pixels;  // Pixels count
+    int axis;                   // Widest weighted axis (RGBA channel)
+    float range;                // Widest weighted axis squared range
+} QuantizeBox;
+
+// Async texture request state
+typedef enum {
+    TEXTURE_REQUEST_PENDING = 0,    // Image data being decoded (worker thread)
+    TEXTURE_REQUEST_DECODED,        // Image data decoded, waiting for upload
+    TEXTURE_REQUEST_UPLOADING,      // Image data partially uploaded (rows bands)
+    TEXTURE_REQUEST_READY,          // Texture loaded, waiting to be retrieved
+    TEXTURE_REQUEST_FAILED          // Texture loading failed
+} TextureRequestState;
+
+// Async texture request data
+// NOTE: Worker thread only accesses fileName, mipmaps, format and image while state is TEXTURE_REQUEST_PENDING
+typedef struct TextureRequest {
+    int id;                         // Request id: slot index + 1 (low 16 bits) and requests generation (high bits)
+    char *fileName;                 // Image file name (copy)
+    bool mipmaps;                   // Generate mipmaps on decoding
+    int format;                     // Texture pixel format (0 to keep file format)
+    Image image;                    // Decoded image data
+    Texture2D texture;              // Loaded texture
+    int state;                      // Request state (TextureRequestState)
+    int uploadedRows;               // Image rows already uploaded (TEXTURE_REQUEST_UPLOADING)
+    TextureLoadCallback callback;   // Completion callback, request released once called
+    void *userData;                 // Completion callback user data
+} TextureRequest;
+
+// Pixels readback state
+typedef enum {
+    READBACK_GPU = 0,               // Pixels data being copied by GPU
+    READBACK_PROCESSING,            // Pixels data being processed (worker thread)
+    READBACK_DONE                   // Image ready to be provided to callback
+} ReadbackState;
+
+// Pixels readback data, image retrieved asynchronously from GPU
+typedef struct TextureReadback {
+    int readback;                   // Readback id (rlgl)
+    Image image;                    // Retrieved image
+    bool screen;                    // Screen pixels data (bottom-up lines and framebuffer alpha)
+    int state;                      // Readback state (ReadbackState)
+    ImageReadCallback callback;     // Image retrieved callback, image owned by callback
+    void *userData;                 // Image retrieved callback user data
+    struct TextureReadback *next;   // Next readback (requests order)
+} TextureReadback;
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+// Image stream context data, animated GIF frames decoded progressively
+// NOTE: Decoder state (context, gif, history) is only accessed by decoding job while decoding
+typedef struct ImageStreamData {
+    unsigned char *fileData;        // GIF file data
+    unsigned int fileSize;          // GIF file data size
+    int width;                      // Frames width
+    int height;                     // Frames height
+    int frameCount;                 // Frames count
+    int *delays;                    // Frames delays (milliseconds)
+    bool looping;                   // Animation looping (copied from stream on update)
+
+    stbi__context context;          // GIF decoder data context
+    stbi__gif gif;                  // GIF decoder state
+    unsigned char *history[2];      // Last two decoded frames (frame index%2)
+    int decodedFrames;              // Frames decoded since decoder reset
+
+    unsigned char *frames[IMAGE_STREAM_BUFFER_FRAMES];  // Decoded frames ring (RGBA)
+    int frameIndex[IMAGE_STREAM_BUFFER_FRAMES];         // Decoded frames indices
+    int first;                      // Decoded frames ring first slot
+    int count;                      // Decoded frames ready to be shown
+    int nextFrame;                  // Next frame to decode
+
+    bool decoding;                  // Decoding job running
+    int decodeFrame;                // Frame being decoded
+    int decodeSlot;                 // Frame being decoded ring slot
+    bool decodeSuccess;             // Frame decoding result
+    int generation;                 // Seeks counter, decoded frames from previous generations are discarded
+    int decodeGeneration;           // Frame being decoded generation
+    bool failed;                    // Decoding failed, no more frames decoded
+    bool unloaded;                  // Stream unloaded while decoding, data unloaded once decoding finishes
+
+    int currentFrame;               // Frame shown on stream texture
+    float frameTime;                // Current frame time shown (seconds)
+    bool showNext;                  // Next decoded frame shown immediately (seek)
+} ImageStreamData;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+static int imageThreads = 1;    // Threads used by image processing functions (1 means serial processing)
+
+static const float quantizeWeights[4] = { 2.0f, 4.0f, 3.0f, 3.0f };    // Color quantizer channels distance weights (RGBA, perceptual approximation)
+
+static TextureRequest **textureRequests = NULL;     // Async texture requests (request id includes slot index + 1)
+static int textureRequestsCount = 0;                // Async texture requests slots count
+static int textureRequestsGeneration = 0;           // Async texture requests counter, ids of released requests are not reused
+static float textureUploadBudgetTime = ASYNC_TEXTURE_UPLOAD_BUDGET_MS;      // Per-frame async textures upload time budget (milliseconds)
+static int textureUploadBudgetBytes = ASYNC_TEXTURE_UPLOAD_BUDGET_BYTES;    // Per-frame async textures upload data budget (bytes)
+
+static TextureReadback *readbacksFirst = NULL;      // Pixels readbacks pending, images provided in requests order
+static TextureReadback *readbacksLast = NULL;
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -172,6 +334,7 @@
 //----------------------------------------------------------------------------------
 #if defined(SUPPORT_FILEFORMAT_DDS)
 static Image LoadDDS(const unsigned char *fileData, unsigned int fileSize);   // Load DDS file data
+static int SaveDDS(Image image, const char *fileName);  // Save image data as DDS file
 #endif
 #if defined(SUPPORT_FILEFORMAT_PKM)
 static Image LoadPKM(const unsigned char *fileData, unsigned int fileSize);   // Load PKM file data
@@ -187,6 +350,68 @@ static Image LoadPVR(const unsigned char *fileData, unsigned int fileSize);   //
 static Image LoadASTC(const unsigned char *fileData, unsigned int fileSize);  // Load ASTC file data
 #endif
 static Vector4 *LoadImageDataNormalized(Image image);    // Load pixel data from image as Vector4 array (float normalized)
+static bool ConvertPixelData(const void *srcData, int srcFormat, void *dstData, int dstFormat, int count);  // Convert pixel data between formats (common formats only)
+static bool ImageFormatDirect(Image *image, int newFormat);       // Convert image data between common uncompressed formats directly
+static void ImageFillRectangle(Image *dst, int x, int y, int width, int height, Color color);   // Fill image rectangle with color (rectangle must be inside image)
+static void BlendPixelsRow(unsigned char *dst, int dstFormat, const unsigned char *src, int srcFormat, int count, Color tint);  // Blend pixels row over destination pixels (8bit per channel formats)
+static int GetImageJobThreads(int width, int height);      // Get threads to process an image of provided size
+static int GetQuantizeBin(int r, int g, int b, int a);     // Get color quantizer histogram bin
+static QuantizeColor *LoadQuantizeColors(const Color *pixels, int count, int *colorsCount);    // Load image colors histogram (reduced precision bins)
+static int QuantizePalette(QuantizeColor *colors, int count, Color *palette, int paletteSize);   // Quantize colors histogram to a palette (median-cut + k-means)
+static void ComputeQuantizeBox(QuantizeBox *box, const QuantizeColor *colors);                 // Compute quantizer box pixels and widest axis
+static int CompareQuantizeColorR(const void *a, const void *b);    // Compare quantizer colors by red channel (qsort)
+static int CompareQuantizeColorG(const void *a, const void *b);    // Compare quantizer colors by green channel (qsort)
+static int CompareQuantizeColorB(const void *a, const void *b);    // Compare quantizer colors by blue channel (qsort)
+static int CompareQuantizeColorA(const void *a, const void *b);    // Compare quantizer colors by alpha channel (qsort)
+static int GetPaletteNearest(const Color *palette, int count, const float *color);     // Get palette color nearest to color (weighted distance)
+static void MapPaletteIndices(const Color *pixels, int width, int height, const Color *palette, int count, bool dither, unsigned char *indices);  // Map pixels to palette indices
+static void CompressBlocksBand(void *data, int start, int end);     // Block compression job: blocks rows band
+static void CompressBlockDXTColor(const Color *block, unsigned char *output, bool transparent, int quality);  // Compress 4x4 block color (DXT1 block)
+static void CompressBlockDXTAlpha(const Color *block, unsigned char *output, int quality);    // Compress 4x4 block alpha (DXT5 alpha block)
+static void CompressBlockETC1(const Color *block, unsigned char *output, int quality);        // Compress 4x4 block color (ETC1 block)
+static void CompressBlockEACAlpha(const Color *block, unsigned char *output, int quality);    // Compress 4x4 block alpha (EAC alpha block)
+static unsigned short PackColor565(const float *rgb);      // Get RGB565 color from RGB float values (0.0f..255.0f)
+static int FitDXTColorIndices(const int (*colors)[3], int count, unsigned short c0, unsigned short c1, bool threeColors, int *indices);  // Fit DXT color block indices
+static int FitDXTAlphaIndices(const Color *block, int a0, int a1, int *indices);              // Fit DXT5 alpha block indices
+static int FitETC1Subblock(const int (*colors)[3], const int *base, int *table, int *indices); // Fit ETC1 subblock modifiers table and indices
+static int FitETC1SubblockCandidates(const int (*colors)[3], const float *average, int bits, int quality, int (*bases)[3], int *errors, int *tables, int (*indices)[8], int *count);  // Fit ETC1 subblock base colors candidates
+static int FitEACAlphaIndices(const Color *block, int base, int multiplier, const int *modifiers, int *indices);  // Fit EAC alpha block indices
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static void ResizeImageData(const unsigned char *input, int width, int height, unsigned char *output, int newWidth, int newHeight, int channels);  // Resize pixel data (8bit per channel)
+static void ResizeImageBand(void *data, int start, int end);        // Resize job: output rows band
+static void ColorTintBand(void *data, int start, int end);          // Color tint job: rows band
+static void ColorContrastBand(void *data, int start, int end);      // Color contrast job: rows band
+static void ColorBrightnessBand(void *data, int start, int end);    // Color brightness job: rows band
+#endif
+static TextureRequest *GetTextureRequest(int request);              // Get async texture request from id (NULL if not valid)
+static void UnloadTextureRequest(int request);                      // Unload async texture request, slot is reused
+static void LoadTextureAsyncJob(void *data);                        // Async texture job: decode image data (worker thread)
+static void LoadTextureAsyncFinish(void *data);                     // Async texture job finished: image ready to upload
+static void LoadTextureAsyncCancel(void *data);                     // Async texture job cancelled: request failed
+static int UploadTextureRequest(TextureRequest *request, int bytes);    // Upload async texture request image data, returns uploaded bytes
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+static int ScanGIFFrames(const unsigned char *fileData, unsigned int fileSize, int **delays);  // Scan GIF file blocks to get frames count and delays
+static void ResetImageStreamDecoder(ImageStreamData *data);         // Reset image stream GIF decoder to file start
+static bool DecodeImageStreamFrame(ImageStreamData *data, int frame, unsigned char *output);  // Decode image stream frame (RGBA)
+static void DecodeImageStreamNext(ImageStreamData *data);           // Launch image stream next frame decoding (if required)
+static void DecodeImageStreamJob(void *arg);                        // Image stream job: decode frame (worker thread)
+static void DecodeImageStreamFinish(void *arg);                     // Image stream job finished: frame ready to be shown
+static void DecodeImageStreamCancel(void *arg);                     // Image stream job cancelled: decoding stopped
+static void UnloadImageStreamData(ImageStreamData *data);           // Unload image stream data
+#endif
+
+static void QueueTextureReadback(TextureReadback *readback);        // Add pixels readback to pending readbacks list
+static void RetrieveTextureReadback(TextureReadback *readback, bool async);     // Retrieve pixels readback data, screen pixels processed on async workers (if requested)
+static void ProcessScreenReadback(void *data);                      // Screen readback job: flip lines and set alpha (worker thread)
+static void ProcessScreenReadbackFinish(void *data);                // Screen readback job finished: image ready
+static void ProvideTextureReadbacks(void);                          // Provide ready readbacks images to callbacks (requests order)
+
+extern void UpdateTexturesAsync(void);      // Upload decoded async textures, called on BeginDrawing()
+extern void UnloadTexturesAsync(void);      // Unload async texture requests, called on CloseWindow()
+extern void ReadScreenDataAsync(int width, int height, ImageReadCallback callback, void *userData);    // Request screen pixels readback
+extern void UpdateTextureReadbacks(void);   // Retrieve available pixels readbacks, called on BeginDrawing()
+extern void FlushTextureReadbacks(void);    // Retrieve all pending pixels readbacks (stalls), called on CloseWindow()
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -259,6 +484,7 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
 //  - Number of frames is returned through 'frames' parameter
 //  - All frames are returned in RGBA format
 //  - Frames delay data is discarded
+//  - Long animations should be played with LoadImageStream() (frames decoded on demand)
 Image LoadImageAnim(const char *fileName, int *frames)
 {
     Image image = { 0 };
@@ -299,8 +525,9 @@ Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, i
 {
     Image image = { 0 };
 
+    // NOTE: Extension is lowercased locally (no TextToLower() static buffer), this function is called from async loading workers
     char fileExtLower[16] = { 0 };
-    strcpy(fileExtLower, TextToLower(fileType));
+    for (int i = 0; (i < 15) && (fileType[i] != '\0'); i++) fileExtLower[i] = (char)tolower((unsigned char)fileType[i]);
 
 #if defined(SUPPORT_FILEFORMAT_PNG)
     if ((TextIsEqual(fileExtLower, "png"))
@@ -385,12 +612,63 @@ Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, i
 #endif
     else TRACELOG(LOG_WARNING, "IMAGE: File format not supported");
 
+    // Container formats loaders could return image data pointing to file data (zero-copy),
+    // in that case, data is copied for the image to own it
+    if ((image.data != NULL) && ((unsigned char *)image.data >= fileData) && ((unsigned char *)image.data < (fileData + dataSize))) image = ImageCopy(image);
+
+    return image;
+}
+
+// Load image from container file (DDS, KTX, PVR, ASTC) through a file memory mapping
+// NOTE: Compressed image data points directly to the mapping (no data copies), file is unmapped on UnloadImage(),
+// mapped data is read-only (image manipulation functions do not support compressed formats),
+// uncompressed data is copied and other file formats are loaded as usual
+Image LoadImageMapped(const char *fileName)
+{
+    Image image = { 0 };
+
+    if (!IsFileExtension(fileName, ".dds;.ktx;.pvr;.astc")) return LoadImage(fileName);
+
+    unsigned int fileSize = 0;
+    unsigned char *fileData = LoadFileDataMapped(fileName, &fileSize);
+
+    if (fileData != NULL)
+    {
+        if (false) { }
+#if defined(SUPPORT_FILEFORMAT_DDS)
+        else if (IsFileExtension(fileName, ".dds")) image = LoadDDS(fileData, fileSize);
+#endif
+#if defined(SUPPORT_FILEFORMAT_KTX)
+        else if (IsFileExtension(fileName, ".ktx")) image = LoadKTX(fileData, fileSize);
+#endif
+#if defined(SUPPORT_FILEFORMAT_PVR)
+        else if (IsFileExtension(fileName, ".pvr")) image = LoadPVR(fileData, fileSize);
+#endif
+#if defined(SUPPORT_FILEFORMAT_ASTC)
+        else if (IsFileExtension(fileName, ".astc")) image = LoadASTC(fileData, fileSize);
+#endif
+        else TRACELOG(LOG_WARNING, "IMAGE: File format not supported");
+
+        // Keep file mapped only if compressed image data points to it, uncompressed data is copied for the image to own it
+        if ((image.data == NULL) || ((unsigned char *)image.data < fileData) || ((unsigned char *)image.data >= (fileData + fileSize))) UnloadFileDataMapped(fileData);
+        else if (image.format < COMPRESSED_DXT1_RGB)
+        {
+            image = ImageCopy(image);
+            UnloadFileDataMapped(fileData);
+        }
+        else TRACELOG(LOG_INFO, "IMAGE: [%s] Data mapped successfully (%ix%i)", fileName, image.width, image.height);
+    }
+
     return image;
 }
 
 // Unload image from CPU memory (RAM)
+// NOTE: Compressed image data pointing to a file memory mapping (LoadImageMapped()) is unmapped, never freed,
+// mapped files are only looked up for compressed formats
 void UnloadImage(Image image)
 {
+    if ((image.format >= COMPRESSED_DXT1_RGB) && UnloadFileDataMapped(image.data)) return;
+
     RL_FREE(image.data);
 }
 
@@ -401,6 +679,13 @@ bool ExportImage(Image image, const char *fileName)
     int success = 0;
 
 #if defined(SUPPORT_IMAGE_EXPORT)
+    // NOTE: Compressed data is exported as is, only to container file formats (or raw data)
+    if ((image.format >= COMPRESSED_DXT1_RGB) && !IsFileExtension(fileName, ".ktx;.dds;.raw"))
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export image, compressed data can only be exported as KTX, DDS or RAW", fileName);
+        return false;
+    }
+
     int channels = 4;
     bool allocatedData = false;
     unsigned char *imgData = (unsigned char *)image.data;
@@ -409,7 +694,7 @@ bool ExportImage(Image image, const char *fileName)
     else if (image.format == UNCOMPRESSED_GRAY_ALPHA) channels = 2;
     else if (image.format == UNCOMPRESSED_R8G8B8) channels = 3;
     else if (image.format == UNCOMPRESSED_R8G8B8A8) channels = 4;
-    else
+    else if (image.format < COMPRESSED_DXT1_RGB)
     {
         // NOTE: Getting Color array as RGBA unsigned char values
         imgData = (unsigned char *)LoadImageColors(image);
@@ -432,6 +717,9 @@ bool ExportImage(Image image, const char *fileName)
 #endif
 #if defined(SUPPORT_FILEFORMAT_KTX)
     else if (IsFileExtension(fileName, ".ktx")) success = SaveKTX(image, fileName);
+#endif
+#if defined(SUPPORT_FILEFORMAT_DDS)
+    else if (IsFileExtension(fileName, ".dds")) success = SaveDDS(image, fileName);
 #endif
     else if (IsFileExtension(fileName, ".raw"))
     {
@@ -766,6 +1054,19 @@ Image GenImageCellular(int width, int height, int tileSize)
 //------------------------------------------------------------------------------------
 // Image manipulation functions
 //------------------------------------------------------------------------------------
+// Set threads used by image processing functions (1 means serial processing)
+// NOTE: Images are split in rows bands, results are the same as serial processing
+void SetImageProcessingThreads(int count)
+{
+    if (count < 1) count = 1;
+
+#if !defined(SUPPORT_THREADS)
+    if (count > 1) TRACELOG(LOG_WARNING, "IMAGE: Threads support not enabled, image processing is serial");
+#endif
+
+    imageThreads = count;
+}
+
 // Copy an image to a new image
 Image ImageCopy(Image image)
 {
@@ -871,7 +1172,7 @@ void ImageCrop(Image *image, Rectangle crop)
         }
         */
 
-        RL_FREE(image->data);
+        UnloadImage(*image);
         image->data = croppedData;
         image->width = (int)crop.width;
         image->height = (int)crop.height;
@@ -884,13 +1185,16 @@ void ImageFormat(Image *image, int newFormat)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    // Direct conversion for common uncompressed formats, generic conversion through normalized data otherwise
+    if ((newFormat != 0) && (image->format != newFormat) && ImageFormatDirect(image, newFormat)) return;
+
     if ((newFormat != 0) && (image->format != newFormat))
     {
         if ((image->format < COMPRESSED_DXT1_RGB) && (newFormat < COMPRESSED_DXT1_RGB))
         {
             Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
 
-            RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
+            UnloadImage(*image);      // WARNING! We loose mipmaps data --> Regenerated at the end...
             image->data = NULL;
             image->format = newFormat;
 
@@ -1050,10 +1354,75 @@ void ImageFormat(Image *image, int newFormat)
             #endif
             }
         }
+        else if ((image->format < COMPRESSED_DXT1_RGB) && (newFormat >= COMPRESSED_DXT1_RGB)) ImageCompress(image, newFormat, 1);
         else TRACELOG(LOG_WARNING, "IMAGE: Data format is compressed, can not be converted");
     }
 }
 
+// Compress image data to block compressed format (DXT1, DXT3, DXT5, ETC1, ETC2, ETC2_EAC)
+// NOTE: Image mipmaps levels are compressed one by one, quality goes from 0 (fastest) to 2 (best),
+// 4x4 blocks are compressed independently and split in blocks rows bands if image processing threads enabled
+void ImageCompress(Image *image, int newFormat, int quality)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Data format is compressed, can not be compressed again");
+        return;
+    }
+
+    if ((newFormat < COMPRESSED_DXT1_RGB) || (newFormat > COMPRESSED_ETC2_EAC_RGBA))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Compressed format not supported for compression (%i)", newFormat);
+        return;
+    }
+
+    if (quality < 0) quality = 0;
+    else if (quality > 2) quality = 2;
+
+    int mipmaps = (image->mipmaps > 1)? image->mipmaps : 1;
+    int dataSize = 0;
+
+    for (int i = 0, width = image->width, height = image->height; i < mipmaps; i++)
+    {
+        dataSize += GetPixelDataSize(width, height, newFormat);
+
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    unsigned char *data = (unsigned char *)RL_MALLOC(dataSize);
+
+    Image level = *image;
+    int srcOffset = 0;
+    int dstOffset = 0;
+
+    for (int i = 0; i < mipmaps; i++)
+    {
+        level.data = (unsigned char *)image->data + srcOffset;
+        level.mipmaps = 1;
+
+        Color *pixels = LoadImageColors(level);
+
+        CompressJob job = { pixels, level.width, level.height, data + dstOffset, newFormat, quality };
+        RunParallelJob(CompressBlocksBand, &job, (level.height + 3)/4, GetImageJobThreads(level.width, level.height));
+
+        UnloadImageColors(pixels);
+
+        srcOffset += GetPixelDataSize(level.width, level.height, image->format);
+        dstOffset += GetPixelDataSize(level.width, level.height, newFormat);
+
+        level.width = (level.width > 1)? level.width/2 : 1;
+        level.height = (level.height > 1)? level.height/2 : 1;
+    }
+
+    UnloadImage(*image);
+    image->data = data;
+    image->format = newFormat;
+}
+
 // Convert image to POT (power-of-two)
 // NOTE: It could be useful on OpenGL ES 2.0 (RPI, HTML5)
 void ImageToPOT(Image *image, Color fill)
@@ -1279,7 +1648,7 @@ void ImageAlphaMask(Image *image, Image alphaMask)
                 data[k + 1] = ((unsigned char *)mask.data)[i];
             }
 
-            RL_FREE(image->data);
+            UnloadImage(*image);
             image->data = data;
             image->format = UNCOMPRESSED_GRAY_ALPHA;
         }
@@ -1325,7 +1694,7 @@ void ImageAlphaPremultiply(Image *image)
         }
     }
 
-    RL_FREE(image->data);
+    UnloadImage(*image);
 
     int format = image->format;
     image->data = pixels;
@@ -1344,7 +1713,7 @@ void ImageResize(Image *image, int newWidth, int newHeight)
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
     bool fastPath = true;
-    if ((image->format != UNCOMPRESSED_GRAYSCALE) && (image->format != UNCOMPRESSED_GRAY_ALPHA) && (image->format != UNCOMPRESSED_R8G8B8) && (image->format != UNCOMPRESSED_R8G8B8A8)) fastPath = true;
+    if ((image->format != UNCOMPRESSED_GRAYSCALE) && (image->format != UNCOMPRESSED_GRAY_ALPHA) && (image->format != UNCOMPRESSED_R8G8B8) && (image->format != UNCOMPRESSED_R8G8B8A8)) fastPath = false;
 
     if (fastPath)
     {
@@ -1353,14 +1722,14 @@ void ImageResize(Image *image, int newWidth, int newHeight)
 
         switch (image->format)
         {
-            case UNCOMPRESSED_GRAYSCALE: stbir_resize_uint8((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, 1); break;
-            case UNCOMPRESSED_GRAY_ALPHA: stbir_resize_uint8((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, 2); break;
-            case UNCOMPRESSED_R8G8B8: stbir_resize_uint8((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, 3); break;
-            case UNCOMPRESSED_R8G8B8A8: stbir_resize_uint8((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, 4); break;
+            case UNCOMPRESSED_GRAYSCALE: ResizeImageData((unsigned char *)image->data, image->width, image->height, output, newWidth, newHeight, 1); break;
+            case UNCOMPRESSED_GRAY_ALPHA: ResizeImageData((unsigned char *)image->data, image->width, image->height, output, newWidth, newHeight, 2); break;
+            case UNCOMPRESSED_R8G8B8: ResizeImageData((unsigned char *)image->data, image->width, image->height, output, newWidth, newHeight, 3); break;
+            case UNCOMPRESSED_R8G8B8A8: ResizeImageData((unsigned char *)image->data, image->width, image->height, output, newWidth, newHeight, 4); break;
             default: break;
         }
 
-        RL_FREE(image->data);
+        UnloadImage(*image);
         image->data = output;
         image->width = newWidth;
         image->height = newHeight;
@@ -1372,12 +1741,12 @@ void ImageResize(Image *image, int newWidth, int newHeight)
         Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
 
         // NOTE: Color data is casted to (unsigned char *), there shouldn't been any problem...
-        stbir_resize_uint8((unsigned char *)pixels, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, 4);
+        ResizeImageData((unsigned char *)pixels, image->width, image->height, (unsigned char *)output, newWidth, newHeight, 4);
 
         int format = image->format;
 
         UnloadImageColors(pixels);
-        RL_FREE(image->data);
+        UnloadImage(*image);
 
         image->data = output;
         image->width = newWidth;
@@ -1415,7 +1784,7 @@ void ImageResizeNN(Image *image,int newWidth,int newHeight)
 
     int format = image->format;
 
-    RL_FREE(image->data);
+    UnloadImage(*image);
 
     image->data = output;
     image->width = newWidth;
@@ -1473,7 +1842,7 @@ void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, i
             dstOffsetSize += (newWidth*bytesPerPixel);
         }
 
-        RL_FREE(image->data);
+        UnloadImage(*image);
         image->data = resizedData;
         image->width = newWidth;
         image->height = newHeight;
@@ -1489,6 +1858,12 @@ void ImageMipmaps(Image *image)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Mipmaps generation not supported for compressed formats");
+        return;
+    }
+
     int mipCount = 1;                   // Required mipmap levels count (including base level)
     int mipWidth = image->width;        // Base image width
     int mipHeight = image->height;      // Base image height
@@ -1572,7 +1947,7 @@ void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
     {
         Color *pixels = LoadImageColors(*image);
 
-        RL_FREE(image->data);      // free old image data
+        UnloadImage(*image);      // free old image data
 
         if ((image->format != UNCOMPRESSED_R8G8B8) && (image->format != UNCOMPRESSED_R8G8B8A8))
         {
@@ -1662,6 +2037,45 @@ void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
     }
 }
 
+// Quantize image colors to a palette of up to maxPaletteSize (256 max) colors, image keeps its format
+// NOTE: Palette is computed with LoadImagePaletteQuantized(), pixels optionally Floyd-Steinberg dithered
+void ImageQuantize(Image *image, int maxPaletteSize, bool dither)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Compressed data formats can not be quantized");
+        return;
+    }
+
+    int colorsCount = 0;
+    Color *palette = LoadImagePaletteQuantized(*image, maxPaletteSize, &colorsCount);
+
+    if (colorsCount > 0)
+    {
+        Color *pixels = LoadImageColors(*image);
+        unsigned char *indices = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
+
+        MapPaletteIndices(pixels, image->width, image->height, palette, colorsCount, dither, indices);
+
+        for (int i = 0; i < image->width*image->height; i++) pixels[i] = palette[indices[i]];
+
+        RL_FREE(indices);
+
+        int format = image->format;
+        UnloadImage(*image);
+
+        image->data = pixels;
+        image->format = UNCOMPRESSED_R8G8B8A8;
+
+        ImageFormat(image, format);
+    }
+
+    UnloadImagePalette(palette);
+}
+
 // Flip image vertically
 void ImageFlipVertical(Image *image)
 {
@@ -1681,7 +2095,7 @@ void ImageFlipVertical(Image *image)
             offsetSize += image->width*bytesPerPixel;
         }
 
-        RL_FREE(image->data);
+        UnloadImage(*image);
         image->data = flippedData;
     }
 }
@@ -1711,7 +2125,7 @@ void ImageFlipHorizontal(Image *image)
             }
         }
 
-        RL_FREE(image->data);
+        UnloadImage(*image);
         image->data = flippedData;
 
         /*
@@ -1753,7 +2167,7 @@ void ImageRotateCW(Image *image)
             }
         }
 
-        RL_FREE(image->data);
+        UnloadImage(*image);
         image->data = rotatedData;
         int width = image->width;
         int height = image-> height;
@@ -1785,7 +2199,7 @@ void ImageRotateCCW(Image *image)
             }
         }
 
-        RL_FREE(image->data);
+        UnloadImage(*image);
         image->data = rotatedData;
         int width = image->width;
         int height = image-> height;
@@ -1803,30 +2217,11 @@ void ImageColorTint(Image *image, Color color)
 
     Color *pixels = LoadImageColors(*image);
 
-    float cR = (float)color.r/255;
-    float cG = (float)color.g/255;
-    float cB = (float)color.b/255;
-    float cA = (float)color.a/255;
-
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            int index = y * image->width + x;
-            unsigned char r = (unsigned char)(((float)pixels[index].r/255*cR)*255.0f);
-            unsigned char g = (unsigned char)(((float)pixels[index].g/255*cG)*255.0f);
-            unsigned char b = (unsigned char)(((float)pixels[index].b/255*cB)*255.0f);
-            unsigned char a = (unsigned char)(((float)pixels[index].a/255*cA)*255.0f);
-
-            pixels[y*image->width + x].r = r;
-            pixels[y*image->width + x].g = g;
-            pixels[y*image->width + x].b = b;
-            pixels[y*image->width + x].a = a;
-        }
-    }
+    ColorsJob job = { pixels, image->width, color, 0.0f, 0 };
+    RunParallelJob(ColorTintBand, &job, image->height, GetImageJobThreads(image->width, image->height));
 
     int format = image->format;
-    RL_FREE(image->data);
+    UnloadImage(*image);
 
     image->data = pixels;
     image->format = UNCOMPRESSED_R8G8B8A8;
@@ -1853,7 +2248,7 @@ void ImageColorInvert(Image *image)
     }
 
     int format = image->format;
-    RL_FREE(image->data);
+    UnloadImage(*image);
 
     image->data = pixels;
     image->format = UNCOMPRESSED_R8G8B8A8;
@@ -1882,42 +2277,11 @@ void ImageColorContrast(Image *image, float contrast)
 
     Color *pixels = LoadImageColors(*image);
 
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            float pR = (float)pixels[y*image->width + x].r/255.0f;
-            pR -= 0.5;
-            pR *= contrast;
-            pR += 0.5;
-            pR *= 255;
-            if (pR < 0) pR = 0;
-            if (pR > 255) pR = 255;
-
-            float pG = (float)pixels[y*image->width + x].g/255.0f;
-            pG -= 0.5;
-            pG *= contrast;
-            pG += 0.5;
-            pG *= 255;
-            if (pG < 0) pG = 0;
-            if (pG > 255) pG = 255;
-
-            float pB = (float)pixels[y*image->width + x].b/255.0f;
-            pB -= 0.5;
-            pB *= contrast;
-            pB += 0.5;
-            pB *= 255;
-            if (pB < 0) pB = 0;
-            if (pB > 255) pB = 255;
-
-            pixels[y*image->width + x].r = (unsigned char)pR;
-            pixels[y*image->width + x].g = (unsigned char)pG;
-            pixels[y*image->width + x].b = (unsigned char)pB;
-        }
-    }
+    ColorsJob job = { pixels, image->width, BLANK, contrast, 0 };
+    RunParallelJob(ColorContrastBand, &job, image->height, GetImageJobThreads(image->width, image->height));
 
     int format = image->format;
-    RL_FREE(image->data);
+    UnloadImage(*image);
 
     image->data = pixels;
     image->format = UNCOMPRESSED_R8G8B8A8;
@@ -1937,31 +2301,11 @@ void ImageColorBrightness(Image *image, int brightness)
 
     Color *pixels = LoadImageColors(*image);
 
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            int cR = pixels[y*image->width + x].r + brightness;
-            int cG = pixels[y*image->width + x].g + brightness;
-            int cB = pixels[y*image->width + x].b + brightness;
-
-            if (cR < 0) cR = 1;
-            if (cR > 255) cR = 255;
-
-            if (cG < 0) cG = 1;
-            if (cG > 255) cG = 255;
-
-            if (cB < 0) cB = 1;
-            if (cB > 255) cB = 255;
-
-            pixels[y*image->width + x].r = (unsigned char)cR;
-            pixels[y*image->width + x].g = (unsigned char)cG;
-            pixels[y*image->width + x].b = (unsigned char)cB;
-        }
-    }
+    ColorsJob job = { pixels, image->width, BLANK, 0.0f, brightness };
+    RunParallelJob(ColorBrightnessBand, &job, image->height, GetImageJobThreads(image->width, image->height));
 
     int format = image->format;
-    RL_FREE(image->data);
+    UnloadImage(*image);
 
     image->data = pixels;
     image->format = UNCOMPRESSED_R8G8B8A8;
@@ -1995,7 +2339,7 @@ void ImageColorReplace(Image *image, Color color, Color replace)
     }
 
     int format = image->format;
-    RL_FREE(image->data);
+    UnloadImage(*image);
 
     image->data = pixels;
     image->format = UNCOMPRESSED_R8G8B8A8;
@@ -2124,60 +2468,132 @@ Color *LoadImageColors(Image image)
 
 // Load colors palette from image as a Color array (RGBA - 32bit)
 // NOTE: Memory allocated should be freed using UnloadImagePalette()
+// NOTE: Palette colors are found with an open-addressing hash table, extraction stops when palette is full
 Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorsCount)
 {
-    #define COLOR_EQUAL(col1, col2) ((col1.r == col2.r)&&(col1.g == col2.g)&&(col1.b == col2.b)&&(col1.a == col2.a))
-
     int palCount = 0;
     Color *palette = NULL;
     Color *pixels = LoadImageColors(image);
 
-    if (pixels != NULL)
+    if ((pixels != NULL) && (maxPaletteSize > 0))
     {
         palette = (Color *)RL_MALLOC(maxPaletteSize*sizeof(Color));
 
         for (int i = 0; i < maxPaletteSize; i++) palette[i] = BLANK;   // Set all colors to BLANK
 
+        // Hash table keys are packed colors, 0 means empty slot (only colors with alpha > 0 are stored)
+        int tableBits = 1;
+        while ((1 << tableBits) < maxPaletteSize*2) tableBits++;
+        int tableSize = 1 << tableBits;
+
+        unsigned int *keys = (unsigned int *)RL_CALLOC(tableSize, sizeof(unsigned int));
+        unsigned int lastKey = 0;
+
         for (int i = 0; i < image.width*image.height; i++)
         {
-            if (pixels[i].a > 0)
-            {
-                bool colorInPalette = false;
+            if (pixels[i].a == 0) continue;
 
-                // Check if the color is already on palette
-                for (int j = 0; j < maxPaletteSize; j++)
-                {
-                    if (COLOR_EQUAL(pixels[i], palette[j]))
-                    {
-                        colorInPalette = true;
-                        break;
-                    }
-                }
+            unsigned int key = (unsigned int)pixels[i].r | ((unsigned int)pixels[i].g << 8) | ((unsigned int)pixels[i].b << 16) | ((unsigned int)pixels[i].a << 24);
 
-                // Store color if not on the palette
-                if (!colorInPalette)
-                {
-                    palette[palCount] = pixels[i];      // Add pixels[i] to palette
-                    palCount++;
+            if (key == lastKey) continue;   // Same color as previous pixel, already on palette
+            lastKey = key;
 
-                    // We reached the limit of colors supported by palette
-                    if (palCount >= maxPaletteSize)
-                    {
-                        i = image.width*image.height;   // Finish palette get
-                        TRACELOG(LOG_WARNING, "IMAGE: Palette is greater than %i colors", maxPaletteSize);
-                    }
+            unsigned int slot = (key*2654435761u) >> (32 - tableBits);     // Multiplicative hash
+
+            while ((keys[slot] != 0) && (keys[slot] != key)) slot = (slot + 1) & (tableSize - 1);
+
+            // Store color if not on the palette
+            if (keys[slot] == 0)
+            {
+                // We reached the limit of colors supported by palette
+                if (palCount >= maxPaletteSize)
+                {
+                    TRACELOG(LOG_WARNING, "IMAGE: Palette is greater than %i colors, use LoadImagePaletteQuantized() instead", maxPaletteSize);
+                    break;
                 }
+
+                keys[slot] = key;
+                palette[palCount] = pixels[i];      // Add pixels[i] to palette
+                palCount++;
             }
         }
 
-        UnloadImageColors(pixels);
+        RL_FREE(keys);
+    }
+
+    UnloadImageColors(pixels);
+
+    *colorsCount = palCount;
+
+    return palette;
+}
+
+// Load quantized colors palette from image as a Color array (RGBA - 32bit), up to maxPaletteSize (256 max) colors
+// NOTE: Colors are quantized with median-cut refined by k-means, using perceptually weighted distances,
+// one palette entry is reserved for BLANK if image contains fully transparent pixels
+// NOTE: Memory allocated should be freed using UnloadImagePalette()
+Color *LoadImagePaletteQuantized(Image image, int maxPaletteSize, int *colorsCount)
+{
+    int palCount = 0;
+    Color *palette = NULL;
+    Color *pixels = LoadImageColors(image);
+
+    if (maxPaletteSize > 256) maxPaletteSize = 256;
+
+    if ((pixels != NULL) && (maxPaletteSize > 0))
+    {
+        int count = image.width*image.height;
+        int opaqueCount = 0;
+        bool transparent = false;
+
+        for (int i = 0; (i < count) && !transparent; i++) transparent = (pixels[i].a == 0);
+
+        QuantizeColor *colors = LoadQuantizeColors(pixels, count, &opaqueCount);
+
+        palette = (Color *)RL_MALLOC(maxPaletteSize*sizeof(Color));
+
+        for (int i = 0; i < maxPaletteSize; i++) palette[i] = BLANK;   // Set all colors to BLANK
+
+        if (transparent && (maxPaletteSize > 1)) palCount = QuantizePalette(colors, opaqueCount, palette, maxPaletteSize - 1) + 1;
+        else palCount = QuantizePalette(colors, opaqueCount, palette, maxPaletteSize);
+
+        RL_FREE(colors);
     }
 
+    UnloadImageColors(pixels);
+
     *colorsCount = palCount;
 
     return palette;
 }
 
+// Load image pixels as palette colors indices (8bit), palette up to 256 colors
+// NOTE: Pixels are mapped to nearest palette color, optionally using Floyd-Steinberg dithering
+// NOTE: Memory allocated should be freed using UnloadImagePaletteIndices()
+unsigned char *LoadImagePaletteIndices(Image image, Color *palette, int colorsCount, bool dither)
+{
+    unsigned char *indices = NULL;
+
+    if ((palette == NULL) || (colorsCount <= 0) || (colorsCount > 256))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Palette is not valid to map image colors (1 to 256 colors)");
+        return NULL;
+    }
+
+    Color *pixels = LoadImageColors(image);
+
+    if (pixels != NULL)
+    {
+        indices = (unsigned char *)RL_MALLOC(image.width*image.height*sizeof(unsigned char));
+
+        MapPaletteIndices(pixels, image.width, image.height, palette, colorsCount, dither, indices);
+
+        UnloadImageColors(pixels);
+    }
+
+    return indices;
+}
+
 // Unload color data loaded with LoadImageColors()
 void UnloadImageColors(Color *colors)
 {
@@ -2190,6 +2606,12 @@ void UnloadImagePalette(Color *colors)
     RL_FREE(colors);
 }
 
+// Unload palette colors indices loaded with LoadImagePaletteIndices()
+void UnloadImagePaletteIndices(unsigned char *indices)
+{
+    RL_FREE(indices);
+}
+
 // Get pixel data from image as Vector4 array (float normalized)
 static Vector4 *LoadImageDataNormalized(Image image)
 {
@@ -2301,1519 +2723,3806 @@ static Vector4 *LoadImageDataNormalized(Image image)
     return pixels;
 }
 
-// Get image alpha border rectangle
-// NOTE: Threshold is defined as a percentatge: 0.0f -> 1.0f
-Rectangle GetImageAlphaBorder(Image image, float threshold)
+// Convert image data between common uncompressed formats directly (no normalized data), returns false if not supported
+// NOTE: Same as ImageFormat() generic conversion, mipmaps are regenerated for the new format
+static bool ImageFormatDirect(Image *image, int newFormat)
 {
-    Rectangle crop = { 0 };
+    if ((image->format >= COMPRESSED_DXT1_RGB) || (newFormat >= COMPRESSED_DXT1_RGB)) return false;
 
-    Color *pixels = LoadImageColors(image);
+    void *data = RL_MALLOC(GetPixelDataSize(image->width, image->height, newFormat));
 
-    if (pixels != NULL)
+    if (!ConvertPixelData(image->data, image->format, data, newFormat, image->width*image->height))
     {
-        int xMin = 65536;   // Define a big enough number
-        int xMax = 0;
-        int yMin = 65536;
-        int yMax = 0;
+        RL_FREE(data);
+        return false;
+    }
 
-        for (int y = 0; y < image.height; y++)
-        {
-            for (int x = 0; x < image.width; x++)
-            {
-                if (pixels[y*image.width + x].a > (unsigned char)(threshold*255.0f))
-                {
-                    if (x < xMin) xMin = x;
-                    if (x > xMax) xMax = x;
-                    if (y < yMin) yMin = y;
-                    if (y > yMax) yMax = y;
-                }
-            }
-        }
-
-        // Check for empty blank image
-        if ((xMin != 65536) && (xMax != 65536))
-        {
-            crop = (Rectangle){ (float)xMin, (float)yMin, (float)((xMax + 1) - xMin), (float)((yMax + 1) - yMin) };
-        }
+    UnloadImage(*image);      // WARNING! We loose mipmaps data --> Regenerated at the end...
+    image->data = data;
+    image->format = newFormat;
 
-        UnloadImageColors(pixels);
+    // In case original image had mipmaps, generate mipmaps for formated image
+    // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
+    if (image->mipmaps > 1)
+    {
+        image->mipmaps = 1;
+    #if defined(SUPPORT_IMAGE_MANIPULATION)
+        ImageMipmaps(image);
+    #endif
     }
 
-    return crop;
-}
-
-//------------------------------------------------------------------------------------
-// Image drawing functions
-//------------------------------------------------------------------------------------
-// Clear image background with given color
-void ImageClearBackground(Image *dst, Color color)
-{
-    for (int i = 0; i < dst->width*dst->height; ++i) ImageDrawPixel(dst, i%dst->width, i/dst->height, color);
+    return true;
 }
 
-// Draw pixel within an image
-// NOTE: Compressed image formats not supported
-void ImageDrawPixel(Image *dst, int x, int y, Color color)
+// Convert pixel data between uncompressed formats, avoiding intermediate normalized data
+// NOTE: Only 8bit per channel sources (and 32bit float RGB/RGBA sources to 8bit RGB/RGBA) supported,
+// values are computed with the same operations used by ImageFormat() generic conversion (same results)
+static bool ConvertPixelData(const void *srcData, int srcFormat, void *dstData, int dstFormat, int count)
 {
-    // Security check to avoid program crash
-    if ((dst->data == NULL) || (x < 0) || (x >= dst->width) || (y < 0) || (y >= dst->height)) return;
-
-    switch (dst->format)
+    if ((srcFormat == UNCOMPRESSED_R32G32B32) || (srcFormat == UNCOMPRESSED_R32G32B32A32))
     {
-        case UNCOMPRESSED_GRAYSCALE:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+        // Float to 8bit per channel conversion
+        if ((dstFormat != UNCOMPRESSED_R8G8B8) && (dstFormat != UNCOMPRESSED_R8G8B8A8)) return false;
 
-            ((unsigned char *)dst->data)[y*dst->width + x] = gray;
+        const float *src = (const float *)srcData;
+        unsigned char *dst = (unsigned char *)dstData;
+        int srcChannels = (srcFormat == UNCOMPRESSED_R32G32B32)? 3 : 4;
+        int dstChannels = (dstFormat == UNCOMPRESSED_R8G8B8)? 3 : 4;
 
-        } break;
-        case UNCOMPRESSED_GRAY_ALPHA:
+        for (int i = 0; i < count; i++, src += srcChannels, dst += dstChannels)
         {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
-
-            ((unsigned char *)dst->data)[(y*dst->width + x)*2] = gray;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*2 + 1] = color.a;
+            dst[0] = (unsigned char)(src[0]*255.0f);
+            dst[1] = (unsigned char)(src[1]*255.0f);
+            dst[2] = (unsigned char)(src[2]*255.0f);
+            if (dstChannels == 4) dst[3] = (srcChannels == 4)? (unsigned char)(src[3]*255.0f) : 255;
+        }
 
-        } break;
-        case UNCOMPRESSED_R5G6B5:
-        {
-            // NOTE: Calculate R5G6B5 equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+        return true;
+    }
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*63.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+    // Source channels offsets (grayscale replicated to RGB, alpha offset -1 means opaque)
+    int srcChannels = 0;
+    int ro = 0, go = 0, bo = 0, ao = -1;
 
-            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+    switch (srcFormat)
+    {
+        case UNCOMPRESSED_GRAYSCALE: srcChannels = 1; break;
+        case UNCOMPRESSED_GRAY_ALPHA: srcChannels = 2; ao = 1; break;
+        case UNCOMPRESSED_R8G8B8: srcChannels = 3; go = 1; bo = 2; break;
+        case UNCOMPRESSED_R8G8B8A8: srcChannels = 4; go = 1; bo = 2; ao = 3; break;
+        default: return false;
+    }
 
-        } break;
-        case UNCOMPRESSED_R5G5B5A1:
-        {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+    const unsigned char *src = (const unsigned char *)srcData;
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*31.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
-            unsigned char a = (coln.w > ((float)UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;;
+    // Normalized channel values lookup table
+    // NOTE: (unsigned char)(norm[v]*255.0f) == v for all 8bit values, channels are copied directly
+    float norm[256] = { 0 };
+    for (int v = 0; v < 256; v++) norm[v] = (float)v/255.0f;
 
-            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+    switch (dstFormat)
+    {
+        case UNCOMPRESSED_GRAYSCALE:
+        {
+            unsigned char *dst = (unsigned char *)dstData;
 
+            for (int i = 0; i < count; i++, src += srcChannels)
+            {
+                dst[i] = (unsigned char)((norm[src[ro]]*0.299f + norm[src[go]]*0.587f + norm[src[bo]]*0.114f)*255.0f);
+            }
         } break;
-        case UNCOMPRESSED_R4G4B4A4:
+        case UNCOMPRESSED_GRAY_ALPHA:
         {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
-
-            unsigned char r = (unsigned char)(round(coln.x*15.0f));
-            unsigned char g = (unsigned char)(round(coln.y*15.0f));
-            unsigned char b = (unsigned char)(round(coln.z*15.0f));
-            unsigned char a = (unsigned char)(round(coln.w*15.0f));
-
-            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+            unsigned char *dst = (unsigned char *)dstData;
 
+            for (int i = 0; i < count; i++, src += srcChannels, dst += 2)
+            {
+                dst[0] = (unsigned char)((norm[src[ro]]*0.299f + norm[src[go]]*0.587f + norm[src[bo]]*0.114f)*255.0f);
+                dst[1] = (ao >= 0)? src[ao] : 255;
+            }
         } break;
         case UNCOMPRESSED_R8G8B8:
         {
-            ((unsigned char *)dst->data)[(y*dst->width + x)*3] = color.r;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*3 + 1] = color.g;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*3 + 2] = color.b;
+            unsigned char *dst = (unsigned char *)dstData;
 
+            if (srcFormat == UNCOMPRESSED_R8G8B8) memcpy(dst, src, count*3);
+            else
+            {
+                for (int i = 0; i < count; i++, src += srcChannels, dst += 3)
+                {
+                    dst[0] = src[ro];
+                    dst[1] = src[go];
+                    dst[2] = src[bo];
+                }
+            }
         } break;
         case UNCOMPRESSED_R8G8B8A8:
         {
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4] = color.r;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 1] = color.g;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 2] = color.b;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 3] = color.a;
+            unsigned char *dst = (unsigned char *)dstData;
 
+            if (srcFormat == UNCOMPRESSED_R8G8B8A8) memcpy(dst, src, count*4);
+            else
+            {
+                for (int i = 0; i < count; i++, src += srcChannels, dst += 4)
+                {
+                    dst[0] = src[ro];
+                    dst[1] = src[go];
+                    dst[2] = src[bo];
+                    dst[3] = (ao >= 0)? src[ao] : 255;
+                }
+            }
         } break;
-        case UNCOMPRESSED_R32:
+        case UNCOMPRESSED_R5G6B5:
+        case UNCOMPRESSED_R5G5B5A1:
+        case UNCOMPRESSED_R4G4B4A4:
         {
-            // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            // Quantized channel values lookup tables
+            unsigned short r5[256] = { 0 };
+            unsigned short g6[256] = { 0 };
+            unsigned short c4[256] = { 0 };
 
-            ((float *)dst->data)[y*dst->width + x] = coln.x*0.299f + coln.y*0.587f + coln.z*0.114f;
+            for (int v = 0; v < 256; v++)
+            {
+                r5[v] = (unsigned char)(round(norm[v]*31.0f));
+                g6[v] = (unsigned char)(round(norm[v]*63.0f));
+                c4[v] = (unsigned char)(round(norm[v]*15.0f));
+            }
 
+            unsigned short *dst = (unsigned short *)dstData;
+
+            if (dstFormat == UNCOMPRESSED_R5G6B5)
+            {
+                for (int i = 0; i < count; i++, src += srcChannels) dst[i] = r5[src[ro]] << 11 | g6[src[go]] << 5 | r5[src[bo]];
+            }
+            else if (dstFormat == UNCOMPRESSED_R5G5B5A1)
+            {
+                for (int i = 0; i < count; i++, src += srcChannels)
+                {
+                    unsigned short a = (ao < 0) || (norm[src[ao]] > ((float)UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f));
+                    dst[i] = r5[src[ro]] << 11 | r5[src[go]] << 6 | r5[src[bo]] << 1 | a;
+                }
+            }
+            else
+            {
+                for (int i = 0; i < count; i++, src += srcChannels) dst[i] = c4[src[ro]] << 12 | c4[src[go]] << 8 | c4[src[bo]] << 4 | ((ao >= 0)? c4[src[ao]] : 15);
+            }
         } break;
-        case UNCOMPRESSED_R32G32B32:
+        case UNCOMPRESSED_R32:
         {
-            // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            float *dst = (float *)dstData;
 
-            ((float *)dst->data)[(y*dst->width + x)*3] = coln.x;
-            ((float *)dst->data)[(y*dst->width + x)*3 + 1] = coln.y;
-            ((float *)dst->data)[(y*dst->width + x)*3 + 2] = coln.z;
+            for (int i = 0; i < count; i++, src += srcChannels)
+            {
+                dst[i] = (float)(norm[src[ro]]*0.299f + norm[src[go]]*0.587f + norm[src[bo]]*0.114f);
+            }
         } break;
+        case UNCOMPRESSED_R32G32B32:
         case UNCOMPRESSED_R32G32B32A32:
         {
-            // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
-
-            ((float *)dst->data)[(y*dst->width + x)*4] = coln.x;
-            ((float *)dst->data)[(y*dst->width + x)*4 + 1] = coln.y;
-            ((float *)dst->data)[(y*dst->width + x)*4 + 2] = coln.z;
-            ((float *)dst->data)[(y*dst->width + x)*4 + 3] = coln.w;
+            float *dst = (float *)dstData;
+            int dstChannels = (dstFormat == UNCOMPRESSED_R32G32B32)? 3 : 4;
 
+            for (int i = 0; i < count; i++, src += srcChannels, dst += dstChannels)
+            {
+                dst[0] = norm[src[ro]];
+                dst[1] = norm[src[go]];
+                dst[2] = norm[src[bo]];
+                if (dstChannels == 4) dst[3] = (ao >= 0)? norm[src[ao]] : 1.0f;
+            }
         } break;
-        default: break;
+        default: return false;
     }
-}
 
-// Draw pixel within an image (Vector version)
-void ImageDrawPixelV(Image *dst, Vector2 position, Color color)
-{
-    ImageDrawPixel(dst, (int)position.x, (int)position.y, color);
+    return true;
 }
 
-// Draw line within an image
-void ImageDrawLine(Image *dst, int startPosX, int startPosY, int endPosX, int endPosY, Color color)
+// Fill image rectangle with color
+// NOTE: First pixel is formatted as ImageDrawPixel(), then replicated along first row
+// and first row copied to following rows, rectangle must be inside image bounds
+static void ImageFillRectangle(Image *dst, int x, int y, int width, int height, Color color)
 {
-    int m = 2*(endPosY - startPosY);
-    int slopeError = m - (endPosX - startPosX);
+    if (dst->format >= COMPRESSED_DXT1_RGB) return;
 
-    for (int x = startPosX, y = startPosY; x <= endPosX; x++)
-    {
-        ImageDrawPixel(dst, x, y, color);
-        slopeError += m;
+    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    int stride = dst->width*bytesPerPixel;
+    unsigned char *pRow = (unsigned char *)dst->data + (y*dst->width + x)*bytesPerPixel;
 
-        if (slopeError >= 0)
-        {
-            y++;
-            slopeError -= 2*(endPosX - startPosX);
-        }
+    ImageDrawPixel(dst, x, y, color);
+
+    // Replicate pixel doubling the copied size on every step
+    for (int filled = 1; filled < width; filled *= 2)
+    {
+        int count = ((width - filled) < filled)? (width - filled) : filled;
+        memcpy(pRow + filled*bytesPerPixel, pRow, count*bytesPerPixel);
     }
-}
 
-// Draw line within an image (Vector version)
-void ImageDrawLineV(Image *dst, Vector2 start, Vector2 end, Color color)
-{
-    ImageDrawLine(dst, (int)start.x, (int)start.y, (int)end.x, (int)end.y, color);
+    for (int i = 1; i < height; i++) memcpy(pRow + i*stride, pRow, width*bytesPerPixel);
 }
 
-// Draw circle within an image
-void ImageDrawCircle(Image *dst, int centerX, int centerY, int radius, Color color)
+// Blend pixels row (source) over destination pixels, color tint is applied to source
+// NOTE: Results match ColorAlphaBlend() per pixel, supported sources: GRAYSCALE, GRAY_ALPHA, R8G8B8, R8G8B8A8,
+// supported destinations: R8G8B8, R8G8B8A8. Transparent pixels are skipped and common destination
+// alpha values (0 and 255) are resolved without divisions
+static void BlendPixelsRow(unsigned char *dst, int dstFormat, const unsigned char *src, int srcFormat, int count, Color tint)
 {
-    int x = 0, y = radius;
-    int decesionParameter = 3 - 2*radius;
+    // Source channels offsets (grayscale replicated to RGB, alpha offset -1 means opaque)
+    int srcChannels = 1;
+    int ro = 0, go = 0, bo = 0, ao = -1;
 
-    while (y >= x)
+    switch (srcFormat)
     {
-        ImageDrawPixel(dst, centerX + x, centerY + y, color);
-        ImageDrawPixel(dst, centerX - x, centerY + y, color);
-        ImageDrawPixel(dst, centerX + x, centerY - y, color);
-        ImageDrawPixel(dst, centerX - x, centerY - y, color);
-        ImageDrawPixel(dst, centerX + y, centerY + x, color);
-        ImageDrawPixel(dst, centerX - y, centerY + x, color);
-        ImageDrawPixel(dst, centerX + y, centerY - x, color);
-        ImageDrawPixel(dst, centerX - y, centerY - x, color);
-        x++;
+        case UNCOMPRESSED_GRAY_ALPHA: srcChannels = 2; ao = 1; break;
+        case UNCOMPRESSED_R8G8B8: srcChannels = 3; go = 1; bo = 2; break;
+        case UNCOMPRESSED_R8G8B8A8: srcChannels = 4; go = 1; bo = 2; ao = 3; break;
+        default: break;
+    }
 
-        if (decesionParameter > 0)
+    int dstChannels = (dstFormat == UNCOMPRESSED_R8G8B8A8)? 4 : 3;
+
+    for (int i = 0; i < count; i++, src += srcChannels, dst += dstChannels)
+    {
+        // Apply color tint to source color
+        unsigned int sa = ((unsigned int)((ao >= 0)? src[ao] : 255)*tint.a) >> 8;
+
+        if (sa == 0) continue;      // Transparent source pixel, destination unchanged
+
+        unsigned int sr = ((unsigned int)src[ro]*tint.r) >> 8;
+        unsigned int sg = ((unsigned int)src[go]*tint.g) >> 8;
+        unsigned int sb = ((unsigned int)src[bo]*tint.b) >> 8;
+        unsigned int da = (dstChannels == 4)? dst[3] : 255;
+
+        if ((sa == 255) || (da == 0))
         {
-            y--;
-            decesionParameter = decesionParameter + 4*(x - y) + 10;
+            // Opaque source or transparent destination: source color, alpha equivalent to ColorAlphaBlend()
+            dst[0] = (unsigned char)sr;
+            dst[1] = (unsigned char)sg;
+            dst[2] = (unsigned char)sb;
+            if (dstChannels == 4) dst[3] = (unsigned char)((sa == 255)? 255 : (sa + 1));
+        }
+        else
+        {
+            unsigned int alpha = sa + 1;
+            unsigned int oa = (alpha*256 + da*(256 - alpha)) >> 8;
+
+            if (da == 255)
+            {
+                // Opaque destination: output alpha is always 255
+                dst[0] = (unsigned char)(((sr*alpha*256 + (unsigned int)dst[0]*255*(256 - alpha))/255) >> 8);
+                dst[1] = (unsigned char)(((sg*alpha*256 + (unsigned int)dst[1]*255*(256 - alpha))/255) >> 8);
+                dst[2] = (unsigned char)(((sb*alpha*256 + (unsigned int)dst[2]*255*(256 - alpha))/255) >> 8);
+            }
+            else
+            {
+                dst[0] = (unsigned char)(((sr*alpha*256 + (unsigned int)dst[0]*da*(256 - alpha))/oa) >> 8);
+                dst[1] = (unsigned char)(((sg*alpha*256 + (unsigned int)dst[1]*da*(256 - alpha))/oa) >> 8);
+                dst[2] = (unsigned char)(((sb*alpha*256 + (unsigned int)dst[2]*da*(256 - alpha))/oa) >> 8);
+            }
+
+            if (dstChannels == 4) dst[3] = (unsigned char)oa;
         }
-        else decesionParameter = decesionParameter + 4*x + 6;
     }
 }
 
-// Draw circle within an image (Vector version)
-void ImageDrawCircleV(Image *dst, Vector2 center, int radius, Color color)
+// Get threads to process an image of provided size
+static int GetImageJobThreads(int width, int height)
 {
-    ImageDrawCircle(dst, (int)center.x, (int)center.y, radius, color);
+    return ((width*height) >= IMAGE_PARALLEL_MIN_PIXELS)? imageThreads : 1;
 }
 
-// Draw rectangle within an image
-void ImageDrawRectangle(Image *dst, int posX, int posY, int width, int height, Color color)
+// Get async texture request from id (NULL if not valid)
+// NOTE: Ids of released requests are not valid, even if their slot has been reused
+static TextureRequest *GetTextureRequest(int request)
 {
-    ImageDrawRectangleRec(dst, (Rectangle){ (float)posX, (float)posY, (float)width, (float)height }, color);
+    int slot = (request & 0xffff) - 1;
+
+    if ((request < 1) || (slot < 0) || (slot >= textureRequestsCount)) return NULL;
+    if ((textureRequests[slot] == NULL) || (textureRequests[slot]->id != request)) return NULL;
+
+    return textureRequests[slot];
 }
 
-// Draw rectangle within an image (Vector version)
-void ImageDrawRectangleV(Image *dst, Vector2 position, Vector2 size, Color color)
+// Add pixels readback to pending readbacks list
+static void QueueTextureReadback(TextureReadback *readback)
 {
-    ImageDrawRectangle(dst, (int)position.x, (int)position.y, (int)size.x, (int)size.y, color);
+    if (readbacksLast != NULL) readbacksLast->next = readback;
+    else readbacksFirst = readback;
+    readbacksLast = readback;
 }
 
-// Draw rectangle within an image
-void ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color)
+// Retrieve pixels readback data, screen pixels are processed on async workers if requested
+static void RetrieveTextureReadback(TextureReadback *readback, bool async)
 {
-    // Security check to avoid program crash
-    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
-
-    int sy = (int)rec.y;
-    int ey = sy + (int)rec.height;
-
-    int sx = (int)rec.x;
-    int ex = sx + (int)rec.width;
+    readback->image.data = rlGetReadPixels(readback->readback);
+    readback->state = READBACK_DONE;
 
-    for (int y = sy; y < ey; y++)
+    if (readback->image.data == NULL) TRACELOG(LOG_WARNING, "IMAGE: Failed to retrieve pixels readback data");
+    else if (readback->screen)
     {
-        for (int x = sx; x < ex; x++)
+        if (async)
         {
-            ImageDrawPixel(dst, x, y, color);
+            readback->state = READBACK_PROCESSING;
+            // NOTE: No cancel function, readbacks are flushed before async jobs are closed
+            RunAsyncJob(ProcessScreenReadback, ProcessScreenReadbackFinish, NULL, readback);
         }
+        else ProcessScreenReadback(readback);
     }
 }
 
-// Draw rectangle lines within an image
-void ImageDrawRectangleLines(Image *dst, Rectangle rec, int thick, Color color)
+// Screen readback job: flip lines and set alpha (worker thread)
+// NOTE: Screen pixels are read bottom-up and alpha has already been applied to RGB in framebuffer
+static void ProcessScreenReadback(void *data)
 {
-    ImageDrawRectangle(dst, (int)rec.x, (int)rec.y, (int)rec.width, thick, color);
-    ImageDrawRectangle(dst, (int)rec.x, (int)(rec.y + thick), thick, (int)(rec.height - thick*2), color);
-    ImageDrawRectangle(dst, (int)(rec.x + rec.width - thick), (int)(rec.y + thick), thick, (int)(rec.height - thick*2), color);
-    ImageDrawRectangle(dst, (int)rec.x, (int)(rec.y + rec.height - thick), (int)rec.width, thick, color);
+    Image *image = &((TextureReadback *)data)->image;
+    unsigned char *pixels = (unsigned char *)image->data;
+    int lineSize = image->width*4;
+    unsigned char *line = (unsigned char *)RL_MALLOC(lineSize);
+
+    for (int y = 0; y < image->height/2; y++)
+    {
+        unsigned char *top = pixels + y*lineSize;
+        unsigned char *bottom = pixels + (image->height - 1 - y)*lineSize;
+
+        memcpy(line, top, lineSize);
+        memcpy(top, bottom, lineSize);
+        memcpy(bottom, line, lineSize);
+    }
+
+    RL_FREE(line);
+
+    for (int i = 3; i < image->height*lineSize; i += 4) pixels[i] = 255;
 }
 
-// Draw an image (source) within an image (destination)
-// NOTE: Color tint is applied to source image
-void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)
+// Screen readback job finished: image ready
+static void ProcessScreenReadbackFinish(void *data)
 {
-    // Security check to avoid program crash
-    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) ||
-        (src.data == NULL) || (src.width == 0) || (src.height == 0)) return;
+    ((TextureReadback *)data)->state = READBACK_DONE;
+}
 
-    if (dst->mipmaps > 1) TRACELOG(LOG_WARNING, "Image drawing only applied to base mipmap level");
-    if (dst->format >= COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image drawing not supported for compressed formats");
-    else
+// Provide ready readbacks images to callbacks, in requests order
+// NOTE: Image is unloaded if no callback was provided
+static void ProvideTextureReadbacks(void)
+{
+    while ((readbacksFirst != NULL) && (readbacksFirst->state == READBACK_DONE))
     {
-        Image srcMod = { 0 };       // Source copy (in case it was required)
-        Image *srcPtr = &src;       // Pointer to source image
-        bool useSrcMod = false;     // Track source copy required
+        TextureReadback *readback = readbacksFirst;
 
-        // Source rectangle out-of-bounds security checks
-        if (srcRec.x < 0) { srcRec.width += srcRec.x; srcRec.x = 0; }
-        if (srcRec.y < 0) { srcRec.height += srcRec.y; srcRec.y = 0; }
-        if ((srcRec.x + srcRec.width) > src.width) srcRec.width = src.width - srcRec.x;
-        if ((srcRec.y + srcRec.height) > src.height) srcRec.height = src.height - srcRec.y;
+        readbacksFirst = readback->next;
+        if (readbacksFirst == NULL) readbacksLast = NULL;
 
-        // Check if source rectangle needs to be resized to destination rectangle
-        // In that case, we make a copy of source and we apply all required transform
-        if (((int)srcRec.width != (int)dstRec.width) || ((int)srcRec.height != (int)dstRec.height))
-        {
-            srcMod = ImageFromImage(src, srcRec);   // Create image from another image
-            ImageResize(&srcMod, (int)dstRec.width, (int)dstRec.height);   // Resize to destination rectangle
-            srcRec = (Rectangle){ 0, 0, (float)srcMod.width, (float)srcMod.height };
+        if (readback->callback != NULL) readback->callback(readback->image, readback->userData);
+        else UnloadImage(readback->image);
 
-            srcPtr = &srcMod;
-            useSrcMod = true;
-        }
+        RL_FREE(readback);
+    }
+}
 
-        // Destination rectangle out-of-bounds security checks
-        if (dstRec.x < 0)
-        {
-            srcRec.x = -dstRec.x;
-            srcRec.width += dstRec.x;
-            dstRec.x = 0;
-        }
-        else if ((dstRec.x + srcRec.width) > dst->width) srcRec.width = dst->width - dstRec.x;
+// Unload async texture request, slot is reused
+// NOTE: Loaded texture is not unloaded, it's owned by user once retrieved
+static void UnloadTextureRequest(int request)
+{
+    TextureRequest *textureRequest = GetTextureRequest(request);
 
-        if (dstRec.y < 0)
-        {
-            srcRec.y = -dstRec.y;
-            srcRec.height += dstRec.y;
-            dstRec.y = 0;
-        }
-        else if ((dstRec.y + srcRec.height) > dst->height) srcRec.height = dst->height - dstRec.y;
+    if (textureRequest != NULL)
+    {
+        RL_FREE(textureRequest->fileName);
+        UnloadImage(textureRequest->image);
+        RL_FREE(textureRequest);
 
-        if (dst->width < srcRec.width) srcRec.width = (float)dst->width;
-        if (dst->height < srcRec.height) srcRec.height = (float)dst->height;
+        textureRequests[(request & 0xffff) - 1] = NULL;
+    }
+}
 
-        // This blitting method is quite fast! The process followed is:
-        // for every pixel -> [get_src_format/get_dst_format -> blend -> format_to_dst]
-        // Some optimization ideas:
-        //    [x] Avoid creating source copy if not required (no resize required)
-        //    [x] Optimize ImageResize() for pixel format (alternative: ImageResizeNN())
-        //    [x] Optimize ColorAlphaBlend() to avoid processing (alpha = 0) and (alpha = 1)
-        //    [x] Optimize ColorAlphaBlend() for faster operations (maybe avoiding divs?)
-        //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
-        //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
-        //    [-] GetPixelColor(): Return Vector4 instead of Color, easier for ColorAlphaBlend()
+// Async texture job: decode image data (worker thread)
+// NOTE: Compressed formats require mipmaps generated before compression
+static void LoadTextureAsyncJob(void *data)
+{
+    TextureRequest *request = (TextureRequest *)data;
+    Image *image = &request->image;
 
-        Color colSrc, colDst, blend;
-        bool blendRequired = true;
+    *image = LoadImage(request->fileName);
 
-        // Fast path: Avoid blend if source has no alpha to blend
-        if ((tint.a == 255) && ((srcPtr->format == UNCOMPRESSED_GRAYSCALE) || (srcPtr->format == UNCOMPRESSED_R8G8B8) || (srcPtr->format == UNCOMPRESSED_R5G6B5))) blendRequired = false;
+    if ((image->data == NULL) || (image->format >= COMPRESSED_DXT1_RGB)) return;
 
-        int strideDst = GetPixelDataSize(dst->width, 1, dst->format);
-        int bytesPerPixelDst = strideDst/(dst->width);
+    bool convert = (request->format > 0) && (request->format != image->format);
+    bool mipmaps = request->mipmaps && (image->mipmaps == 1);
 
-        int strideSrc = GetPixelDataSize(srcPtr->width, 1, srcPtr->format);
-        int bytesPerPixelSrc = strideSrc/(srcPtr->width);
+    if (convert && (request->format >= COMPRESSED_DXT1_RGB))
+    {
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+        if (mipmaps) ImageMipmaps(image);
+#endif
+        ImageFormat(image, request->format);
+    }
+    else
+    {
+        if (convert) ImageFormat(image, request->format);
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+        if (mipmaps) ImageMipmaps(image);
+#endif
+    }
+}
 
-        unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
-        unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
+// Async texture job finished: image ready to upload
+static void LoadTextureAsyncFinish(void *data)
+{
+    TextureRequest *request = (TextureRequest *)data;
 
-        for (int y = 0; y < (int)srcRec.height; y++)
+    request->state = (request->image.data != NULL)? TEXTURE_REQUEST_DECODED : TEXTURE_REQUEST_FAILED;
+
+    if (request->state == TEXTURE_REQUEST_FAILED) TRACELOG(LOG_WARNING, "TEXTURE: [%s] Failed to load async texture data", request->fileName);
+}
+
+// Async texture job cancelled: request failed, released by UnloadTexturesAsync()
+static void LoadTextureAsyncCancel(void *data)
+{
+    ((TextureRequest *)data)->state = TEXTURE_REQUEST_FAILED;
+}
+
+// Upload async texture request image data, returns uploaded bytes
+// NOTE: Uncompressed single level images bigger than provided bytes are uploaded in rows bands,
+// texture is allocated on first band and updated with rlUpdateTexture(), other images are uploaded at once
+static int UploadTextureRequest(TextureRequest *request, int bytes)
+{
+    Image *image = &request->image;
+    int size = GetPixelDataSize(image->width, image->height, image->format);
+    int uploaded = 0;
+
+    if ((request->state == TEXTURE_REQUEST_UPLOADING) ||
+        ((bytes > 0) && (size > bytes) && (image->format < COMPRESSED_DXT1_RGB) && (image->mipmaps == 1)))
+    {
+        if (request->state == TEXTURE_REQUEST_DECODED)
         {
-            unsigned char *pSrc = pSrcBase;
-            unsigned char *pDst = pDstBase;
+            request->texture.id = rlLoadTexture(NULL, image->width, image->height, image->format, 1);
+            request->texture.width = image->width;
+            request->texture.height = image->height;
+            request->texture.mipmaps = 1;
+            request->texture.format = image->format;
+            request->state = (request->texture.id > 0)? TEXTURE_REQUEST_UPLOADING : TEXTURE_REQUEST_FAILED;
+        }
 
-            // Fast path: Avoid moving pixel by pixel if no blend required and same format
-            if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
-            else
-            {
-                for (int x = 0; x < (int)srcRec.width; x++)
-                {
-                    colSrc = GetPixelColor(pSrc, srcPtr->format);
-                    colDst = GetPixelColor(pDst, dst->format);
+        if (request->state == TEXTURE_REQUEST_UPLOADING)
+        {
+            int rowSize = GetPixelDataSize(image->width, 1, image->format);
+            int rows = (bytes > 0)? bytes/rowSize : image->height;
 
-                    // Fast path: Avoid blend if source has no alpha to blend
-                    if (blendRequired) blend = ColorAlphaBlend(colDst, colSrc, tint);
-                    else blend = colSrc;
+            if (rows < 1) rows = 1;
+            if (rows > (image->height - request->uploadedRows)) rows = image->height - request->uploadedRows;
 
-                    SetPixelColor(pDst, blend, dst->format);
+            rlUpdateTexture(request->texture.id, 0, request->uploadedRows, image->width, rows, image->format, (unsigned char *)image->data + request->uploadedRows*rowSize);
 
-                    pDst += bytesPerPixelDst;
-                    pSrc += bytesPerPixelSrc;
-                }
-            }
+            request->uploadedRows += rows;
+            uploaded = rows*rowSize;
 
-            pSrcBase += strideSrc;
-            pDstBase += strideDst;
+            if (request->uploadedRows == image->height) request->state = TEXTURE_REQUEST_READY;
         }
+    }
+    else
+    {
+        request->texture = LoadTextureFromImage(*image);
+        request->state = (request->texture.id > 0)? TEXTURE_REQUEST_READY : TEXTURE_REQUEST_FAILED;
+        uploaded = size;
+    }
 
-        if (useSrcMod) UnloadImage(srcMod);     // Unload source modified image
+    if (request->state == TEXTURE_REQUEST_READY) TRACELOG(LOG_INFO, "TEXTURE: [%s] Async texture loaded successfully (%ix%i)", request->fileName, image->width, image->height);
+    else if (request->state == TEXTURE_REQUEST_FAILED) TRACELOG(LOG_WARNING, "TEXTURE: [%s] Failed to upload async texture", request->fileName);
+
+    if ((request->state == TEXTURE_REQUEST_READY) || (request->state == TEXTURE_REQUEST_FAILED))
+    {
+        UnloadImage(*image);
+        *image = (Image){ 0 };
     }
+
+    return uploaded;
 }
 
-// Draw text (default font) within an image (destination)
-void ImageDrawText(Image *dst, const char *text, int posX, int posY, int fontSize, Color color)
+// Upload decoded async textures under per-frame budget and call completion callbacks
+// NOTE: Called on BeginDrawing(), after processed async jobs are finished (UpdateAsyncJobs())
+extern void UpdateTexturesAsync(void)
 {
-    Vector2 position = { (float)posX, (float)posY };
+    double startTime = GetTime();
+    int uploadedBytes = 0;
+    bool uploading = false;         // Some upload step processed this frame
 
-    // NOTE: For default font, sapcing is set to desired font size / default font size (10)
-    ImageDrawTextEx(dst, GetFontDefault(), text, position, (float)fontSize, (float)fontSize/10, color);
-}
+    for (int i = 0; i < textureRequestsCount; i++)
+    {
+        TextureRequest *request = textureRequests[i];
 
-// Draw text (custom sprite font) within an image (destination)
-void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
-{
-    Image imText = ImageTextEx(font, text, fontSize, spacing, tint);
+        if (request == NULL) continue;
 
-    Rectangle srcRec = { 0.0f, 0.0f, (float)imText.width, (float)imText.height };
-    Rectangle dstRec = { position.x, position.y, (float)imText.width, (float)imText.height };
+        if ((request->state == TEXTURE_REQUEST_DECODED) || (request->state == TEXTURE_REQUEST_UPLOADING))
+        {
+            int bytes = 0;          // Bytes available for this upload step, 0 means unlimited
 
-    ImageDraw(dst, imText, srcRec, dstRec, WHITE);
+            if (textureUploadBudgetBytes > 0)
+            {
+                bytes = textureUploadBudgetBytes - uploadedBytes;
+                if (bytes < 1) bytes = 1;
+            }
 
-    UnloadImage(imText);
+            bool budgetExceeded = ((textureUploadBudgetBytes > 0) && (uploadedBytes >= textureUploadBudgetBytes)) ||
+                                  ((textureUploadBudgetTime > 0.0f) && ((GetTime() - startTime)*1000.0 >= textureUploadBudgetTime));
+
+            if (!uploading || !budgetExceeded)
+            {
+                uploadedBytes += UploadTextureRequest(request, bytes);
+                uploading = true;
+            }
+        }
+
+        if ((request->callback != NULL) && ((request->state == TEXTURE_REQUEST_READY) || (request->state == TEXTURE_REQUEST_FAILED)))
+        {
+            request->callback(request->id, request->texture, request->userData);
+            UnloadTextureRequest(request->id);
+        }
+    }
 }
 
-//------------------------------------------------------------------------------------
-// Texture loading functions
-//------------------------------------------------------------------------------------
-// Load texture from file into GPU memory (VRAM)
-Texture2D LoadTexture(const char *fileName)
+// Request screen pixels readback, image is provided to callback some frames later
+// NOTE: Used by GetScreenDataAsync(), TakeScreenshot() and GIF recording
+extern void ReadScreenDataAsync(int width, int height, ImageReadCallback callback, void *userData)
 {
-    Texture2D texture = { 0 };
+    TextureReadback *readback = (TextureReadback *)RL_CALLOC(1, sizeof(TextureReadback));
 
-    Image image = LoadImage(fileName);
+    readback->image = (Image){ NULL, width, height, 1, UNCOMPRESSED_R8G8B8A8 };
+    readback->screen = true;
+    readback->callback = callback;
+    readback->userData = userData;
+    readback->readback = rlReadScreenPixelsAsync(width, height);
 
-    if (image.data != NULL)
+    if (readback->readback == 0)
     {
-        texture = LoadTextureFromImage(image);
-        UnloadImage(image);
+        // Readback not available, data retrieved synchronously (already flipped)
+        readback->image.data = rlReadScreenPixels(width, height);
+        readback->state = READBACK_DONE;
     }
 
-    return texture;
+    QueueTextureReadback(readback);
 }
 
-// Load a texture from image data
-// NOTE: image is not unloaded, it must be done manually
-Texture2D LoadTextureFromImage(Image image)
+// Retrieve available pixels readbacks and provide ready images to callbacks
+// NOTE: Screen pixels are processed on async workers, images are provided on next frames
+extern void UpdateTextureReadbacks(void)
 {
-    Texture2D texture = { 0 };
-
-    if ((image.data != NULL) && (image.width != 0) && (image.height != 0))
+    for (TextureReadback *readback = readbacksFirst; readback != NULL; readback = readback->next)
     {
-        texture.id = rlLoadTexture(image.data, image.width, image.height, image.format, image.mipmaps);
+        if ((readback->state == READBACK_GPU) && rlIsReadPixelsReady(readback->readback)) RetrieveTextureReadback(readback, true);
     }
-    else TRACELOG(LOG_WARNING, "IMAGE: Data is not valid to load texture");
-
-    texture.width = image.width;
-    texture.height = image.height;
-    texture.mipmaps = image.mipmaps;
-    texture.format = image.format;
 
-    return texture;
+    ProvideTextureReadbacks();
 }
 
-// Load cubemap from image, multiple image cubemap layouts supported
-TextureCubemap LoadTextureCubemap(Image image, int layoutType)
+// Retrieve all pending pixels readbacks and provide images to callbacks
+// NOTE: Stalls until GPU copies (waiting on readbacks fences) and async processing are completed,
+// required before GIF recording end and on CloseWindow() (async jobs workers must be available)
+extern void FlushTextureReadbacks(void)
 {
-    TextureCubemap cubemap = { 0 };
+    bool processing = false;
 
-    if (layoutType == CUBEMAP_AUTO_DETECT)      // Try to automatically guess layout type
+    for (TextureReadback *readback = readbacksFirst; readback != NULL; readback = readback->next)
     {
-        // Check image width/height to determine the type of cubemap provided
-        if (image.width > image.height)
-        {
-            if ((image.width/6) == image.height) { layoutType = CUBEMAP_LINE_HORIZONTAL; cubemap.width = image.width/6; }
-            else if ((image.width/4) == (image.height/3)) { layoutType = CUBEMAP_CROSS_FOUR_BY_THREE; cubemap.width = image.width/4; }
-            else if (image.width >= (int)((float)image.height*1.85f)) { layoutType = CUBEMAP_PANORAMA; cubemap.width = image.width/4; }
-        }
-        else if (image.height > image.width)
-        {
-            if ((image.height/6) == image.width) { layoutType = CUBEMAP_LINE_VERTICAL; cubemap.width = image.height/6; }
-            else if ((image.width/3) == (image.height/4)) { layoutType = CUBEMAP_CROSS_THREE_BY_FOUR; cubemap.width = image.width/3; }
-        }
-
-        cubemap.height = cubemap.width;
+        if (readback->state == READBACK_GPU) RetrieveTextureReadback(readback, false);
+        if (readback->state == READBACK_PROCESSING) processing = true;
     }
 
-    if (layoutType != CUBEMAP_AUTO_DETECT)
+    while (processing)
     {
-        int size = cubemap.width;
-
-        Image faces = { 0 };                // Vertical column image
-        Rectangle faceRecs[6] = { 0 };      // Face source rectangles
-        for (int i = 0; i < 6; i++) faceRecs[i] = (Rectangle){ 0, 0, (float)size, (float)size };
+        WaitAsyncJobs();        // Blocks until some async job is processed
+        UpdateAsyncJobs();
 
-        if (layoutType == CUBEMAP_LINE_VERTICAL)
+        processing = false;
+        for (TextureReadback *readback = readbacksFirst; readback != NULL; readback = readback->next)
         {
-            faces = image;
-            for (int i = 0; i < 6; i++) faceRecs[i].y = (float)size*i;
+            if (readback->state == READBACK_PROCESSING) { processing = true; break; }
         }
-        else if (layoutType == CUBEMAP_PANORAMA)
+    }
+
+    ProvideTextureReadbacks();
+}
+
+// Unload async texture requests, textures loaded and not retrieved are unloaded
+// NOTE: Called on CloseWindow(), async jobs workers must be closed before (CloseAsyncJobs())
+extern void UnloadTexturesAsync(void)
+{
+    for (int i = 0; i < textureRequestsCount; i++)
+    {
+        if (textureRequests[i] != NULL)
         {
-            // TODO: Convert panorama image to square faces...
-            // Ref: https://github.com/denivip/panorama/blob/master/panorama.cpp
+            if (textureRequests[i]->texture.id > 0) rlUnloadTexture(textureRequests[i]->texture.id);
+            UnloadTextureRequest(textureRequests[i]->id);
         }
-        else
+    }
+
+    RL_FREE(textureRequests);
+    textureRequests = NULL;
+    textureRequestsCount = 0;
+}
+
+// Block compression job: blocks rows band
+// NOTE: Blocks on right/bottom borders replicate image edge pixels
+static void CompressBlocksBand(void *data, int start, int end)
+{
+    CompressJob *job = (CompressJob *)data;
+
+    int blocksX = (job->width + 3)/4;
+    int blockSize = GetPixelDataSize(4, 4, job->format);
+    Color block[16] = { 0 };
+
+    for (int by = start; by < end; by++)
+    {
+        for (int bx = 0; bx < blocksX; bx++)
         {
-            if (layoutType == CUBEMAP_LINE_HORIZONTAL) for (int i = 0; i < 6; i++) faceRecs[i].x = (float)size*i;
-            else if (layoutType == CUBEMAP_CROSS_THREE_BY_FOUR)
-            {
-                faceRecs[0].x = (float)size; faceRecs[0].y = (float)size;
-                faceRecs[1].x = (float)size; faceRecs[1].y = (float)size*3;
-                faceRecs[2].x = (float)size; faceRecs[2].y = 0;
-                faceRecs[3].x = (float)size; faceRecs[3].y = (float)size*2;
-                faceRecs[4].x = 0; faceRecs[4].y = (float)size;
-                faceRecs[5].x = (float)size*2; faceRecs[5].y = (float)size;
-            }
-            else if (layoutType == CUBEMAP_CROSS_FOUR_BY_THREE)
+            for (int y = 0; y < 4; y++)
             {
-                faceRecs[0].x = (float)size*2; faceRecs[0].y = (float)size;
-                faceRecs[1].x = 0; faceRecs[1].y = (float)size;
-                faceRecs[2].x = (float)size; faceRecs[2].y = 0;
-                faceRecs[3].x = (float)size; faceRecs[3].y = (float)size*2;
-                faceRecs[4].x = (float)size; faceRecs[4].y = (float)size;
-                faceRecs[5].x = (float)size*3; faceRecs[5].y = (float)size;
+                int py = (by*4 + y < job->height)? by*4 + y : job->height - 1;
+
+                for (int x = 0; x < 4; x++)
+                {
+                    int px = (bx*4 + x < job->width)? bx*4 + x : job->width - 1;
+                    block[y*4 + x] = job->pixels[py*job->width + px];
+                }
             }
 
-            // Convert image data to 6 faces in a vertical column, that's the optimum layout for loading
-            faces = GenImageColor(size, size*6, MAGENTA);
-            ImageFormat(&faces, image.format);
+            unsigned char *output = job->output + (by*blocksX + bx)*blockSize;
 
-            // TODO: Image formating does not work with compressed textures!
+            switch (job->format)
+            {
+                case COMPRESSED_DXT1_RGB: CompressBlockDXTColor(block, output, false, job->quality); break;
+                case COMPRESSED_DXT1_RGBA: CompressBlockDXTColor(block, output, true, job->quality); break;
+                case COMPRESSED_DXT3_RGBA:
+                {
+                    // Explicit alpha: 4 bit per pixel
+                    for (int i = 0; i < 16; i += 2) output[i/2] = (unsigned char)(((block[i].a*15 + 127)/255) | (((block[i + 1].a*15 + 127)/255) << 4));
+                    CompressBlockDXTColor(block, output + 8, false, job->quality);
+                } break;
+                case COMPRESSED_DXT5_RGBA:
+                {
+                    CompressBlockDXTAlpha(block, output, job->quality);
+                    CompressBlockDXTColor(block, output + 8, false, job->quality);
+                } break;
+                case COMPRESSED_ETC1_RGB:
+                case COMPRESSED_ETC2_RGB: CompressBlockETC1(block, output, job->quality); break;
+                case COMPRESSED_ETC2_EAC_RGBA:
+                {
+                    CompressBlockEACAlpha(block, output, job->quality);
+                    CompressBlockETC1(block, output + 8, job->quality);
+                } break;
+                default: break;
+            }
         }
+    }
+}
 
-        for (int i = 0; i < 6; i++) ImageDraw(&faces, image, faceRecs[i], (Rectangle){ 0, (float)size*i, (float)size, (float)size }, WHITE);
-
-        cubemap.id = rlLoadTextureCubemap(faces.data, size, faces.format);
-        if (cubemap.id == 0) TRACELOG(LOG_WARNING, "IMAGE: Failed to load cubemap image");
+// Get RGB565 color from RGB float values (0.0f..255.0f)
+static unsigned short PackColor565(const float *rgb)
+{
+    int r = (int)(rgb[0]*31.0f/255.0f + 0.5f);
+    int g = (int)(rgb[1]*63.0f/255.0f + 0.5f);
+    int b = (int)(rgb[2]*31.0f/255.0f + 0.5f);
 
-        UnloadImage(faces);
-    }
-    else TRACELOG(LOG_WARNING, "IMAGE: Failed to detect cubemap image layout");
+    r = (r < 0)? 0 : ((r > 31)? 31 : r);
+    g = (g < 0)? 0 : ((g > 63)? 63 : g);
+    b = (b < 0)? 0 : ((b > 31)? 31 : b);
 
-    return cubemap;
+    return (unsigned short)((r << 11) | (g << 5) | b);
 }
 
-// Load texture for rendering (framebuffer)
-// NOTE: Render texture is loaded by default with RGBA color attachment and depth RenderBuffer
-RenderTexture2D LoadRenderTexture(int width, int height)
+// Fit DXT color block palette indices for provided endpoints, returns squared error
+// NOTE: Palette is evaluated as decoded, endpoints order is fixed later on block writing
+static int FitDXTColorIndices(const int (*colors)[3], int count, unsigned short c0, unsigned short c1, bool threeColors, int *indices)
 {
-    RenderTexture2D target = { 0 };
+    int palette[4][3] = { 0 };
 
-    target.id = rlLoadFramebuffer(width, height);   // Load an empty framebuffer
+    palette[0][0] = ((c0 >> 11) << 3) | (c0 >> 13);
+    palette[0][1] = (((c0 >> 5) & 0x3f) << 2) | (((c0 >> 5) & 0x3f) >> 4);
+    palette[0][2] = ((c0 & 0x1f) << 3) | ((c0 & 0x1f) >> 2);
+    palette[1][0] = ((c1 >> 11) << 3) | (c1 >> 13);
+    palette[1][1] = (((c1 >> 5) & 0x3f) << 2) | (((c1 >> 5) & 0x3f) >> 4);
+    palette[1][2] = ((c1 & 0x1f) << 3) | ((c1 & 0x1f) >> 2);
 
-    if (target.id > 0)
+    for (int k = 0; k < 3; k++)
     {
-        rlEnableFramebuffer(target.id);
-
-        // Create color texture (default to RGBA)
-        target.texture.id = rlLoadTexture(NULL, width, height, UNCOMPRESSED_R8G8B8A8, 1);
-        target.texture.width = width;
-        target.texture.height = height;
-        target.texture.format = UNCOMPRESSED_R8G8B8A8;
-        target.texture.mipmaps = 1;
-
-        // Create depth renderbuffer/texture
-        target.depth.id = rlLoadTextureDepth(width, height, true);
-        target.depth.width = width;
-        target.depth.height = height;
-        target.depth.format = 19;       //DEPTH_COMPONENT_24BIT?
-        target.depth.mipmaps = 1;
-
-        // Attach color texture and depth renderbuffer/texture to FBO
-        rlFramebufferAttach(target.id, target.texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D);
-        rlFramebufferAttach(target.id, target.depth.id, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER);
-
-        // Check if fbo is complete with attachments (valid)
-        if (rlFramebufferComplete(target.id)) TRACELOG(LOG_INFO, "FBO: [ID %i] Framebuffer object created successfully", target.id);
-
-        rlDisableFramebuffer();
+        if (threeColors) palette[2][k] = (palette[0][k] + palette[1][k])/2;
+        else
+        {
+            palette[2][k] = (2*palette[0][k] + palette[1][k])/3;
+            palette[3][k] = (palette[0][k] + 2*palette[1][k])/3;
+        }
     }
-    else TRACELOG(LOG_WARNING, "FBO: Framebuffer object can not be created");
 
-    return target;
-}
+    int levels = threeColors? 3 : 4;
+    int error = 0;
 
-// Unload texture from GPU memory (VRAM)
-void UnloadTexture(Texture2D texture)
-{
-    if (texture.id > 0)
+    for (int i = 0; i < count; i++)
     {
-        rlUnloadTexture(texture.id);
+        int bestError = INT_MAX;
 
-        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Unloaded texture data from VRAM (GPU)", texture.id);
-    }
-}
+        for (int p = 0; p < levels; p++)
+        {
+            int dr = colors[i][0] - palette[p][0];
+            int dg = colors[i][1] - palette[p][1];
+            int db = colors[i][2] - palette[p][2];
+            int pixelError = dr*dr + dg*dg + db*db;
 
-// Unload render texture from GPU memory (VRAM)
-void UnloadRenderTexture(RenderTexture2D target)
-{
-    if (target.id > 0)
-    {
-        // Color texture attached to FBO is deleted
-        rlUnloadTexture(target.texture.id);
+            if (pixelError < bestError)
+            {
+                bestError = pixelError;
+                indices[i] = p;
+            }
+        }
 
-        // NOTE: Depth texture/renderbuffer is automatically
-        // queried and deleted before deleting framebuffer
-        rlUnloadFramebuffer(target.id);
+        error += bestError;
     }
-}
 
-// Update GPU texture with new data
-// NOTE: pixels data must match texture.format
-void UpdateTexture(Texture2D texture, const void *pixels)
-{
-    rlUpdateTexture(texture.id, 0, 0, texture.width, texture.height, texture.format, pixels);
+    return error;
 }
 
-// Update GPU texture rectangle with new data
-// NOTE: pixels data must match texture.format
-void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels)
+// Compress 4x4 block color (DXT1 block: two RGB565 endpoints and 2 bit indices)
+// NOTE: If transparent, pixels with alpha < 128 are encoded as transparent (3-colors mode)
+// Endpoints: quality 0 uses inset bounding box, quality 1+ uses principal axis refined by least squares
+static void CompressBlockDXTColor(const Color *block, unsigned char *output, bool transparent, int quality)
 {
-    rlUpdateTexture(texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, texture.format, pixels);
-}
+    int colors[16][3] = { 0 };
+    int pixelIndex[16] = { 0 };     // Pixel to encoded color index (-1 for transparent pixels)
+    int count = 0;
 
-// Get pixel data from GPU texture and return an Image
-// NOTE: Compressed texture formats not supported
-Image GetTextureData(Texture2D texture)
-{
-    Image image = { 0 };
+    for (int i = 0; i < 16; i++)
+    {
+        if (transparent && (block[i].a < 128)) pixelIndex[i] = -1;
+        else
+        {
+            colors[count][0] = block[i].r;
+            colors[count][1] = block[i].g;
+            colors[count][2] = block[i].b;
+            pixelIndex[i] = count;
+            count++;
+        }
+    }
 
-    if (texture.format < COMPRESSED_DXT1_RGB)
+    bool threeColors = (count < 16);
+    unsigned short c0 = 0;
+    unsigned short c1 = 0;
+    int indices[16] = { 0 };
+
+    if (count > 0)
     {
-        image.data = rlReadTexturePixels(texture);
+        float minColor[3] = { 255.0f, 255.0f, 255.0f };
+        float maxColor[3] = { 0.0f, 0.0f, 0.0f };
+        float mean[3] = { 0.0f, 0.0f, 0.0f };
 
-        if (image.data != NULL)
+        for (int i = 0; i < count; i++)
         {
-            image.width = texture.width;
-            image.height = texture.height;
-            image.format = texture.format;
-            image.mipmaps = 1;
+            for (int k = 0; k < 3; k++)
+            {
+                if (colors[i][k] < minColor[k]) minColor[k] = (float)colors[i][k];
+                if (colors[i][k] > maxColor[k]) maxColor[k] = (float)colors[i][k];
+                mean[k] += (float)colors[i][k]/count;
+            }
+        }
 
-#if defined(GRAPHICS_API_OPENGL_ES2)
-            // NOTE: Data retrieved on OpenGL ES 2.0 should be RGBA,
-            // coming from FBO color buffer attachment, but it seems
-            // original texture format is retrieved on RPI...
-            image.format = UNCOMPRESSED_R8G8B8A8;
-#endif
-            TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Pixel data retrieved successfully", texture.id);
+        float start[3] = { 0 };
+        float end[3] = { 0 };
+
+        if (quality == 0)
+        {
+            // Bounding box diagonal, inset to reduce extreme colors weight
+            for (int k = 0; k < 3; k++)
+            {
+                float inset = (maxColor[k] - minColor[k])/16.0f;
+                start[k] = maxColor[k] - inset;
+                end[k] = minColor[k] + inset;
+            }
         }
-        else TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to retrieve pixel data", texture.id);
-    }
-    else TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to retrieve compressed pixel data", texture.id);
+        else
+        {
+            // Principal axis of colors distribution (covariance matrix power iteration)
+            float cov[6] = { 0 };
 
-    return image;
-}
+            for (int i = 0; i < count; i++)
+            {
+                float r = colors[i][0] - mean[0];
+                float g = colors[i][1] - mean[1];
+                float b = colors[i][2] - mean[2];
 
-// Get pixel data from GPU frontbuffer and return an Image (screenshot)
-Image GetScreenData(void)
-{
-    Image image = { 0 };
+                cov[0] += r*r; cov[1] += r*g; cov[2] += r*b;
+                cov[3] += g*g; cov[4] += g*b; cov[5] += b*b;
+            }
 
-    image.width = GetScreenWidth();
-    image.height = GetScreenHeight();
-    image.mipmaps = 1;
-    image.format = UNCOMPRESSED_R8G8B8A8;
-    image.data = rlReadScreenPixels(image.width, image.height);
+            float axis[3] = { maxColor[0] - minColor[0], maxColor[1] - minColor[1], maxColor[2] - minColor[2] };
 
-    return image;
-}
+            for (int it = 0; it < 8; it++)
+            {
+                float x = cov[0]*axis[0] + cov[1]*axis[1] + cov[2]*axis[2];
+                float y = cov[1]*axis[0] + cov[3]*axis[1] + cov[4]*axis[2];
+                float z = cov[2]*axis[0] + cov[4]*axis[1] + cov[5]*axis[2];
+                float length = sqrtf(x*x + y*y + z*z);
 
-//------------------------------------------------------------------------------------
-// Texture configuration functions
-//------------------------------------------------------------------------------------
-// Generate GPU mipmaps for a texture
-void GenTextureMipmaps(Texture2D *texture)
-{
-    // NOTE: NPOT textures support check inside function
-    // On WebGL (OpenGL ES 2.0) NPOT textures support is limited
-    rlGenerateMipmaps(texture);
-}
+                if (length < 0.000001f) break;
 
-// Set texture scaling filter mode
-void SetTextureFilter(Texture2D texture, int filterMode)
-{
-    switch (filterMode)
-    {
-        case FILTER_POINT:
-        {
-            if (texture.mipmaps > 1)
+                axis[0] = x/length; axis[1] = y/length; axis[2] = z/length;
+            }
+
+            float length = sqrtf(axis[0]*axis[0] + axis[1]*axis[1] + axis[2]*axis[2]);
+            float minProj = 0.0f;
+            float maxProj = 0.0f;
+
+            if (length > 0.000001f)
             {
-                // RL_FILTER_MIP_NEAREST - tex filter: POINT, mipmaps filter: POINT (sharp switching between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_MIP_NEAREST);
+                for (int k = 0; k < 3; k++) axis[k] /= length;
 
-                // RL_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_NEAREST);
+                for (int i = 0; i < count; i++)
+                {
+                    float proj = (colors[i][0] - mean[0])*axis[0] + (colors[i][1] - mean[1])*axis[1] + (colors[i][2] - mean[2])*axis[2];
+
+                    if (proj < minProj) minProj = proj;
+                    if (proj > maxProj) maxProj = proj;
+                }
             }
-            else
+
+            for (int k = 0; k < 3; k++)
             {
-                // RL_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_NEAREST);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_NEAREST);
+                start[k] = mean[k] + axis[k]*maxProj;
+                end[k] = mean[k] + axis[k]*minProj;
             }
-        } break;
-        case FILTER_BILINEAR:
+        }
+
+        c0 = PackColor565(start);
+        c1 = PackColor565(end);
+
+        int error = FitDXTColorIndices(colors, count, c0, c1, threeColors, indices);
+
+        // Least squares endpoints refinement for current indices
+        // NOTE: Every palette color is a weighted combination of the two endpoints
+        if (quality > 0)
         {
-            if (texture.mipmaps > 1)
+            const float weights4[4] = { 1.0f, 0.0f, 2.0f/3.0f, 1.0f/3.0f };
+            const float weights3[3] = { 1.0f, 0.0f, 0.5f };
+            int iterations = (quality == 1)? 1 : 4;
+
+            for (int it = 0; it < iterations; it++)
             {
-                // RL_FILTER_LINEAR_MIP_NEAREST - tex filter: BILINEAR, mipmaps filter: POINT (sharp switching between mipmaps)
-                // Alternative: RL_FILTER_NEAREST_MIP_LINEAR - tex filter: POINT, mipmaps filter: BILINEAR (smooth transition between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_LINEAR_MIP_NEAREST);
+                float aa = 0.0f, bb = 0.0f, ab = 0.0f;
+                float ax[3] = { 0 };
+                float bx[3] = { 0 };
 
-                // RL_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_LINEAR);
+                for (int i = 0; i < count; i++)
+                {
+                    float a = threeColors? weights3[indices[i]] : weights4[indices[i]];
+                    float b = 1.0f - a;
+
+                    aa += a*a; bb += b*b; ab += a*b;
+
+                    for (int k = 0; k < 3; k++)
+                    {
+                        ax[k] += a*colors[i][k];
+                        bx[k] += b*colors[i][k];
+                    }
+                }
+
+                float det = aa*bb - ab*ab;
+                if (fabsf(det) < 0.000001f) break;
+
+                for (int k = 0; k < 3; k++)
+                {
+                    start[k] = (ax[k]*bb - bx[k]*ab)/det;
+                    end[k] = (bx[k]*aa - ax[k]*ab)/det;
+                }
+
+                unsigned short r0 = PackColor565(start);
+                unsigned short r1 = PackColor565(end);
+
+                if ((r0 == c0) && (r1 == c1)) break;
+
+                int refinedIndices[16] = { 0 };
+                int refinedError = FitDXTColorIndices(colors, count, r0, r1, threeColors, refinedIndices);
+
+                if (refinedError >= error) break;
+
+                c0 = r0;
+                c1 = r1;
+                error = refinedError;
+                for (int i = 0; i < count; i++) indices[i] = refinedIndices[i];
             }
-            else
+        }
+
+        // Endpoints order defines palette mode: c0 > c1 for 4-colors mode, c0 <= c1 for 3-colors mode
+        if (threeColors)
+        {
+            if (c0 > c1)
             {
-                // RL_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_LINEAR);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_LINEAR);
+                unsigned short temp = c0; c0 = c1; c1 = temp;
+                for (int i = 0; i < count; i++) if (indices[i] < 2) indices[i] ^= 1;
             }
-        } break;
-        case FILTER_TRILINEAR:
+        }
+        else
         {
-            if (texture.mipmaps > 1)
+            if (c0 < c1)
             {
-                // RL_FILTER_MIP_LINEAR - tex filter: BILINEAR, mipmaps filter: BILINEAR (smooth transition between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_MIP_LINEAR);
-
-                // RL_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_LINEAR);
+                unsigned short temp = c0; c0 = c1; c1 = temp;
+                for (int i = 0; i < count; i++) indices[i] ^= 1;
             }
-            else
-            {
-                TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] No mipmaps available for TRILINEAR texture filtering", texture.id);
+            else if (c0 == c1) for (int i = 0; i < count; i++) indices[i] = 0;    // Single color, avoid 3-colors mode palette
+        }
+    }
 
-                // RL_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_LINEAR);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_LINEAR);
-            }
-        } break;
-        case FILTER_ANISOTROPIC_4X: rlTextureParameters(texture.id, RL_TEXTURE_ANISOTROPIC_FILTER, 4); break;
-        case FILTER_ANISOTROPIC_8X: rlTextureParameters(texture.id, RL_TEXTURE_ANISOTROPIC_FILTER, 8); break;
-        case FILTER_ANISOTROPIC_16X: rlTextureParameters(texture.id, RL_TEXTURE_ANISOTROPIC_FILTER, 16); break;
-        default: break;
+    unsigned int bits = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        unsigned int index = (pixelIndex[i] < 0)? 3 : indices[pixelIndex[i]];
+        bits |= (index << (2*i));
     }
+
+    output[0] = (unsigned char)(c0 & 0xff);
+    output[1] = (unsigned char)(c0 >> 8);
+    output[2] = (unsigned char)(c1 & 0xff);
+    output[3] = (unsigned char)(c1 >> 8);
+    output[4] = (unsigned char)(bits & 0xff);
+    output[5] = (unsigned char)((bits >> 8) & 0xff);
+    output[6] = (unsigned char)((bits >> 16) & 0xff);
+    output[7] = (unsigned char)(bits >> 24);
 }
 
-// Set texture wrapping mode
-void SetTextureWrap(Texture2D texture, int wrapMode)
+// Fit DXT5 alpha block palette indices for provided endpoints, returns squared error
+// NOTE: Endpoints order defines palette mode: a0 > a1 for 8-alphas mode, a0 <= a1 for 6-alphas mode (plus 0 and 255)
+static int FitDXTAlphaIndices(const Color *block, int a0, int a1, int *indices)
 {
-    switch (wrapMode)
+    int palette[8] = { a0, a1, 0, 0, 0, 0, 0, 255 };
+
+    if (a0 > a1) for (int i = 1; i < 7; i++) palette[i + 1] = ((7 - i)*a0 + i*a1 + 3)/7;
+    else for (int i = 1; i < 5; i++) palette[i + 1] = ((5 - i)*a0 + i*a1 + 2)/5;
+
+    int error = 0;
+
+    for (int i = 0; i < 16; i++)
     {
-        case WRAP_REPEAT:
-        {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_WRAP_REPEAT);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_WRAP_REPEAT);
-        } break;
-        case WRAP_CLAMP:
-        {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_WRAP_CLAMP);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_WRAP_CLAMP);
-        } break;
-        case WRAP_MIRROR_REPEAT:
-        {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_WRAP_MIRROR_REPEAT);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_WRAP_MIRROR_REPEAT);
-        } break;
-        case WRAP_MIRROR_CLAMP:
+        int bestError = INT_MAX;
+
+        for (int p = 0; p < 8; p++)
         {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_WRAP_MIRROR_CLAMP);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_WRAP_MIRROR_CLAMP);
-        } break;
-        default: break;
+            int pixelError = (block[i].a - palette[p])*(block[i].a - palette[p]);
+
+            if (pixelError < bestError)
+            {
+                bestError = pixelError;
+                indices[i] = p;
+            }
+        }
+
+        error += bestError;
     }
-}
 
-//------------------------------------------------------------------------------------
-// Texture drawing functions
-//------------------------------------------------------------------------------------
-// Draw a Texture2D
-void DrawTexture(Texture2D texture, int posX, int posY, Color tint)
-{
-    DrawTextureEx(texture, (Vector2){ (float)posX, (float)posY }, 0.0f, 1.0f, tint);
+    return error;
 }
 
-// Draw a Texture2D with position defined as Vector2
-void DrawTextureV(Texture2D texture, Vector2 position, Color tint)
+// Compress 4x4 block alpha (DXT5 alpha block: two alpha endpoints and 3 bit indices)
+// NOTE: Quality 1+ also tries 6-alphas mode (exact 0 and 255), quality 2 searches around endpoints
+static void CompressBlockDXTAlpha(const Color *block, unsigned char *output, int quality)
 {
-    DrawTextureEx(texture, position, 0, 1.0f, tint);
-}
+    int minAlpha = 255, maxAlpha = 0;
+    int innerMin = 255, innerMax = 0;   // Alpha range excluding 0 and 255 values
 
-// Draw a Texture2D with extended parameters
-void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)
-{
-    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
-    Rectangle dest = { position.x, position.y, (float)texture.width*scale, (float)texture.height*scale };
-    Vector2 origin = { 0.0f, 0.0f };
+    for (int i = 0; i < 16; i++)
+    {
+        if (block[i].a < minAlpha) minAlpha = block[i].a;
+        if (block[i].a > maxAlpha) maxAlpha = block[i].a;
 
-    DrawTexturePro(texture, source, dest, origin, rotation, tint);
-}
+        if ((block[i].a > 0) && (block[i].a < 255))
+        {
+            if (block[i].a < innerMin) innerMin = block[i].a;
+            if (block[i].a > innerMax) innerMax = block[i].a;
+        }
+    }
 
-// Draw a part of a texture (defined by a rectangle)
-void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint)
-{
-    Rectangle dest = { position.x, position.y, fabsf(source.width), fabsf(source.height) };
-    Vector2 origin = { 0.0f, 0.0f };
+    int a0 = maxAlpha;
+    int a1 = minAlpha;
+    int indices[16] = { 0 };
+    int error = FitDXTAlphaIndices(block, a0, a1, indices);
 
-    DrawTexturePro(texture, source, dest, origin, 0.0f, tint);
-}
+    if ((quality > 0) && (error > 0))
+    {
+        int candidateIndices[16] = { 0 };
 
-// Draw texture quad with tiling and offset parameters
-// NOTE: Tiling and offset should be provided considering normalized texture values [0..1]
-// i.e tiling = { 1.0f, 1.0f } refers to all texture, offset = { 0.5f, 0.5f } moves texture origin to center
-void DrawTextureQuad(Texture2D texture, Vector2 tiling, Vector2 offset, Rectangle quad, Color tint)
-{
-    Rectangle source = { offset.x*texture.width, offset.y*texture.height, tiling.x*texture.width, tiling.y*texture.height };
-    Vector2 origin = { 0.0f, 0.0f };
+        if (innerMin > innerMax) { innerMin = minAlpha; innerMax = minAlpha; }
 
-    DrawTexturePro(texture, source, quad, origin, 0.0f, tint);
-}
+        int candidateError = FitDXTAlphaIndices(block, innerMin, innerMax, candidateIndices);
 
-// Draw part of a texture (defined by a rectangle) with rotation and scale tiled into dest.
-// NOTE: For tilling a whole texture DrawTextureQuad() is better
-void DrawTextureTiled(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, float scale, Color tint)
-{
-    if (texture.id <= 0 || scale <= 0.0f) return;  // Wanna see a infinite loop?!...just delete this line!
+        if (candidateError < error)
+        {
+            a0 = innerMin;
+            a1 = innerMax;
+            error = candidateError;
+            for (int i = 0; i < 16; i++) indices[i] = candidateIndices[i];
+        }
 
-    int tileWidth = (int)(source.width*scale), tileHeight = (int)(source.height*scale);
-    if (dest.width < tileWidth && dest.height < tileHeight)
+        if (quality > 1)
+        {
+            int base0 = maxAlpha, base1 = minAlpha;
+
+            for (int d0 = -2; d0 <= 2; d0++)
+            {
+                for (int d1 = -2; d1 <= 2; d1++)
+                {
+                    int c0 = base0 + d0;
+                    int c1 = base1 + d1;
+
+                    if ((c0 < 0) || (c0 > 255) || (c1 < 0) || (c1 > 255) || (c0 <= c1)) continue;
+
+                    candidateError = FitDXTAlphaIndices(block, c0, c1, candidateIndices);
+
+                    if (candidateError < error)
+                    {
+                        a0 = c0;
+                        a1 = c1;
+                        error = candidateError;
+                        for (int i = 0; i < 16; i++) indices[i] = candidateIndices[i];
+                    }
+                }
+            }
+        }
+    }
+
+    output[0] = (unsigned char)a0;
+    output[1] = (unsigned char)a1;
+
+    // Indices: 48 bits, 3 bit per pixel, little-endian
+    for (int i = 0; i < 2; i++)
     {
-        // Can fit only one tile
-        DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)dest.width/tileWidth)*source.width, ((float)dest.height/tileHeight)*source.height},
-                    (Rectangle){dest.x, dest.y, dest.width, dest.height}, origin, rotation, tint);
+        unsigned int bits = 0;
+        for (int k = 0; k < 8; k++) bits |= (indices[i*8 + k] << (3*k));
+
+        output[2 + i*3] = (unsigned char)(bits & 0xff);
+        output[3 + i*3] = (unsigned char)((bits >> 8) & 0xff);
+        output[4 + i*3] = (unsigned char)((bits >> 16) & 0xff);
     }
-    else if (dest.width <= tileWidth)
+}
+
+// Fit ETC1 subblock modifiers table and indices for provided base color, returns squared error
+static int FitETC1Subblock(const int (*colors)[3], const int *base, int *table, int *indices)
+{
+    static const int modifiers[8][2] = { { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 } };
+
+    int bestError = INT_MAX;
+
+    for (int t = 0; t < 8; t++)
     {
-        // Tiled vertically (one column)
-        int dy = 0;
-        for (;dy+tileHeight < dest.height; dy += tileHeight)
+        // Pixel index values: 0 = +a, 1 = +b, 2 = -a, 3 = -b
+        const int offsets[4] = { modifiers[t][0], modifiers[t][1], -modifiers[t][0], -modifiers[t][1] };
+        int tableIndices[8] = { 0 };
+        int error = 0;
+
+        for (int i = 0; (i < 8) && (error < bestError); i++)
         {
-            DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)dest.width/tileWidth)*source.width, source.height}, (Rectangle){dest.x, dest.y + dy, dest.width, (float)tileHeight}, origin, rotation, tint);
+            int bestPixelError = INT_MAX;
+
+            for (int m = 0; m < 4; m++)
+            {
+                int pixelError = 0;
+
+                for (int k = 0; k < 3; k++)
+                {
+                    int value = base[k] + offsets[m];
+                    value = (value < 0)? 0 : ((value > 255)? 255 : value);
+                    pixelError += (colors[i][k] - value)*(colors[i][k] - value);
+                }
+
+                if (pixelError < bestPixelError)
+                {
+                    bestPixelError = pixelError;
+                    tableIndices[i] = m;
+                }
+            }
+
+            error += bestPixelError;
         }
 
-        // Fit last tile
-        if (dy < dest.height)
+        if (error < bestError)
         {
-            DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)dest.width/tileWidth)*source.width, ((float)(dest.height - dy)/tileHeight)*source.height},
-                        (Rectangle){dest.x, dest.y + dy, dest.width, dest.height - dy}, origin, rotation, tint);
+            bestError = error;
+            *table = t;
+            for (int i = 0; i < 8; i++) indices[i] = tableIndices[i];
         }
     }
-    else if (dest.height <= tileHeight)
+
+    return bestError;
+}
+
+// Fit ETC1 subblock base colors candidates (4 or 5 bit per channel), returns best candidate squared error
+// NOTE: Quality 2 also tries base color candidates around the average color
+static int FitETC1SubblockCandidates(const int (*colors)[3], const float *average, int bits, int quality, int (*bases)[3], int *errors, int *tables, int (*indices)[8], int *count)
+{
+    static const int offsets[9][3] = { { 0, 0, 0 }, { 1, 1, 1 }, { -1, -1, -1 }, { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+
+    int maxValue = (1 << bits) - 1;
+    int candidates = (quality > 1)? 9 : 1;
+    int bestError = INT_MAX;
+
+    *count = 0;
+
+    for (int c = 0; c < candidates; c++)
     {
-        // Tiled horizontally (one row)
-        int dx = 0;
-        for (;dx+tileWidth < dest.width; dx += tileWidth)
-        {
-            DrawTexturePro(texture, (Rectangle){source.x, source.y, source.width, ((float)dest.height/tileHeight)*source.height}, (Rectangle){dest.x + dx, dest.y, (float)tileWidth, dest.height}, origin, rotation, tint);
-        }
+        int base[3] = { 0 };
+        int expanded[3] = { 0 };
+        bool valid = true;
 
-        // Fit last tile
-        if (dx < dest.width)
+        for (int k = 0; k < 3; k++)
         {
-            DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)(dest.width - dx)/tileWidth)*source.width, ((float)dest.height/tileHeight)*source.height},
-                        (Rectangle){dest.x + dx, dest.y, dest.width - dx, dest.height}, origin, rotation, tint);
+            base[k] = (int)(average[k]*maxValue/255.0f + 0.5f) + offsets[c][k];
+
+            if ((base[k] < 0) || (base[k] > maxValue)) valid = false;
+            else expanded[k] = (bits == 4)? ((base[k] << 4) | base[k]) : ((base[k] << 3) | (base[k] >> 2));
         }
+
+        if (!valid) continue;
+
+        int n = *count;
+        for (int k = 0; k < 3; k++) bases[n][k] = base[k];
+        errors[n] = FitETC1Subblock(colors, expanded, &tables[n], indices[n]);
+
+        if (errors[n] < bestError) bestError = errors[n];
+        (*count)++;
     }
-    else
+
+    return bestError;
+}
+
+// Compress 4x4 block color (ETC1 block: two subblocks with base color and modifiers table)
+// NOTE: Generated blocks are also valid ETC2 RGB blocks (ETC2 T, H and planar modes not used)
+// Quality 0 uses differential mode when base colors allow it, quality 1+ chooses best mode by error
+static void CompressBlockETC1(const Color *block, unsigned char *output, int quality)
+{
+    unsigned int bestHigh = 0;
+    unsigned int bestLow = 0;
+    int bestError = INT_MAX;
+
+    for (int flip = 0; flip < 2; flip++)
     {
-        // Tiled both horizontally and vertically (rows and columns)
-        int dx = 0;
-        for (;dx+tileWidth < dest.width; dx += tileWidth)
+        // Subblocks: 2x4 (flip = 0) or 4x2 (flip = 1), pixels positions stored as x*4 + y (index bit position)
+        int colors[2][8][3] = { 0 };
+        int positions[2][8] = { 0 };
+        float average[2][3] = { 0 };
+
+        for (int s = 0; s < 2; s++)
         {
-            int dy = 0;
-            for (;dy+tileHeight < dest.height; dy += tileHeight)
+            for (int i = 0; i < 8; i++)
             {
-                DrawTexturePro(texture, source, (Rectangle){dest.x + dx, dest.y + dy, (float)tileWidth, (float)tileHeight}, origin, rotation, tint);
+                int x = flip? (i%4) : (s*2 + i%2);
+                int y = flip? (s*2 + i/4) : (i/2);
+                Color pixel = block[y*4 + x];
+
+                colors[s][i][0] = pixel.r;
+                colors[s][i][1] = pixel.g;
+                colors[s][i][2] = pixel.b;
+                positions[s][i] = x*4 + y;
+
+                average[s][0] += pixel.r/8.0f;
+                average[s][1] += pixel.g/8.0f;
+                average[s][2] += pixel.b/8.0f;
             }
+        }
 
-            if (dy < dest.height)
+        for (int diff = 1; diff >= 0; diff--)
+        {
+            int bases[2][9][3] = { 0 };
+            int errors[2][9] = { 0 };
+            int tables[2][9] = { 0 };
+            int indices[2][9][8] = { 0 };
+            int count[2] = { 0 };
+
+            for (int s = 0; s < 2; s++) FitETC1SubblockCandidates(colors[s], average[s], diff? 5 : 4, quality, bases[s], errors[s], tables[s], indices[s], &count[s]);
+
+            // Select best candidates pair, differential mode requires base colors delta in [-4..3] range
+            int best[2] = { -1, -1 };
+            int error = INT_MAX;
+
+            for (int c0 = 0; c0 < count[0]; c0++)
             {
-                DrawTexturePro(texture, (Rectangle){source.x, source.y, source.width, ((float)(dest.height - dy)/tileHeight)*source.height},
-                    (Rectangle){dest.x + dx, dest.y + dy, (float)tileWidth, dest.height - dy}, origin, rotation, tint);
+                for (int c1 = 0; c1 < count[1]; c1++)
+                {
+                    if (diff)
+                    {
+                        bool valid = true;
+
+                        for (int k = 0; k < 3; k++)
+                        {
+                            int delta = bases[1][c1][k] - bases[0][c0][k];
+                            if ((delta < -4) || (delta > 3)) valid = false;
+                        }
+
+                        if (!valid) continue;
+                    }
+
+                    if ((errors[0][c0] + errors[1][c1]) < error)
+                    {
+                        error = errors[0][c0] + errors[1][c1];
+                        best[0] = c0;
+                        best[1] = c1;
+                    }
+                }
             }
-        }
 
-        // Fit last column of tiles
-        if (dx < dest.width)
-        {
-            int dy = 0;
-            for (;dy+tileHeight < dest.height; dy += tileHeight)
+            if ((best[0] >= 0) && (error < bestError))
             {
-                DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)(dest.width - dx)/tileWidth)*source.width, source.height},
-                        (Rectangle){dest.x + dx, dest.y + dy, dest.width - dx, (float)tileHeight}, origin, rotation, tint);
+                const int *base0 = bases[0][best[0]];
+                const int *base1 = bases[1][best[1]];
+                unsigned int high = 0;
+                unsigned int low = 0;
+
+                if (diff) high = (base0[0] << 27) | (((base1[0] - base0[0]) & 0x07) << 24) |
+                                 (base0[1] << 19) | (((base1[1] - base0[1]) & 0x07) << 16) |
+                                 (base0[2] << 11) | (((base1[2] - base0[2]) & 0x07) << 8);
+                else high = (base0[0] << 28) | (base1[0] << 24) | (base0[1] << 20) | (base1[1] << 16) | (base0[2] << 12) | (base1[2] << 8);
+
+                high |= (tables[0][best[0]] << 5) | (tables[1][best[1]] << 2) | (diff << 1) | flip;
+
+                // Pixel indices: most significant bits on bits 16..31, least significant bits on bits 0..15
+                for (int s = 0; s < 2; s++)
+                {
+                    for (int i = 0; i < 8; i++)
+                    {
+                        unsigned int index = indices[s][best[s]][i];
+                        low |= ((index >> 1) << (16 + positions[s][i])) | ((index & 1) << positions[s][i]);
+                    }
+                }
+
+                bestError = error;
+                bestHigh = high;
+                bestLow = low;
             }
 
-            // Draw final tile in the bottom right corner
-            if (dy < dest.height)
+            // Quality 0: individual mode only evaluated if differential mode is not possible
+            if ((quality == 0) && (best[0] >= 0)) break;
+        }
+    }
+
+    // Block data is stored as big-endian
+    for (int i = 0; i < 4; i++)
+    {
+        output[i] = (unsigned char)((bestHigh >> (24 - 8*i)) & 0xff);
+        output[4 + i] = (unsigned char)((bestLow >> (24 - 8*i)) & 0xff);
+    }
+}
+
+// Fit EAC alpha block indices for provided base, multiplier and modifiers table, returns squared error
+static int FitEACAlphaIndices(const Color *block, int base, int multiplier, const int *modifiers, int *indices)
+{
+    int error = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        int bestError = INT_MAX;
+
+        for (int m = 0; m < 8; m++)
+        {
+            int value = base + modifiers[m]*multiplier;
+            value = (value < 0)? 0 : ((value > 255)? 255 : value);
+
+            int pixelError = (block[i].a - value)*(block[i].a - value);
+
+            if (pixelError < bestError)
             {
-                DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)(dest.width - dx)/tileWidth)*source.width, ((float)(dest.height - dy)/tileHeight)*source.height},
-                    (Rectangle){dest.x + dx, dest.y + dy, dest.width - dx, dest.height - dy}, origin, rotation, tint);
+                bestError = pixelError;
+                indices[i] = m;
             }
         }
+
+        error += bestError;
     }
+
+    return error;
 }
 
-// Draw a part of a texture (defined by a rectangle) with 'pro' parameters
-// NOTE: origin is relative to destination rectangle size
-void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+// Compress 4x4 block alpha (EAC alpha block: base, multiplier, modifiers table and 3 bit indices)
+// NOTE: Quality 1+ searches multiplier and base values around the ones fitting alpha range
+static void CompressBlockEACAlpha(const Color *block, unsigned char *output, int quality)
 {
-    // Check if texture is valid
-    if (texture.id > 0)
+    static const int modifiers[16][8] = {
+        { -3, -6, -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 }, { -2, -5, -8, -13, 1, 4, 7, 12 }, { -2, -4, -6, -13, 1, 3, 5, 12 },
+        { -3, -6, -8, -12, 2, 5, 7, 11 }, { -3, -7, -9, -11, 2, 6, 8, 10 }, { -4, -7, -8, -11, 3, 6, 7, 10 }, { -3, -5, -8, -11, 2, 4, 7, 10 },
+        { -2, -6, -8, -10, 1, 5, 7, 9 }, { -2, -5, -8, -10, 1, 4, 7, 9 }, { -2, -4, -8, -10, 1, 3, 7, 9 }, { -2, -5, -7, -10, 1, 4, 6, 9 },
+        { -3, -4, -7, -10, 2, 3, 6, 9 }, { -1, -2, -3, -10, 0, 1, 2, 9 }, { -4, -6, -8, -9, 3, 5, 7, 8 }, { -3, -5, -7, -9, 2, 4, 6, 8 }
+    };
+
+    int minAlpha = 255, maxAlpha = 0;
+
+    for (int i = 0; i < 16; i++)
     {
-        float width = (float)texture.width;
-        float height = (float)texture.height;
+        if (block[i].a < minAlpha) minAlpha = block[i].a;
+        if (block[i].a > maxAlpha) maxAlpha = block[i].a;
+    }
 
-        bool flipX = false;
+    // Single alpha value: table 13 includes a zero modifier
+    int bestBase = minAlpha;
+    int bestMultiplier = 1;
+    int bestTable = 13;
+    int indices[16] = { 0 };
+    int bestError = FitEACAlphaIndices(block, bestBase, bestMultiplier, modifiers[bestTable], indices);
 
-        if (source.width < 0) { flipX = true; source.width *= -1; }
-        if (source.height < 0) source.y -= source.height;
+    int searchRange = quality;      // Multiplier and base search range around fitted values
 
-        rlEnableTexture(texture.id);
+    for (int t = 0; (t < 16) && (bestError > 0); t++)
+    {
+        int range = modifiers[t][7] - modifiers[t][3];
+        int fitMultiplier = (int)((float)(maxAlpha - minAlpha)/range + 0.5f);
 
-        rlPushMatrix();
-            rlTranslatef(dest.x, dest.y, 0.0f);
-            rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
-            rlTranslatef(-origin.x, -origin.y, 0.0f);
+        for (int multiplier = fitMultiplier - searchRange; multiplier <= fitMultiplier + searchRange; multiplier++)
+        {
+            if ((multiplier < 1) || (multiplier > 15)) continue;
 
-            rlBegin(RL_QUADS);
-                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-                rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+            int fitBase = minAlpha - modifiers[t][3]*multiplier;
 
-                // Bottom-left corner for texture and quad
-                if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
-                else rlTexCoord2f(source.x/width, source.y/height);
-                rlVertex2f(0.0f, 0.0f);
+            for (int base = fitBase - searchRange; base <= fitBase + searchRange; base++)
+            {
+                if ((base < 0) || (base > 255)) continue;
 
-                // Bottom-right corner for texture and quad
-                if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-                else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-                rlVertex2f(0.0f, dest.height);
+                int candidateIndices[16] = { 0 };
+                int error = FitEACAlphaIndices(block, base, multiplier, modifiers[t], candidateIndices);
 
-                // Top-right corner for texture and quad
-                if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-                else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-                rlVertex2f(dest.width, dest.height);
+                if (error < bestError)
+                {
+                    bestError = error;
+                    bestBase = base;
+                    bestMultiplier = multiplier;
+                    bestTable = t;
+                    for (int i = 0; i < 16; i++) indices[i] = candidateIndices[i];
+                }
+            }
+        }
+    }
 
-                // Top-left corner for texture and quad
-                if (flipX) rlTexCoord2f(source.x/width, source.y/height);
-                else rlTexCoord2f((source.x + source.width)/width, source.y/height);
-                rlVertex2f(dest.width, 0.0f);
-            rlEnd();
-        rlPopMatrix();
+    output[0] = (unsigned char)bestBase;
+    output[1] = (unsigned char)((bestMultiplier << 4) | bestTable);
 
-        rlDisableTexture();
+    // Indices: 48 bits, 3 bit per pixel, big-endian, pixels in columns order (first pixel on most significant bits)
+    unsigned int bits[2] = { 0 };
+
+    for (int x = 0; x < 4; x++)
+    {
+        for (int y = 0; y < 4; y++)
+        {
+            int p = x*4 + y;
+            bits[p/8] |= (indices[y*4 + x] << (21 - 3*(p%8)));
+        }
+    }
+
+    for (int i = 0; i < 2; i++)
+    {
+        output[2 + i*3] = (unsigned char)((bits[i] >> 16) & 0xff);
+        output[3 + i*3] = (unsigned char)((bits[i] >> 8) & 0xff);
+        output[4 + i*3] = (unsigned char)(bits[i] & 0xff);
     }
 }
 
-// Draws a texture (or part of it) that stretches or shrinks nicely using n-patch info
-void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint)
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Resize pixel data (8bit per channel), split in output rows bands if image processing threads enabled
+static void ResizeImageData(const unsigned char *input, int width, int height, unsigned char *output, int newWidth, int newHeight, int channels)
 {
-    if (texture.id > 0)
+    int threads = GetImageJobThreads(newWidth, newHeight);
+
+    if (threads > 1)
     {
-        float width = (float)texture.width;
-        float height = (float)texture.height;
+        ResizeJob job = { input, width, height, output, newWidth, newHeight, channels };
+        RunParallelJob(ResizeImageBand, &job, newHeight, threads);
+    }
+    else stbir_resize_uint8(input, width, height, 0, output, newWidth, newHeight, 0, channels);
+}
 
-        float patchWidth = (dest.width <= 0.0f)? 0.0f : dest.width;
-        float patchHeight = (dest.height <= 0.0f)? 0.0f : dest.height;
+// Resize job: output rows band
+// NOTE: Band uses the same scale as full image resize, shifted by band first row (in output pixels),
+// filters are evaluated at the same positions so results match full image resize
+static void ResizeImageBand(void *data, int start, int end)
+{
+    ResizeJob *job = (ResizeJob *)data;
 
-        if (nPatchInfo.source.width < 0) nPatchInfo.source.x -= nPatchInfo.source.width;
-        if (nPatchInfo.source.height < 0) nPatchInfo.source.y -= nPatchInfo.source.height;
-        if (nPatchInfo.type == NPT_3PATCH_HORIZONTAL) patchHeight = nPatchInfo.source.height;
-        if (nPatchInfo.type == NPT_3PATCH_VERTICAL) patchWidth = nPatchInfo.source.width;
+    stbir_resize_subpixel(job->input, job->width, job->height, 0, job->output + start*job->newWidth*job->channels, job->newWidth, end - start, 0,
+                          STBIR_TYPE_UINT8, job->channels, STBIR_ALPHA_CHANNEL_NONE, 0, STBIR_EDGE_CLAMP, STBIR_EDGE_CLAMP,
+                          STBIR_FILTER_DEFAULT, STBIR_FILTER_DEFAULT, STBIR_COLORSPACE_LINEAR, NULL,
+                          (float)job->newWidth/job->width, (float)job->newHeight/job->height, 0.0f, (float)start);
+}
 
-        bool drawCenter = true;
-        bool drawMiddle = true;
-        float leftBorder = (float)nPatchInfo.left;
-        float topBorder = (float)nPatchInfo.top;
-        float rightBorder = (float)nPatchInfo.right;
-        float bottomBorder = (float)nPatchInfo.bottom;
+// Color tint job: rows band
+static void ColorTintBand(void *data, int start, int end)
+{
+    ColorsJob *job = (ColorsJob *)data;
+    Color *pixels = job->pixels;
 
-        // adjust the lateral (left and right) border widths in case patchWidth < texture.width
-        if (patchWidth <= (leftBorder + rightBorder) && nPatchInfo.type != NPT_3PATCH_VERTICAL)
+    float cR = (float)job->color.r/255;
+    float cG = (float)job->color.g/255;
+    float cB = (float)job->color.b/255;
+    float cA = (float)job->color.a/255;
+
+    for (int y = start; y < end; y++)
+    {
+        for (int x = 0; x < job->width; x++)
         {
-            drawCenter = false;
-            leftBorder = (leftBorder/(leftBorder + rightBorder))*patchWidth;
-            rightBorder = patchWidth - leftBorder;
+            int index = y*job->width + x;
+            unsigned char r = (unsigned char)(((float)pixels[index].r/255*cR)*255.0f);
+            unsigned char g = (unsigned char)(((float)pixels[index].g/255*cG)*255.0f);
+            unsigned char b = (unsigned char)(((float)pixels[index].b/255*cB)*255.0f);
+            unsigned char a = (unsigned char)(((float)pixels[index].a/255*cA)*255.0f);
+
+            pixels[index].r = r;
+            pixels[index].g = g;
+            pixels[index].b = b;
+            pixels[index].a = a;
         }
-        // adjust the lateral (top and bottom) border heights in case patchHeight < texture.height
-        if (patchHeight <= (topBorder + bottomBorder) && nPatchInfo.type != NPT_3PATCH_HORIZONTAL)
+    }
+}
+
+// Color contrast job: rows band
+static void ColorContrastBand(void *data, int start, int end)
+{
+    ColorsJob *job = (ColorsJob *)data;
+    Color *pixels = job->pixels;
+    float contrast = job->contrast;
+
+    for (int y = start; y < end; y++)
+    {
+        for (int x = 0; x < job->width; x++)
         {
-            drawMiddle = false;
-            topBorder = (topBorder/(topBorder + bottomBorder))*patchHeight;
-            bottomBorder = patchHeight - topBorder;
+            float pR = (float)pixels[y*job->width + x].r/255.0f;
+            pR -= 0.5;
+            pR *= contrast;
+            pR += 0.5;
+            pR *= 255;
+            if (pR < 0) pR = 0;
+            if (pR > 255) pR = 255;
+
+            float pG = (float)pixels[y*job->width + x].g/255.0f;
+            pG -= 0.5;
+            pG *= contrast;
+            pG += 0.5;
+            pG *= 255;
+            if (pG < 0) pG = 0;
+            if (pG > 255) pG = 255;
+
+            float pB = (float)pixels[y*job->width + x].b/255.0f;
+            pB -= 0.5;
+            pB *= contrast;
+            pB += 0.5;
+            pB *= 255;
+            if (pB < 0) pB = 0;
+            if (pB > 255) pB = 255;
+
+            pixels[y*job->width + x].r = (unsigned char)pR;
+            pixels[y*job->width + x].g = (unsigned char)pG;
+            pixels[y*job->width + x].b = (unsigned char)pB;
         }
+    }
+}
 
-        Vector2 vertA, vertB, vertC, vertD;
-        vertA.x = 0.0f;                             // outer left
-        vertA.y = 0.0f;                             // outer top
-        vertB.x = leftBorder;                       // inner left
-        vertB.y = topBorder;                        // inner top
-        vertC.x = patchWidth  - rightBorder;        // inner right
-        vertC.y = patchHeight - bottomBorder;       // inner bottom
-        vertD.x = patchWidth;                       // outer right
-        vertD.y = patchHeight;                      // outer bottom
+// Color brightness job: rows band
+static void ColorBrightnessBand(void *data, int start, int end)
+{
+    ColorsJob *job = (ColorsJob *)data;
+    Color *pixels = job->pixels;
+    int brightness = job->brightness;
 
-        Vector2 coordA, coordB, coordC, coordD;
-        coordA.x = nPatchInfo.source.x/width;
-        coordA.y = nPatchInfo.source.y/height;
-        coordB.x = (nPatchInfo.source.x + leftBorder)/width;
-        coordB.y = (nPatchInfo.source.y + topBorder)/height;
-        coordC.x = (nPatchInfo.source.x + nPatchInfo.source.width  - rightBorder)/width;
-        coordC.y = (nPatchInfo.source.y + nPatchInfo.source.height - bottomBorder)/height;
-        coordD.x = (nPatchInfo.source.x + nPatchInfo.source.width)/width;
-        coordD.y = (nPatchInfo.source.y + nPatchInfo.source.height)/height;
+    for (int y = start; y < end; y++)
+    {
+        for (int x = 0; x < job->width; x++)
+        {
+            int cR = pixels[y*job->width + x].r + brightness;
+            int cG = pixels[y*job->width + x].g + brightness;
+            int cB = pixels[y*job->width + x].b + brightness;
 
-        rlEnableTexture(texture.id);
+            if (cR < 0) cR = 1;
+            if (cR > 255) cR = 255;
 
-        rlPushMatrix();
-            rlTranslatef(dest.x, dest.y, 0.0f);
-            rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
-            rlTranslatef(-origin.x, -origin.y, 0.0f);
+            if (cG < 0) cG = 1;
+            if (cG > 255) cG = 255;
 
-            rlBegin(RL_QUADS);
-                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-                rlNormal3f(0.0f, 0.0f, 1.0f);               // Normal vector pointing towards viewer
+            if (cB < 0) cB = 1;
+            if (cB > 255) cB = 255;
 
-                if (nPatchInfo.type == NPT_9PATCH)
-                {
-                    // ------------------------------------------------------------
-                    // TOP-LEFT QUAD
-                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // TOP-CENTER QUAD
-                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
-                    }
-                    // TOP-RIGHT QUAD
-                    rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawMiddle)
-                    {
-                        // ------------------------------------------------------------
-                        // MIDDLE-LEFT QUAD
-                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
-                        if (drawCenter)
-                        {
-                            // MIDDLE-CENTER QUAD
-                            rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-left corner for texture and quad
-                            rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-right corner for texture and quad
-                            rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-right corner for texture and quad
-                            rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-left corner for texture and quad
-                        }
+            pixels[y*job->width + x].r = (unsigned char)cR;
+            pixels[y*job->width + x].g = (unsigned char)cG;
+            pixels[y*job->width + x].b = (unsigned char)cB;
+        }
+    }
+}
+#endif      // SUPPORT_IMAGE_MANIPULATION
 
-                        // MIDDLE-RIGHT QUAD
-                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-left corner for texture and quad
-                    }
+// Get image alpha border rectangle
+// NOTE: Threshold is defined as a percentatge: 0.0f -> 1.0f
+Rectangle GetImageAlphaBorder(Image image, float threshold)
+{
+    Rectangle crop = { 0 };
 
-                    // ------------------------------------------------------------
-                    // BOTTOM-LEFT QUAD
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // BOTTOM-CENTER QUAD
-                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-left corner for texture and quad
-                    }
+    Color *pixels = LoadImageColors(image);
 
-                    // BOTTOM-RIGHT QUAD
-                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-left corner for texture and quad
-                }
-                else if (nPatchInfo.type == NPT_3PATCH_VERTICAL)
-                {
-                    // TOP QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // MIDDLE QUAD
-                        // -----------------------------------------------------------
-                        // Texture coords                 Vertices
-                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
-                    }
-                    // BOTTOM QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
-                }
-                else if (nPatchInfo.type == NPT_3PATCH_HORIZONTAL)
+    if (pixels != NULL)
+    {
+        int xMin = 65536;   // Define a big enough number
+        int xMax = 0;
+        int yMin = 65536;
+        int yMax = 0;
+
+        for (int y = 0; y < image.height; y++)
+        {
+            for (int x = 0; x < image.width; x++)
+            {
+                if (pixels[y*image.width + x].a > (unsigned char)(threshold*255.0f))
                 {
-                    // LEFT QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // CENTER QUAD
-                        // -----------------------------------------------------------
-                        // Texture coords                 Vertices
-                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
-                    }
-                    // RIGHT QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
+                    if (x < xMin) xMin = x;
+                    if (x > xMax) xMax = x;
+                    if (y < yMin) yMin = y;
+                    if (y > yMax) yMax = y;
                 }
-            rlEnd();
-        rlPopMatrix();
+            }
+        }
 
-        rlDisableTexture();
+        // Check for empty blank image
+        if ((xMin != 65536) && (xMax != 65536))
+        {
+            crop = (Rectangle){ (float)xMin, (float)yMin, (float)((xMax + 1) - xMin), (float)((yMax + 1) - yMin) };
+        }
+
+        UnloadImageColors(pixels);
     }
+
+    return crop;
+}
+
+//------------------------------------------------------------------------------------
+// Image drawing functions
+//------------------------------------------------------------------------------------
+// Clear image background with given color
+void ImageClearBackground(Image *dst, Color color)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+
+    ImageFillRectangle(dst, 0, 0, dst->width, dst->height, color);
+}
+
+// Draw pixel within an image
+// NOTE: Compressed image formats not supported
+void ImageDrawPixel(Image *dst, int x, int y, Color color)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (x < 0) || (x >= dst->width) || (y < 0) || (y >= dst->height)) return;
+
+    switch (dst->format)
+    {
+        case UNCOMPRESSED_GRAYSCALE:
+        {
+            // NOTE: Calculate grayscale equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+
+            ((unsigned char *)dst->data)[y*dst->width + x] = gray;
+
+        } break;
+        case UNCOMPRESSED_GRAY_ALPHA:
+        {
+            // NOTE: Calculate grayscale equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+
+            ((unsigned char *)dst->data)[(y*dst->width + x)*2] = gray;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*2 + 1] = color.a;
+
+        } break;
+        case UNCOMPRESSED_R5G6B5:
+        {
+            // NOTE: Calculate R5G6B5 equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+            unsigned char r = (unsigned char)(round(coln.x*31.0f));
+            unsigned char g = (unsigned char)(round(coln.y*63.0f));
+            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+
+            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+
+        } break;
+        case UNCOMPRESSED_R5G5B5A1:
+        {
+            // NOTE: Calculate R5G5B5A1 equivalent color
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+            unsigned char r = (unsigned char)(round(coln.x*31.0f));
+            unsigned char g = (unsigned char)(round(coln.y*31.0f));
+            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+            unsigned char a = (coln.w > ((float)UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;;
+
+            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+
+        } break;
+        case UNCOMPRESSED_R4G4B4A4:
+        {
+            // NOTE: Calculate R5G5B5A1 equivalent color
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+            unsigned char r = (unsigned char)(round(coln.x*15.0f));
+            unsigned char g = (unsigned char)(round(coln.y*15.0f));
+            unsigned char b = (unsigned char)(round(coln.z*15.0f));
+            unsigned char a = (unsigned char)(round(coln.w*15.0f));
+
+            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+
+        } break;
+        case UNCOMPRESSED_R8G8B8:
+        {
+            ((unsigned char *)dst->data)[(y*dst->width + x)*3] = color.r;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*3 + 1] = color.g;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*3 + 2] = color.b;
+
+        } break;
+        case UNCOMPRESSED_R8G8B8A8:
+        {
+            ((unsigned char *)dst->data)[(y*dst->width + x)*4] = color.r;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 1] = color.g;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 2] = color.b;
+            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 3] = color.a;
+
+        } break;
+        case UNCOMPRESSED_R32:
+        {
+            // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+            ((float *)dst->data)[y*dst->width + x] = coln.x*0.299f + coln.y*0.587f + coln.z*0.114f;
+
+        } break;
+        case UNCOMPRESSED_R32G32B32:
+        {
+            // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+            ((float *)dst->data)[(y*dst->width + x)*3] = coln.x;
+            ((float *)dst->data)[(y*dst->width + x)*3 + 1] = coln.y;
+            ((float *)dst->data)[(y*dst->width + x)*3 + 2] = coln.z;
+        } break;
+        case UNCOMPRESSED_R32G32B32A32:
+        {
+            // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+            ((float *)dst->data)[(y*dst->width + x)*4] = coln.x;
+            ((float *)dst->data)[(y*dst->width + x)*4 + 1] = coln.y;
+            ((float *)dst->data)[(y*dst->width + x)*4 + 2] = coln.z;
+            ((float *)dst->data)[(y*dst->width + x)*4 + 3] = coln.w;
+
+        } break;
+        default: break;
+    }
+}
+
+// Draw pixel within an image (Vector version)
+void ImageDrawPixelV(Image *dst, Vector2 position, Color color)
+{
+    ImageDrawPixel(dst, (int)position.x, (int)position.y, color);
+}
+
+// Draw line within an image
+void ImageDrawLine(Image *dst, int startPosX, int startPosY, int endPosX, int endPosY, Color color)
+{
+    int m = 2*(endPosY - startPosY);
+    int slopeError = m - (endPosX - startPosX);
+
+    for (int x = startPosX, y = startPosY; x <= endPosX; x++)
+    {
+        ImageDrawPixel(dst, x, y, color);
+        slopeError += m;
+
+        if (slopeError >= 0)
+        {
+            y++;
+            slopeError -= 2*(endPosX - startPosX);
+        }
+    }
+}
+
+// Draw line within an image (Vector version)
+void ImageDrawLineV(Image *dst, Vector2 start, Vector2 end, Color color)
+{
+    ImageDrawLine(dst, (int)start.x, (int)start.y, (int)end.x, (int)end.y, color);
+}
+
+// Draw circle within an image
+void ImageDrawCircle(Image *dst, int centerX, int centerY, int radius, Color color)
+{
+    int x = 0, y = radius;
+    int decesionParameter = 3 - 2*radius;
+
+    while (y >= x)
+    {
+        ImageDrawPixel(dst, centerX + x, centerY + y, color);
+        ImageDrawPixel(dst, centerX - x, centerY + y, color);
+        ImageDrawPixel(dst, centerX + x, centerY - y, color);
+        ImageDrawPixel(dst, centerX - x, centerY - y, color);
+        ImageDrawPixel(dst, centerX + y, centerY + x, color);
+        ImageDrawPixel(dst, centerX - y, centerY + x, color);
+        ImageDrawPixel(dst, centerX + y, centerY - x, color);
+        ImageDrawPixel(dst, centerX - y, centerY - x, color);
+        x++;
+
+        if (decesionParameter > 0)
+        {
+            y--;
+            decesionParameter = decesionParameter + 4*(x - y) + 10;
+        }
+        else decesionParameter = decesionParameter + 4*x + 6;
+    }
+}
+
+// Draw circle within an image (Vector version)
+void ImageDrawCircleV(Image *dst, Vector2 center, int radius, Color color)
+{
+    ImageDrawCircle(dst, (int)center.x, (int)center.y, radius, color);
+}
+
+// Draw rectangle within an image
+void ImageDrawRectangle(Image *dst, int posX, int posY, int width, int height, Color color)
+{
+    ImageDrawRectangleRec(dst, (Rectangle){ (float)posX, (float)posY, (float)width, (float)height }, color);
+}
+
+// Draw rectangle within an image (Vector version)
+void ImageDrawRectangleV(Image *dst, Vector2 position, Vector2 size, Color color)
+{
+    ImageDrawRectangle(dst, (int)position.x, (int)position.y, (int)size.x, (int)size.y, color);
+}
+
+// Draw rectangle within an image
+void ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+
+    int sy = (int)rec.y;
+    int ey = sy + (int)rec.height;
+
+    int sx = (int)rec.x;
+    int ex = sx + (int)rec.width;
+
+    // Clip rectangle to image bounds
+    if (sx < 0) sx = 0;
+    if (sy < 0) sy = 0;
+    if (ex > dst->width) ex = dst->width;
+    if (ey > dst->height) ey = dst->height;
+
+    if ((sx < ex) && (sy < ey)) ImageFillRectangle(dst, sx, sy, ex - sx, ey - sy, color);
+}
+
+// Draw rectangle lines within an image
+void ImageDrawRectangleLines(Image *dst, Rectangle rec, int thick, Color color)
+{
+    ImageDrawRectangle(dst, (int)rec.x, (int)rec.y, (int)rec.width, thick, color);
+    ImageDrawRectangle(dst, (int)rec.x, (int)(rec.y + thick), thick, (int)(rec.height - thick*2), color);
+    ImageDrawRectangle(dst, (int)(rec.x + rec.width - thick), (int)(rec.y + thick), thick, (int)(rec.height - thick*2), color);
+    ImageDrawRectangle(dst, (int)rec.x, (int)(rec.y + rec.height - thick), (int)rec.width, thick, color);
+}
+
+// Draw an image (source) within an image (destination)
+// NOTE: Color tint is applied to source image
+void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) ||
+        (src.data == NULL) || (src.width == 0) || (src.height == 0)) return;
+
+    if (dst->mipmaps > 1) TRACELOG(LOG_WARNING, "Image drawing only applied to base mipmap level");
+    if (dst->format >= COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image drawing not supported for compressed formats");
+    else
+    {
+        Image srcMod = { 0 };       // Source copy (in case it was required)
+        Image *srcPtr = &src;       // Pointer to source image
+        bool useSrcMod = false;     // Track source copy required
+
+        // Source rectangle out-of-bounds security checks
+        if (srcRec.x < 0) { srcRec.width += srcRec.x; srcRec.x = 0; }
+        if (srcRec.y < 0) { srcRec.height += srcRec.y; srcRec.y = 0; }
+        if ((srcRec.x + srcRec.width) > src.width) srcRec.width = src.width - srcRec.x;
+        if ((srcRec.y + srcRec.height) > src.height) srcRec.height = src.height - srcRec.y;
+
+        // Check if source rectangle needs to be resized to destination rectangle
+        // In that case, we make a copy of source and we apply all required transform
+        if (((int)srcRec.width != (int)dstRec.width) || ((int)srcRec.height != (int)dstRec.height))
+        {
+            srcMod = ImageFromImage(src, srcRec);   // Create image from another image
+            ImageResize(&srcMod, (int)dstRec.width, (int)dstRec.height);   // Resize to destination rectangle
+            srcRec = (Rectangle){ 0, 0, (float)srcMod.width, (float)srcMod.height };
+
+            srcPtr = &srcMod;
+            useSrcMod = true;
+        }
+
+        // Destination rectangle out-of-bounds security checks
+        if (dstRec.x < 0)
+        {
+            srcRec.x = -dstRec.x;
+            srcRec.width += dstRec.x;
+            dstRec.x = 0;
+        }
+        else if ((dstRec.x + srcRec.width) > dst->width) srcRec.width = dst->width - dstRec.x;
+
+        if (dstRec.y < 0)
+        {
+            srcRec.y = -dstRec.y;
+            srcRec.height += dstRec.y;
+            dstRec.y = 0;
+        }
+        else if ((dstRec.y + srcRec.height) > dst->height) srcRec.height = dst->height - dstRec.y;
+
+        if (dst->width < srcRec.width) srcRec.width = (float)dst->width;
+        if (dst->height < srcRec.height) srcRec.height = (float)dst->height;
+
+        // This blitting method is quite fast! The process followed is:
+        // for every pixel -> [get_src_format/get_dst_format -> blend -> format_to_dst]
+        // Some optimization ideas:
+        //    [x] Avoid creating source copy if not required (no resize required)
+        //    [x] Optimize ImageResize() for pixel format (alternative: ImageResizeNN())
+        //    [x] Optimize ColorAlphaBlend() to avoid processing (alpha = 0) and (alpha = 1)
+        //    [x] Optimize ColorAlphaBlend() for faster operations (maybe avoiding divs?)
+        //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
+        //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
+        //    [x] Consider fast path: 8bit per channel src/dst formats -> blend full rows, tint applied on same pass
+        //    [-] GetPixelColor(): Return Vector4 instead of Color, easier for ColorAlphaBlend()
+
+        Color colSrc, colDst, blend;
+        bool blendRequired = true;
+
+        // Fast path: Avoid blend if source has no alpha to blend
+        if ((tint.a == 255) && ((srcPtr->format == UNCOMPRESSED_GRAYSCALE) || (srcPtr->format == UNCOMPRESSED_R8G8B8) || (srcPtr->format == UNCOMPRESSED_R5G6B5))) blendRequired = false;
+
+        // Fast path: Blend full rows if source and destination are 8bit per channel formats
+        bool blendRows = blendRequired && ((dst->format == UNCOMPRESSED_R8G8B8A8) || (dst->format == UNCOMPRESSED_R8G8B8)) &&
+                         ((srcPtr->format == UNCOMPRESSED_GRAYSCALE) || (srcPtr->format == UNCOMPRESSED_GRAY_ALPHA) ||
+                          (srcPtr->format == UNCOMPRESSED_R8G8B8) || (srcPtr->format == UNCOMPRESSED_R8G8B8A8));
+
+        int strideDst = GetPixelDataSize(dst->width, 1, dst->format);
+        int bytesPerPixelDst = strideDst/(dst->width);
+
+        int strideSrc = GetPixelDataSize(srcPtr->width, 1, srcPtr->format);
+        int bytesPerPixelSrc = strideSrc/(srcPtr->width);
+
+        unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
+        unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
+
+        for (int y = 0; y < (int)srcRec.height; y++)
+        {
+            unsigned char *pSrc = pSrcBase;
+            unsigned char *pDst = pDstBase;
+
+            // Fast path: Avoid moving pixel by pixel if no blend required and same format
+            if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
+            else if (blendRows) BlendPixelsRow(pDst, dst->format, pSrc, srcPtr->format, (int)srcRec.width, tint);
+            else
+            {
+                for (int x = 0; x < (int)srcRec.width; x++)
+                {
+                    colSrc = GetPixelColor(pSrc, srcPtr->format);
+                    colDst = GetPixelColor(pDst, dst->format);
+
+                    // Fast path: Avoid blend if source has no alpha to blend
+                    if (blendRequired) blend = ColorAlphaBlend(colDst, colSrc, tint);
+                    else blend = colSrc;
+
+                    SetPixelColor(pDst, blend, dst->format);
+
+                    pDst += bytesPerPixelDst;
+                    pSrc += bytesPerPixelSrc;
+                }
+            }
+
+            pSrcBase += strideSrc;
+            pDstBase += strideDst;
+        }
+
+        if (useSrcMod) UnloadImage(srcMod);     // Unload source modified image
+    }
+}
+
+// Draw text (default font) within an image (destination)
+void ImageDrawText(Image *dst, const char *text, int posX, int posY, int fontSize, Color color)
+{
+    Vector2 position = { (float)posX, (float)posY };
+
+    // NOTE: For default font, sapcing is set to desired font size / default font size (10)
+    ImageDrawTextEx(dst, GetFontDefault(), text, position, (float)fontSize, (float)fontSize/10, color);
+}
+
+// Draw text (custom sprite font) within an image (destination)
+void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    Image imText = ImageTextEx(font, text, fontSize, spacing, tint);
+
+    Rectangle srcRec = { 0.0f, 0.0f, (float)imText.width, (float)imText.height };
+    Rectangle dstRec = { position.x, position.y, (float)imText.width, (float)imText.height };
+
+    ImageDraw(dst, imText, srcRec, dstRec, WHITE);
+
+    UnloadImage(imText);
+}
+
+//------------------------------------------------------------------------------------
+// Texture loading functions
+//------------------------------------------------------------------------------------
+// Load texture from file into GPU memory (VRAM)
+Texture2D LoadTexture(const char *fileName)
+{
+    Texture2D texture = { 0 };
+
+    // NOTE: Container files (DDS, KTX, PVR, ASTC) data is uploaded directly from file mapping
+    Image image = LoadImageMapped(fileName);
+
+    if (image.data != NULL)
+    {
+        texture = LoadTextureFromImage(image);
+        UnloadImage(image);
+    }
+
+    return texture;
+}
+
+// Load a texture from image data
+// NOTE: image is not unloaded, it must be done manually
+Texture2D LoadTextureFromImage(Image image)
+{
+    Texture2D texture = { 0 };
+
+    if ((image.data != NULL) && (image.width != 0) && (image.height != 0))
+    {
+        texture.id = rlLoadTexture(image.data, image.width, image.height, image.format, image.mipmaps);
+    }
+    else TRACELOG(LOG_WARNING, "IMAGE: Data is not valid to load texture");
+
+    texture.width = image.width;
+    texture.height = image.height;
+    texture.mipmaps = image.mipmaps;
+    texture.format = image.format;
+
+    return texture;
+}
+
+// Load texture from file asynchronously, returns request id (0 on failure)
+// NOTE: Image is decoded on async worker threads (optionally generating mipmaps and converting format),
+// data is uploaded on BeginDrawing() under the per-frame budget set with SetTextureUploadBudget()
+int LoadTextureAsync(const char *fileName, bool mipmaps, int format)
+{
+    if (fileName == NULL) return 0;
+
+    // Find a free request slot, request slots array grows if required
+    int slot = 0;
+    while ((slot < textureRequestsCount) && (textureRequests[slot] != NULL)) slot++;
+
+    if (slot >= 0xffff)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [%s] Too many async texture requests pending", fileName);
+        return 0;
+    }
+
+    if (slot == textureRequestsCount)
+    {
+        int count = (textureRequestsCount == 0)? 16 : textureRequestsCount*2;
+        textureRequests = (TextureRequest **)RL_REALLOC(textureRequests, count*sizeof(TextureRequest *));
+        for (int i = textureRequestsCount; i < count; i++) textureRequests[i] = NULL;
+        textureRequestsCount = count;
+    }
+
+    TextureRequest *request = (TextureRequest *)RL_CALLOC(1, sizeof(TextureRequest));
+
+    // NOTE: Generation is kept in 15 bits so request id is always positive
+    textureRequestsGeneration = (textureRequestsGeneration + 1) & 0x7fff;
+    request->id = (textureRequestsGeneration << 16) | (slot + 1);
+    request->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+    strcpy(request->fileName, fileName);
+    request->mipmaps = mipmaps;
+    request->format = format;
+    request->state = TEXTURE_REQUEST_PENDING;
+
+    textureRequests[slot] = request;
+
+    RunAsyncJob(LoadTextureAsyncJob, LoadTextureAsyncFinish, LoadTextureAsyncCancel, request);
+
+    return request->id;
+}
+
+// Set callback for async texture request completion
+// NOTE: Callback receives texture ownership (id 0 on failure) and request is released after the call
+void SetTextureAsyncCallback(int request, TextureLoadCallback callback, void *userData)
+{
+    TextureRequest *textureRequest = GetTextureRequest(request);
+
+    if (textureRequest != NULL)
+    {
+        textureRequest->callback = callback;
+        textureRequest->userData = userData;
+    }
+}
+
+// Check if async texture request is completed (loaded or failed)
+bool IsTextureAsyncReady(int request)
+{
+    TextureRequest *textureRequest = GetTextureRequest(request);
+
+    return ((textureRequest != NULL) && ((textureRequest->state == TEXTURE_REQUEST_READY) || (textureRequest->state == TEXTURE_REQUEST_FAILED)));
+}
+
+// Get texture from completed async request, request is released
+// NOTE: Returns texture with id 0 if request is not completed yet or loading failed
+Texture2D GetTextureAsync(int request)
+{
+    Texture2D texture = { 0 };
+
+    if (IsTextureAsyncReady(request))
+    {
+        texture = GetTextureRequest(request)->texture;
+        UnloadTextureRequest(request);
+    }
+
+    return texture;
+}
+
+// Load animated image stream from file (GIF), first frame is loaded into stream texture
+// NOTE: Frames are decoded on demand on async workers (a few frames ahead) and uploaded
+// to the same texture, memory used does not depend on frames count
+ImageStream LoadImageStream(const char *fileName)
+{
+    ImageStream stream = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    if (!IsFileExtension(fileName, ".gif"))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: [%s] Image stream file format not supported", fileName);
+        return stream;
+    }
+
+    ImageStreamData *data = (ImageStreamData *)RL_CALLOC(1, sizeof(ImageStreamData));
+
+    data->fileData = LoadFileData(fileName, &data->fileSize);
+    if (data->fileData != NULL) data->frameCount = ScanGIFFrames(data->fileData, data->fileSize, &data->delays);
+
+    if (data->frameCount > 0)
+    {
+        // Logical screen size from GIF header
+        data->width = data->fileData[6] | (data->fileData[7] << 8);
+        data->height = data->fileData[8] | (data->fileData[9] << 8);
+
+        int size = data->width*data->height*4;
+        for (int i = 0; i < 2; i++) data->history[i] = (unsigned char *)RL_MALLOC(size);
+        for (int i = 0; i < IMAGE_STREAM_BUFFER_FRAMES; i++) data->frames[i] = (unsigned char *)RL_MALLOC(size);
+
+        ResetImageStreamDecoder(data);
+
+        if (DecodeImageStreamFrame(data, 0, data->frames[0]))
+        {
+            Image image = { data->frames[0], data->width, data->height, 1, UNCOMPRESSED_R8G8B8A8 };
+
+            stream.texture = LoadTextureFromImage(image);
+            stream.frameCount = data->frameCount;
+            stream.looping = true;
+            stream.ctxData = data;
+
+            data->nextFrame = 1;
+            data->looping = true;
+
+            TRACELOG(LOG_INFO, "IMAGE: [%s] Image stream loaded successfully (%ix%i, %i frames)", fileName, data->width, data->height, data->frameCount);
+        }
+    }
+
+    if (stream.ctxData == NULL)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: [%s] Failed to load image stream", fileName);
+        UnloadImageStreamData(data);
+    }
+#else
+    TRACELOG(LOG_WARNING, "IMAGE: [%s] Image stream file format not supported", fileName);
+#endif
+
+    return stream;
+}
+
+// Unload image stream texture and decoder data
+// NOTE: If a frame is being decoded, data is unloaded once decoding job finishes
+void UnloadImageStream(ImageStream stream)
+{
+    UnloadTexture(stream.texture);
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    ImageStreamData *data = (ImageStreamData *)stream.ctxData;
+
+    if (data != NULL)
+    {
+        if (data->decoding) data->unloaded = true;
+        else UnloadImageStreamData(data);
+    }
+#endif
+}
+
+// Update image stream playback, stream texture is updated when current frame delay has elapsed
+// NOTE: Frame time is taken from GetFrameTime(), frames not decoded in time are shown late (never skipped)
+void UpdateImageStream(ImageStream stream)
+{
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    ImageStreamData *data = (ImageStreamData *)stream.ctxData;
+
+    if (data == NULL) return;
+
+    data->looping = stream.looping;
+    if (!data->showNext) data->frameTime += GetFrameTime();
+
+    int shown = -1;     // Decoded frame slot to upload, only last due frame is uploaded
+
+    while (data->count > 0)
+    {
+        float delay = (float)data->delays[data->currentFrame]/1000.0f;
+
+        if (data->showNext) data->frameTime = 0.0f;
+        else if (data->frameTime >= delay) data->frameTime -= delay;
+        else break;
+
+        data->showNext = false;
+        data->currentFrame = data->frameIndex[data->first];
+
+        shown = data->first;
+        data->first = (data->first + 1)%IMAGE_STREAM_BUFFER_FRAMES;
+        data->count--;
+    }
+
+    // Last frame is kept on screen if not looping
+    if (!data->looping && (data->currentFrame == (data->frameCount - 1))) data->frameTime = 0.0f;
+
+    if (shown >= 0) UpdateTexture(stream.texture, data->frames[shown]);
+
+    DecodeImageStreamNext(data);
+#endif
+}
+
+// Seek image stream to provided frame, frame is shown once decoded
+// NOTE: Seeking backwards restarts decoding from first frame (GIF frames depend on previous frames)
+void SeekImageStream(ImageStream stream, int frame)
+{
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    ImageStreamData *data = (ImageStreamData *)stream.ctxData;
+
+    if (data == NULL) return;
+
+    if (frame < 0) frame = 0;
+    else if (frame >= data->frameCount) frame = data->frameCount - 1;
+
+    data->generation++;     // Frame being decoded is discarded
+    data->first = 0;
+    data->count = 0;
+    data->nextFrame = frame;
+    data->showNext = true;
+    data->frameTime = 0.0f;
+
+    DecodeImageStreamNext(data);
+#endif
+}
+
+// Get image stream current frame (frame shown on stream texture)
+int GetImageStreamFrame(ImageStream stream)
+{
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    ImageStreamData *data = (ImageStreamData *)stream.ctxData;
+
+    if (data != NULL) return data->currentFrame;
+#endif
+
+    return 0;
+}
+
+// Load cubemap from image, multiple image cubemap layouts supported
+TextureCubemap LoadTextureCubemap(Image image, int layoutType)
+{
+    TextureCubemap cubemap = { 0 };
+
+    if (layoutType == CUBEMAP_AUTO_DETECT)      // Try to automatically guess layout type
+    {
+        // Check image width/height to determine the type of cubemap provided
+        if (image.width > image.height)
+        {
+            if ((image.width/6) == image.height) { layoutType = CUBEMAP_LINE_HORIZONTAL; cubemap.width = image.width/6; }
+            else if ((image.width/4) == (image.height/3)) { layoutType = CUBEMAP_CROSS_FOUR_BY_THREE; cubemap.width = image.width/4; }
+            else if (image.width >= (int)((float)image.height*1.85f)) { layoutType = CUBEMAP_PANORAMA; cubemap.width = image.width/4; }
+        }
+        else if (image.height > image.width)
+        {
+            if ((image.height/6) == image.width) { layoutType = CUBEMAP_LINE_VERTICAL; cubemap.width = image.height/6; }
+            else if ((image.width/3) == (image.height/4)) { layoutType = CUBEMAP_CROSS_THREE_BY_FOUR; cubemap.width = image.width/3; }
+        }
+
+        cubemap.height = cubemap.width;
+    }
+
+    if (layoutType != CUBEMAP_AUTO_DETECT)
+    {
+        int size = cubemap.width;
+
+        Image faces = { 0 };                // Vertical column image
+        Rectangle faceRecs[6] = { 0 };      // Face source rectangles
+        for (int i = 0; i < 6; i++) faceRecs[i] = (Rectangle){ 0, 0, (float)size, (float)size };
+
+        if (layoutType == CUBEMAP_LINE_VERTICAL)
+        {
+            faces = image;
+            for (int i = 0; i < 6; i++) faceRecs[i].y = (float)size*i;
+        }
+        else if (layoutType == CUBEMAP_PANORAMA)
+        {
+            // TODO: Convert panorama image to square faces...
+            // Ref: https://github.com/denivip/panorama/blob/master/panorama.cpp
+        }
+        else
+        {
+            if (layoutType == CUBEMAP_LINE_HORIZONTAL) for (int i = 0; i < 6; i++) faceRecs[i].x = (float)size*i;
+            else if (layoutType == CUBEMAP_CROSS_THREE_BY_FOUR)
+            {
+                faceRecs[0].x = (float)size; faceRecs[0].y = (float)size;
+                faceRecs[1].x = (float)size; faceRecs[1].y = (float)size*3;
+                faceRecs[2].x = (float)size; faceRecs[2].y = 0;
+                faceRecs[3].x = (float)size; faceRecs[3].y = (float)size*2;
+                faceRecs[4].x = 0; faceRecs[4].y = (float)size;
+                faceRecs[5].x = (float)size*2; faceRecs[5].y = (float)size;
+            }
+            else if (layoutType == CUBEMAP_CROSS_FOUR_BY_THREE)
+            {
+                faceRecs[0].x = (float)size*2; faceRecs[0].y = (float)size;
+                faceRecs[1].x = 0; faceRecs[1].y = (float)size;
+                faceRecs[2].x = (float)size; faceRecs[2].y = 0;
+                faceRecs[3].x = (float)size; faceRecs[3].y = (float)size*2;
+                faceRecs[4].x = (float)size; faceRecs[4].y = (float)size;
+                faceRecs[5].x = (float)size*3; faceRecs[5].y = (float)size;
+            }
+
+            // Convert image data to 6 faces in a vertical column, that's the optimum layout for loading
+            faces = GenImageColor(size, size*6, MAGENTA);
+            ImageFormat(&faces, image.format);
+
+            // TODO: Image formating does not work with compressed textures!
+        }
+
+        for (int i = 0; i < 6; i++) ImageDraw(&faces, image, faceRecs[i], (Rectangle){ 0, (float)size*i, (float)size, (float)size }, WHITE);
+
+        cubemap.id = rlLoadTextureCubemap(faces.data, size, faces.format);
+        if (cubemap.id == 0) TRACELOG(LOG_WARNING, "IMAGE: Failed to load cubemap image");
+
+        UnloadImage(faces);
+    }
+    else TRACELOG(LOG_WARNING, "IMAGE: Failed to detect cubemap image layout");
+
+    return cubemap;
+}
+
+// Load texture for rendering (framebuffer)
+// NOTE: Render texture is loaded by default with RGBA color attachment and depth RenderBuffer
+RenderTexture2D LoadRenderTexture(int width, int height)
+{
+    RenderTexture2D target = { 0 };
+
+    target.id = rlLoadFramebuffer(width, height);   // Load an empty framebuffer
+
+    if (target.id > 0)
+    {
+        rlEnableFramebuffer(target.id);
+
+        // Create color texture (default to RGBA)
+        target.texture.id = rlLoadTexture(NULL, width, height, UNCOMPRESSED_R8G8B8A8, 1);
+        target.texture.width = width;
+        target.texture.height = height;
+        target.texture.format = UNCOMPRESSED_R8G8B8A8;
+        target.texture.mipmaps = 1;
+
+        // Create depth renderbuffer/texture
+        target.depth.id = rlLoadTextureDepth(width, height, true);
+        target.depth.width = width;
+        target.depth.height = height;
+        target.depth.format = 19;       //DEPTH_COMPONENT_24BIT?
+        target.depth.mipmaps = 1;
+
+        // Attach color texture and depth renderbuffer/texture to FBO
+        rlFramebufferAttach(target.id, target.texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D);
+        rlFramebufferAttach(target.id, target.depth.id, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER);
+
+        // Check if fbo is complete with attachments (valid)
+        if (rlFramebufferComplete(target.id)) TRACELOG(LOG_INFO, "FBO: [ID %i] Framebuffer object created successfully", target.id);
+
+        rlDisableFramebuffer();
+    }
+    else TRACELOG(LOG_WARNING, "FBO: Framebuffer object can not be created");
+
+    return target;
+}
+
+// Unload texture from GPU memory (VRAM)
+void UnloadTexture(Texture2D texture)
+{
+    if (texture.id > 0)
+    {
+        rlUnloadTexture(texture.id);
+
+        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Unloaded texture data from VRAM (GPU)", texture.id);
+    }
+}
+
+// Unload render texture from GPU memory (VRAM)
+void UnloadRenderTexture(RenderTexture2D target)
+{
+    if (target.id > 0)
+    {
+        // Color texture attached to FBO is deleted
+        rlUnloadTexture(target.texture.id);
+
+        // NOTE: Depth texture/renderbuffer is automatically
+        // queried and deleted before deleting framebuffer
+        rlUnloadFramebuffer(target.id);
+    }
+}
+
+// Update GPU texture with new data
+// NOTE: pixels data must match texture.format
+void UpdateTexture(Texture2D texture, const void *pixels)
+{
+    rlUpdateTexture(texture.id, 0, 0, texture.width, texture.height, texture.format, pixels);
+}
+
+// Update GPU texture rectangle with new data
+// NOTE: pixels data must match texture.format
+void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels)
+{
+    rlUpdateTexture(texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, texture.format, pixels);
+}
+
+// Get pixel data from GPU texture and return an Image
+// NOTE: Compressed texture formats not supported
+Image GetTextureData(Texture2D texture)
+{
+    Image image = { 0 };
+
+    if (texture.format < COMPRESSED_DXT1_RGB)
+    {
+        image.data = rlReadTexturePixels(texture);
+
+        if (image.data != NULL)
+        {
+            image.width = texture.width;
+            image.height = texture.height;
+            image.format = texture.format;
+            image.mipmaps = 1;
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+            // NOTE: Data retrieved on OpenGL ES 2.0 should be RGBA,
+            // coming from FBO color buffer attachment, but it seems
+            // original texture format is retrieved on RPI...
+            image.format = UNCOMPRESSED_R8G8B8A8;
+#endif
+            TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Pixel data retrieved successfully", texture.id);
+        }
+        else TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to retrieve pixel data", texture.id);
+    }
+    else TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to retrieve compressed pixel data", texture.id);
+
+    return image;
+}
+
+// Get pixel data from GPU frontbuffer and return an Image (screenshot)
+Image GetScreenData(void)
+{
+    Image image = { 0 };
+
+    image.width = GetScreenWidth();
+    image.height = GetScreenHeight();
+    image.mipmaps = 1;
+    image.format = UNCOMPRESSED_R8G8B8A8;
+    image.data = rlReadScreenPixels(image.width, image.height);
+
+    return image;
+}
+
+// Get pixel data from GPU texture asynchronously, image is provided to callback some frames later
+// NOTE: Callback owns image (must be unloaded), image data is NULL on failure. Images are provided
+// in requests order, on BeginDrawing() or on CloseWindow() for pending requests
+void GetTextureDataAsync(Texture2D texture, ImageReadCallback callback, void *userData)
+{
+    TextureReadback *readback = (TextureReadback *)RL_CALLOC(1, sizeof(TextureReadback));
+
+    readback->image.width = texture.width;
+    readback->image.height = texture.height;
+    readback->image.mipmaps = 1;
+    readback->image.format = texture.format;
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    readback->image.format = UNCOMPRESSED_R8G8B8A8;     // Data read from FBO color buffer attachment
+#endif
+    readback->callback = callback;
+    readback->userData = userData;
+    readback->readback = rlReadTexturePixelsAsync(texture);
+
+    if (readback->readback == 0)
+    {
+        // Readback not available, data retrieved synchronously
+        readback->image = GetTextureData(texture);
+        readback->state = READBACK_DONE;
+    }
+
+    QueueTextureReadback(readback);
+}
+
+// Get pixel data from GPU framebuffer asynchronously, image is provided to callback some frames later
+// NOTE: Lines flip and alpha reset are processed on async workers
+void GetScreenDataAsync(ImageReadCallback callback, void *userData)
+{
+    ReadScreenDataAsync(GetScreenWidth(), GetScreenHeight(), callback, userData);
+}
+
+//------------------------------------------------------------------------------------
+// Texture configuration functions
+//------------------------------------------------------------------------------------
+// Generate GPU mipmaps for a texture
+void GenTextureMipmaps(Texture2D *texture)
+{
+    // NOTE: NPOT textures support check inside function
+    // On WebGL (OpenGL ES 2.0) NPOT textures support is limited
+    rlGenerateMipmaps(texture);
+}
+
+// Set texture scaling filter mode
+void SetTextureFilter(Texture2D texture, int filterMode)
+{
+    switch (filterMode)
+    {
+        case FILTER_POINT:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_FILTER_MIP_NEAREST - tex filter: POINT, mipmaps filter: POINT (sharp switching between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_MIP_NEAREST);
+
+                // RL_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_NEAREST);
+            }
+            else
+            {
+                // RL_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_NEAREST);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_NEAREST);
+            }
+        } break;
+        case FILTER_BILINEAR:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_FILTER_LINEAR_MIP_NEAREST - tex filter: BILINEAR, mipmaps filter: POINT (sharp switching between mipmaps)
+                // Alternative: RL_FILTER_NEAREST_MIP_LINEAR - tex filter: POINT, mipmaps filter: BILINEAR (smooth transition between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_LINEAR_MIP_NEAREST);
+
+                // RL_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_LINEAR);
+            }
+            else
+            {
+                // RL_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_LINEAR);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_LINEAR);
+            }
+        } break;
+        case FILTER_TRILINEAR:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_FILTER_MIP_LINEAR - tex filter: BILINEAR, mipmaps filter: BILINEAR (smooth transition between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_MIP_LINEAR);
+
+                // RL_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_LINEAR);
+            }
+            else
+            {
+                TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] No mipmaps available for TRILINEAR texture filtering", texture.id);
+
+                // RL_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_LINEAR);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_LINEAR);
+            }
+        } break;
+        case FILTER_ANISOTROPIC_4X: rlTextureParameters(texture.id, RL_TEXTURE_ANISOTROPIC_FILTER, 4); break;
+        case FILTER_ANISOTROPIC_8X: rlTextureParameters(texture.id, RL_TEXTURE_ANISOTROPIC_FILTER, 8); break;
+        case FILTER_ANISOTROPIC_16X: rlTextureParameters(texture.id, RL_TEXTURE_ANISOTROPIC_FILTER, 16); break;
+        default: break;
+    }
+}
+
+// Set texture wrapping mode
+void SetTextureWrap(Texture2D texture, int wrapMode)
+{
+    switch (wrapMode)
+    {
+        case WRAP_REPEAT:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_WRAP_REPEAT);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_WRAP_REPEAT);
+        } break;
+        case WRAP_CLAMP:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_WRAP_CLAMP);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_WRAP_CLAMP);
+        } break;
+        case WRAP_MIRROR_REPEAT:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_WRAP_MIRROR_REPEAT);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_WRAP_MIRROR_REPEAT);
+        } break;
+        case WRAP_MIRROR_CLAMP:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_WRAP_MIRROR_CLAMP);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_WRAP_MIRROR_CLAMP);
+        } break;
+        default: break;
+    }
+}
+
+// Set per-frame async textures upload budget, time in milliseconds and data in bytes (0 means unlimited)
+// NOTE: At least one upload step is processed every frame, uncompressed textures
+// bigger than data budget are uploaded in rows bands along multiple frames
+void SetTextureUploadBudget(float milliseconds, int bytes)
+{
+    textureUploadBudgetTime = (milliseconds > 0.0f)? milliseconds : 0.0f;
+    textureUploadBudgetBytes = (bytes > 0)? bytes : 0;
+}
+
+//------------------------------------------------------------------------------------
+// Texture drawing functions
+//------------------------------------------------------------------------------------
+// Draw a Texture2D
+void DrawTexture(Texture2D texture, int posX, int posY, Color tint)
+{
+    DrawTextureEx(texture, (Vector2){ (float)posX, (float)posY }, 0.0f, 1.0f, tint);
+}
+
+// Draw a Texture2D with position defined as Vector2
+void DrawTextureV(Texture2D texture, Vector2 position, Color tint)
+{
+    DrawTextureEx(texture, position, 0, 1.0f, tint);
+}
+
+// Draw a Texture2D with extended parameters
+void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)
+{
+    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+    Rectangle dest = { position.x, position.y, (float)texture.width*scale, (float)texture.height*scale };
+    Vector2 origin = { 0.0f, 0.0f };
+
+    DrawTexturePro(texture, source, dest, origin, rotation, tint);
+}
+
+// Draw a part of a texture (defined by a rectangle)
+void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint)
+{
+    Rectangle dest = { position.x, position.y, fabsf(source.width), fabsf(source.height) };
+    Vector2 origin = { 0.0f, 0.0f };
+
+    DrawTexturePro(texture, source, dest, origin, 0.0f, tint);
+}
+
+// Draw texture quad with tiling and offset parameters
+// NOTE: Tiling and offset should be provided considering normalized texture values [0..1]
+// i.e tiling = { 1.0f, 1.0f } refers to all texture, offset = { 0.5f, 0.5f } moves texture origin to center
+void DrawTextureQuad(Texture2D texture, Vector2 tiling, Vector2 offset, Rectangle quad, Color tint)
+{
+    Rectangle source = { offset.x*texture.width, offset.y*texture.height, tiling.x*texture.width, tiling.y*texture.height };
+    Vector2 origin = { 0.0f, 0.0f };
+
+    DrawTexturePro(texture, source, quad, origin, 0.0f, tint);
+}
+
+// Draw part of a texture (defined by a rectangle) with rotation and scale tiled into dest.
+// NOTE: For tilling a whole texture DrawTextureQuad() is better
+void DrawTextureTiled(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, float scale, Color tint)
+{
+    if (texture.id <= 0 || scale <= 0.0f) return;  // Wanna see a infinite loop?!...just delete this line!
+
+    int tileWidth = (int)(source.width*scale), tileHeight = (int)(source.height*scale);
+    if (dest.width < tileWidth && dest.height < tileHeight)
+    {
+        // Can fit only one tile
+        DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)dest.width/tileWidth)*source.width, ((float)dest.height/tileHeight)*source.height},
+                    (Rectangle){dest.x, dest.y, dest.width, dest.height}, origin, rotation, tint);
+    }
+    else if (dest.width <= tileWidth)
+    {
+        // Tiled vertically (one column)
+        int dy = 0;
+        for (;dy+tileHeight < dest.height; dy += tileHeight)
+        {
+            DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)dest.width/tileWidth)*source.width, source.height}, (Rectangle){dest.x, dest.y + dy, dest.width, (float)tileHeight}, origin, rotation, tint);
+        }
+
+        // Fit last tile
+        if (dy < dest.height)
+        {
+            DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)dest.width/tileWidth)*source.width, ((float)(dest.height - dy)/tileHeight)*source.height},
+                        (Rectangle){dest.x, dest.y + dy, dest.width, dest.height - dy}, origin, rotation, tint);
+        }
+    }
+    else if (dest.height <= tileHeight)
+    {
+        // Tiled horizontally (one row)
+        int dx = 0;
+        for (;dx+tileWidth < dest.width; dx += tileWidth)
+        {
+            DrawTexturePro(texture, (Rectangle){source.x, source.y, source.width, ((float)dest.height/tileHeight)*source.height}, (Rectangle){dest.x + dx, dest.y, (float)tileWidth, dest.height}, origin, rotation, tint);
+        }
+
+        // Fit last tile
+        if (dx < dest.width)
+        {
+            DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)(dest.width - dx)/tileWidth)*source.width, ((float)dest.height/tileHeight)*source.height},
+                        (Rectangle){dest.x + dx, dest.y, dest.width - dx, dest.height}, origin, rotation, tint);
+        }
+    }
+    else
+    {
+        // Tiled both horizontally and vertically (rows and columns)
+        int dx = 0;
+        for (;dx+tileWidth < dest.width; dx += tileWidth)
+        {
+            int dy = 0;
+            for (;dy+tileHeight < dest.height; dy += tileHeight)
+            {
+                DrawTexturePro(texture, source, (Rectangle){dest.x + dx, dest.y + dy, (float)tileWidth, (float)tileHeight}, origin, rotation, tint);
+            }
+
+            if (dy < dest.height)
+            {
+                DrawTexturePro(texture, (Rectangle){source.x, source.y, source.width, ((float)(dest.height - dy)/tileHeight)*source.height},
+                    (Rectangle){dest.x + dx, dest.y + dy, (float)tileWidth, dest.height - dy}, origin, rotation, tint);
+            }
+        }
+
+        // Fit last column of tiles
+        if (dx < dest.width)
+        {
+            int dy = 0;
+            for (;dy+tileHeight < dest.height; dy += tileHeight)
+            {
+                DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)(dest.width - dx)/tileWidth)*source.width, source.height},
+                        (Rectangle){dest.x + dx, dest.y + dy, dest.width - dx, (float)tileHeight}, origin, rotation, tint);
+            }
+
+            // Draw final tile in the bottom right corner
+            if (dy < dest.height)
+            {
+                DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)(dest.width - dx)/tileWidth)*source.width, ((float)(dest.height - dy)/tileHeight)*source.height},
+                    (Rectangle){dest.x + dx, dest.y + dy, dest.width - dx, dest.height - dy}, origin, rotation, tint);
+            }
+        }
+    }
+}
+
+// Draw a part of a texture (defined by a rectangle) with 'pro' parameters
+// NOTE: origin is relative to destination rectangle size
+void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    // Check if texture is valid
+    if (texture.id > 0)
+    {
+        float width = (float)texture.width;
+        float height = (float)texture.height;
+
+        bool flipX = false;
+
+        if (source.width < 0) { flipX = true; source.width *= -1; }
+        if (source.height < 0) source.y -= source.height;
+
+        rlEnableTexture(texture.id);
+
+        rlPushMatrix();
+            rlTranslatef(dest.x, dest.y, 0.0f);
+            rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+            rlTranslatef(-origin.x, -origin.y, 0.0f);
+
+            rlBegin(RL_QUADS);
+                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+                // Bottom-left corner for texture and quad
+                if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
+                else rlTexCoord2f(source.x/width, source.y/height);
+                rlVertex2f(0.0f, 0.0f);
+
+                // Bottom-right corner for texture and quad
+                if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+                else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+                rlVertex2f(0.0f, dest.height);
+
+                // Top-right corner for texture and quad
+                if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+                else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+                rlVertex2f(dest.width, dest.height);
+
+                // Top-left corner for texture and quad
+                if (flipX) rlTexCoord2f(source.x/width, source.y/height);
+                else rlTexCoord2f((source.x + source.width)/width, source.y/height);
+                rlVertex2f(dest.width, 0.0f);
+            rlEnd();
+        rlPopMatrix();
+
+        rlDisableTexture();
+    }
+}
+
+// Draws a texture (or part of it) that stretches or shrinks nicely using n-patch info
+void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    if (texture.id > 0)
+    {
+        float width = (float)texture.width;
+        float height = (float)texture.height;
+
+        float patchWidth = (dest.width <= 0.0f)? 0.0f : dest.width;
+        float patchHeight = (dest.height <= 0.0f)? 0.0f : dest.height;
+
+        if (nPatchInfo.source.width < 0) nPatchInfo.source.x -= nPatchInfo.source.width;
+        if (nPatchInfo.source.height < 0) nPatchInfo.source.y -= nPatchInfo.source.height;
+        if (nPatchInfo.type == NPT_3PATCH_HORIZONTAL) patchHeight = nPatchInfo.source.height;
+        if (nPatchInfo.type == NPT_3PATCH_VERTICAL) patchWidth = nPatchInfo.source.width;
+
+        bool drawCenter = true;
+        bool drawMiddle = true;
+        float leftBorder = (float)nPatchInfo.left;
+        float topBorder = (float)nPatchInfo.top;
+        float rightBorder = (float)nPatchInfo.right;
+        float bottomBorder = (float)nPatchInfo.bottom;
+
+        // adjust the lateral (left and right) border widths in case patchWidth < texture.width
+        if (patchWidth <= (leftBorder + rightBorder) && nPatchInfo.type != NPT_3PATCH_VERTICAL)
+        {
+            drawCenter = false;
+            leftBorder = (leftBorder/(leftBorder + rightBorder))*patchWidth;
+            rightBorder = patchWidth - leftBorder;
+        }
+        // adjust the lateral (top and bottom) border heights in case patchHeight < texture.height
+        if (patchHeight <= (topBorder + bottomBorder) && nPatchInfo.type != NPT_3PATCH_HORIZONTAL)
+        {
+            drawMiddle = false;
+            topBorder = (topBorder/(topBorder + bottomBorder))*patchHeight;
+            bottomBorder = patchHeight - topBorder;
+        }
+
+        Vector2 vertA, vertB, vertC, vertD;
+        vertA.x = 0.0f;                             // outer left
+        vertA.y = 0.0f;                             // outer top
+        vertB.x = leftBorder;                       // inner left
+        vertB.y = topBorder;                        // inner top
+        vertC.x = patchWidth  - rightBorder;        // inner right
+        vertC.y = patchHeight - bottomBorder;       // inner bottom
+        vertD.x = patchWidth;                       // outer right
+        vertD.y = patchHeight;                      // outer bottom
+
+        Vector2 coordA, coordB, coordC, coordD;
+        coordA.x = nPatchInfo.source.x/width;
+        coordA.y = nPatchInfo.source.y/height;
+        coordB.x = (nPatchInfo.source.x + leftBorder)/width;
+        coordB.y = (nPatchInfo.source.y + topBorder)/height;
+        coordC.x = (nPatchInfo.source.x + nPatchInfo.source.width  - rightBorder)/width;
+        coordC.y = (nPatchInfo.source.y + nPatchInfo.source.height - bottomBorder)/height;
+        coordD.x = (nPatchInfo.source.x + nPatchInfo.source.width)/width;
+        coordD.y = (nPatchInfo.source.y + nPatchInfo.source.height)/height;
+
+        rlEnableTexture(texture.id);
+
+        rlPushMatrix();
+            rlTranslatef(dest.x, dest.y, 0.0f);
+            rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+            rlTranslatef(-origin.x, -origin.y, 0.0f);
+
+            rlBegin(RL_QUADS);
+                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                rlNormal3f(0.0f, 0.0f, 1.0f);               // Normal vector pointing towards viewer
+
+                if (nPatchInfo.type == NPT_9PATCH)
+                {
+                    // ------------------------------------------------------------
+                    // TOP-LEFT QUAD
+                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // TOP-CENTER QUAD
+                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
+                    }
+                    // TOP-RIGHT QUAD
+                    rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawMiddle)
+                    {
+                        // ------------------------------------------------------------
+                        // MIDDLE-LEFT QUAD
+                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
+                        if (drawCenter)
+                        {
+                            // MIDDLE-CENTER QUAD
+                            rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-left corner for texture and quad
+                            rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-right corner for texture and quad
+                            rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-right corner for texture and quad
+                            rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-left corner for texture and quad
+                        }
+
+                        // MIDDLE-RIGHT QUAD
+                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-left corner for texture and quad
+                    }
+
+                    // ------------------------------------------------------------
+                    // BOTTOM-LEFT QUAD
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // BOTTOM-CENTER QUAD
+                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-left corner for texture and quad
+                    }
+
+                    // BOTTOM-RIGHT QUAD
+                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-left corner for texture and quad
+                }
+                else if (nPatchInfo.type == NPT_3PATCH_VERTICAL)
+                {
+                    // TOP QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // MIDDLE QUAD
+                        // -----------------------------------------------------------
+                        // Texture coords                 Vertices
+                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
+                    }
+                    // BOTTOM QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
+                }
+                else if (nPatchInfo.type == NPT_3PATCH_HORIZONTAL)
+                {
+                    // LEFT QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // CENTER QUAD
+                        // -----------------------------------------------------------
+                        // Texture coords                 Vertices
+                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
+                    }
+                    // RIGHT QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
+                }
+            rlEnd();
+        rlPopMatrix();
+
+        rlDisableTexture();
+    }
+}
+
+// Returns color with alpha applied, alpha goes from 0.0f to 1.0f
+Color Fade(Color color, float alpha)
+{
+    if (alpha < 0.0f) alpha = 0.0f;
+    else if (alpha > 1.0f) alpha = 1.0f;
+
+    return (Color){color.r, color.g, color.b, (unsigned char)(255.0f*alpha)};
+}
+
+// Returns hexadecimal value for a Color
+int ColorToInt(Color color)
+{
+    return (((int)color.r << 24) | ((int)color.g << 16) | ((int)color.b << 8) | (int)color.a);
+}
+
+// Returns color normalized as float [0..1]
+Vector4 ColorNormalize(Color color)
+{
+    Vector4 result;
+
+    result.x = (float)color.r/255.0f;
+    result.y = (float)color.g/255.0f;
+    result.z = (float)color.b/255.0f;
+    result.w = (float)color.a/255.0f;
+
+    return result;
+}
+
+// Returns color from normalized values [0..1]
+Color ColorFromNormalized(Vector4 normalized)
+{
+    Color result;
+
+    result.r = (unsigned char)(normalized.x*255.0f);
+    result.g = (unsigned char)(normalized.y*255.0f);
+    result.b = (unsigned char)(normalized.z*255.0f);
+    result.a = (unsigned char)(normalized.w*255.0f);
+
+    return result;
+}
+
+// Returns HSV values for a Color
+// NOTE: Hue is returned as degrees [0..360]
+Vector3 ColorToHSV(Color color)
+{
+    Vector3 hsv = { 0 };
+    Vector3 rgb = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+    float min, max, delta;
+
+    min = rgb.x < rgb.y? rgb.x : rgb.y;
+    min = min  < rgb.z? min  : rgb.z;
+
+    max = rgb.x > rgb.y? rgb.x : rgb.y;
+    max = max  > rgb.z? max  : rgb.z;
+
+    hsv.z = max;            // Value
+    delta = max - min;
+
+    if (delta < 0.00001f)
+    {
+        hsv.y = 0.0f;
+        hsv.x = 0.0f;       // Undefined, maybe NAN?
+        return hsv;
+    }
+
+    if (max > 0.0f)
+    {
+        // NOTE: If max is 0, this divide would cause a crash
+        hsv.y = (delta/max);    // Saturation
+    }
+    else
+    {
+        // NOTE: If max is 0, then r = g = b = 0, s = 0, h is undefined
+        hsv.y = 0.0f;
+        hsv.x = NAN;        // Undefined
+        return hsv;
+    }
+
+    // NOTE: Comparing float values could not work properly
+    if (rgb.x >= max) hsv.x = (rgb.y - rgb.z)/delta;    // Between yellow & magenta
+    else
+    {
+        if (rgb.y >= max) hsv.x = 2.0f + (rgb.z - rgb.x)/delta;  // Between cyan & yellow
+        else hsv.x = 4.0f + (rgb.x - rgb.y)/delta;      // Between magenta & cyan
+    }
+
+    hsv.x *= 60.0f;     // Convert to degrees
+
+    if (hsv.x < 0.0f) hsv.x += 360.0f;
+
+    return hsv;
+}
+
+// Returns a Color from HSV values
+// Implementation reference: https://en.wikipedia.org/wiki/HSL_and_HSV#Alternative_HSV_conversion
+// NOTE: Color->HSV->Color conversion will not yield exactly the same color due to rounding errors
+// Hue is provided in degrees: [0..360]
+// Saturation/Value are provided normalized: [0.0f..1.0f]
+Color ColorFromHSV(float hue, float saturation, float value)
+{
+    Color color = { 0, 0, 0, 255 };
+
+    // Red channel
+    float k = fmodf((5.0f + hue/60.0f), 6);
+    float t = 4.0f - k;
+    k = (t < k)? t : k;
+    k = (k < 1)? k : 1;
+    k = (k > 0)? k : 0;
+    color.r = (unsigned char)((value - value*saturation*k)*255.0f);
+
+    // Green channel
+    k = fmodf((3.0f + hue/60.0f), 6);
+    t = 4.0f - k;
+    k = (t < k)? t : k;
+    k = (k < 1)? k : 1;
+    k = (k > 0)? k : 0;
+    color.g = (unsigned char)((value - value*saturation*k)*255.0f);
+
+    // Blue channel
+    k = fmodf((1.0f + hue/60.0f), 6);
+    t = 4.0f - k;
+    k = (t < k)? t : k;
+    k = (k < 1)? k : 1;
+    k = (k > 0)? k : 0;
+    color.b = (unsigned char)((value - value*saturation*k)*255.0f);
+
+    return color;
+}
+
+// Returns color with alpha applied, alpha goes from 0.0f to 1.0f
+Color ColorAlpha(Color color, float alpha)
+{
+    if (alpha < 0.0f) alpha = 0.0f;
+    else if (alpha > 1.0f) alpha = 1.0f;
+
+    return (Color){color.r, color.g, color.b, (unsigned char)(255.0f*alpha)};
+}
+
+// Returns src alpha-blended into dst color with tint
+Color ColorAlphaBlend(Color dst, Color src, Color tint)
+{
+    Color out = WHITE;
+
+    // Apply color tint to source color
+    src.r = (unsigned char)(((unsigned int)src.r*(unsigned int)tint.r) >> 8);
+    src.g = (unsigned char)(((unsigned int)src.g*(unsigned int)tint.g) >> 8);
+    src.b = (unsigned char)(((unsigned int)src.b*(unsigned int)tint.b) >> 8);
+    src.a = (unsigned char)(((unsigned int)src.a*(unsigned int)tint.a) >> 8);
+
+//#define COLORALPHABLEND_FLOAT
+#define COLORALPHABLEND_INTEGERS
+#if defined(COLORALPHABLEND_INTEGERS)
+    if (src.a == 0) out = dst;
+    else if (src.a == 255) out = src;
+    else
+    {
+        unsigned int alpha = (unsigned int)src.a + 1;     // We are shifting by 8 (dividing by 256), so we need to take that excess into account
+        out.a = (unsigned char)(((unsigned int)alpha*256 + (unsigned int)dst.a*(256 - alpha)) >> 8);
+
+        if (out.a > 0)
+        {
+            out.r = (unsigned char)((((unsigned int)src.r*alpha*256 + (unsigned int)dst.r*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+            out.g = (unsigned char)((((unsigned int)src.g*alpha*256 + (unsigned int)dst.g*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+            out.b = (unsigned char)((((unsigned int)src.b*alpha*256 + (unsigned int)dst.b*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+        }
+    }
+#endif
+#if defined(COLORALPHABLEND_FLOAT)
+    if (src.a == 0) out = dst;
+    else if (src.a == 255) out = src;
+    else
+    {
+        Vector4 fdst = ColorNormalize(dst);
+        Vector4 fsrc = ColorNormalize(src);
+        Vector4 ftint = ColorNormalize(tint);
+        Vector4 fout = { 0 };
+
+        fout.w = fsrc.w + fdst.w*(1.0f - fsrc.w);
+
+        if (fout.w > 0.0f)
+        {
+            fout.x = (fsrc.x*fsrc.w + fdst.x*fdst.w*(1 - fsrc.w))/fout.w;
+            fout.y = (fsrc.y*fsrc.w + fdst.y*fdst.w*(1 - fsrc.w))/fout.w;
+            fout.z = (fsrc.z*fsrc.w + fdst.z*fdst.w*(1 - fsrc.w))/fout.w;
+        }
+
+        out = (Color){ (unsigned char)(fout.x*255.0f), (unsigned char)(fout.y*255.0f), (unsigned char)(fout.z*255.0f), (unsigned char)(fout.w*255.0f) };
+    }
+#endif
+
+    return out;
+}
+
+// Returns a Color struct from hexadecimal value
+Color GetColor(int hexValue)
+{
+    Color color;
+
+    color.r = (unsigned char)(hexValue >> 24) & 0xFF;
+    color.g = (unsigned char)(hexValue >> 16) & 0xFF;
+    color.b = (unsigned char)(hexValue >> 8) & 0xFF;
+    color.a = (unsigned char)hexValue & 0xFF;
+
+    return color;
+}
+
+// Get color from a pixel from certain format
+Color GetPixelColor(void *srcPtr, int format)
+{
+    Color col = { 0 };
+
+    switch (format)
+    {
+        case UNCOMPRESSED_GRAYSCALE: col = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], 255 }; break;
+        case UNCOMPRESSED_GRAY_ALPHA: col = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1] }; break;
+        case UNCOMPRESSED_R5G6B5:
+        {
+            col.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
+            col.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 5) & 0b0000000000111111)*255/63);
+            col.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
+            col.a = 255;
+
+        } break;
+        case UNCOMPRESSED_R5G5B5A1:
+        {
+            col.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
+            col.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 6) & 0b0000000000011111)*255/31);
+            col.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
+            col.a = (((unsigned short *)srcPtr)[0] & 0b0000000000000001)? 255 : 0;
+
+        } break;
+        case UNCOMPRESSED_R4G4B4A4:
+        {
+            col.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 12)*255/15);
+            col.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 8) & 0b0000000000001111)*255/15);
+            col.b = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 4) & 0b0000000000001111)*255/15);
+            col.a = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000001111)*255/15);
+
+        } break;
+        case UNCOMPRESSED_R8G8B8A8: col = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], ((unsigned char *)srcPtr)[3] }; break;
+        case UNCOMPRESSED_R8G8B8: col = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], 255 }; break;
+        // TODO: case UNCOMPRESSED_R32: break;
+        // TODO: case UNCOMPRESSED_R32G32B32: break;
+        // TODO: case UNCOMPRESSED_R32G32B32A32: break;
+        default: break;
+    }
+
+    return col;
+}
+
+// Set pixel color formatted into destination pointer
+void SetPixelColor(void *dstPtr, Color color, int format)
+{
+    switch (format)
+    {
+        case UNCOMPRESSED_GRAYSCALE:
+        {
+            // NOTE: Calculate grayscale equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+
+            ((unsigned char *)dstPtr)[0] = gray;
+
+        } break;
+        case UNCOMPRESSED_GRAY_ALPHA:
+        {
+            // NOTE: Calculate grayscale equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+
+            ((unsigned char *)dstPtr)[0] = gray;
+            ((unsigned char *)dstPtr)[1] = color.a;
+
+        } break;
+        case UNCOMPRESSED_R5G6B5:
+        {
+            // NOTE: Calculate R5G6B5 equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+            unsigned char r = (unsigned char)(round(coln.x*31.0f));
+            unsigned char g = (unsigned char)(round(coln.y*63.0f));
+            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+
+            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+
+        } break;
+        case UNCOMPRESSED_R5G5B5A1:
+        {
+            // NOTE: Calculate R5G5B5A1 equivalent color
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+            unsigned char r = (unsigned char)(round(coln.x*31.0f));
+            unsigned char g = (unsigned char)(round(coln.y*31.0f));
+            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+            unsigned char a = (coln.w > ((float)UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;;
+
+            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+
+        } break;
+        case UNCOMPRESSED_R4G4B4A4:
+        {
+            // NOTE: Calculate R5G5B5A1 equivalent color
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+            unsigned char r = (unsigned char)(round(coln.x*15.0f));
+            unsigned char g = (unsigned char)(round(coln.y*15.0f));
+            unsigned char b = (unsigned char)(round(coln.z*15.0f));
+            unsigned char a = (unsigned char)(round(coln.w*15.0f));
+
+            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+
+        } break;
+        case UNCOMPRESSED_R8G8B8:
+        {
+            ((unsigned char *)dstPtr)[0] = color.r;
+            ((unsigned char *)dstPtr)[1] = color.g;
+            ((unsigned char *)dstPtr)[2] = color.b;
+
+        } break;
+        case UNCOMPRESSED_R8G8B8A8:
+        {
+            ((unsigned char *)dstPtr)[0] = color.r;
+            ((unsigned char *)dstPtr)[1] = color.g;
+            ((unsigned char *)dstPtr)[2] = color.b;
+            ((unsigned char *)dstPtr)[3] = color.a;
+
+        } break;
+        default: break;
+    }
+}
+
+// Get pixel data size in bytes for certain format
+// NOTE: Size can be requested for Image or Texture data
+int GetPixelDataSize(int width, int height, int format)
+{
+    int dataSize = 0;       // Size in bytes
+    int bpp = 0;            // Bits per pixel
+
+    switch (format)
+    {
+        case UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
+        case UNCOMPRESSED_GRAY_ALPHA:
+        case UNCOMPRESSED_R5G6B5:
+        case UNCOMPRESSED_R5G5B5A1:
+        case UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
+        case UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
+        case UNCOMPRESSED_R8G8B8: bpp = 24; break;
+        case UNCOMPRESSED_R32: bpp = 32; break;
+        case UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
+        case UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
+        case COMPRESSED_DXT1_RGB:
+        case COMPRESSED_DXT1_RGBA:
+        case COMPRESSED_ETC1_RGB:
+        case COMPRESSED_ETC2_RGB:
+        case COMPRESSED_PVRT_RGB:
+        case COMPRESSED_PVRT_RGBA: bpp = 4; break;
+        case COMPRESSED_DXT3_RGBA:
+        case COMPRESSED_DXT5_RGBA:
+        case COMPRESSED_ETC2_EAC_RGBA:
+        case COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
+        case COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
+        default: break;
+    }
+
+    dataSize = width*height*bpp/8;  // Total data size in bytes
+
+    // Most compressed formats works on 4x4 blocks, data size is rounded up to full blocks
+    if (((format >= COMPRESSED_DXT1_RGB) && (format <= COMPRESSED_ETC2_EAC_RGBA)) || (format == COMPRESSED_ASTC_4x4_RGBA))
+    {
+        dataSize = ((width + 3)/4)*((height + 3)/4)*bpp*2;     // Block size in bytes: 4*4*bpp/8
+    }
+    else if ((width < 4) && (height < 4))
+    {
+        // PVRT: if texture is smaller, minimum dataSize is 16
+        if ((format == COMPRESSED_PVRT_RGB) || (format == COMPRESSED_PVRT_RGBA)) dataSize = 16;
+    }
+
+    return dataSize;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+#if defined(SUPPORT_FILEFORMAT_GIF)
+// Scan GIF file blocks to get frames count and frames delays (milliseconds), image data is not decoded
+// NOTE: Truncated frames at the end of file are not counted
+static int ScanGIFFrames(const unsigned char *fileData, unsigned int fileSize, int **delays)
+{
+    int count = 0;
+    int capacity = 0;
+    int delay = 0;
+
+    *delays = NULL;
+
+    if ((fileSize < 13) || (memcmp(fileData, "GIF", 3) != 0)) return 0;
+
+    unsigned int pos = 13;
+    if (fileData[10] & 0x80) pos += 3*(2 << (fileData[10] & 0x07));     // Global color table
+
+    while (pos < fileSize)
+    {
+        unsigned char block = fileData[pos++];
+
+        if ((block == 0x21) && (pos < fileSize))        // Extension block
+        {
+            unsigned char label = fileData[pos++];
+
+            // Graphic control extension: frame delay in centiseconds
+            if ((label == 0xf9) && ((pos + 4) < fileSize) && (fileData[pos] == 4)) delay = fileData[pos + 2] | (fileData[pos + 3] << 8);
+
+            while ((pos < fileSize) && (fileData[pos] != 0)) pos += fileData[pos] + 1;
+            pos++;
+        }
+        else if ((block == 0x2c) && ((pos + 9) < fileSize))     // Image descriptor
+        {
+            unsigned char flags = fileData[pos + 8];
+
+            pos += 9;
+            if (flags & 0x80) pos += 3*(2 << (flags & 0x07));   // Local color table
+            pos++;                                              // LZW minimum code size
+
+            while ((pos < fileSize) && (fileData[pos] != 0)) pos += fileData[pos] + 1;
+            pos++;
+
+            if (pos > fileSize) break;
+
+            if (count == capacity)
+            {
+                capacity = (capacity == 0)? 64 : capacity*2;
+                *delays = (int *)RL_REALLOC(*delays, capacity*sizeof(int));
+            }
+
+            // NOTE: Delays lower than 20 ms are shown as 100 ms (browsers behaviour)
+            (*delays)[count] = (delay < 2)? 100 : delay*10;
+            delay = 0;
+            count++;
+        }
+        else break;     // Trailer block (0x3b) or not valid data
+    }
+
+    return count;
 }
 
-// Returns color with alpha applied, alpha goes from 0.0f to 1.0f
-Color Fade(Color color, float alpha)
+// Reset image stream GIF decoder to file start
+static void ResetImageStreamDecoder(ImageStreamData *data)
 {
-    if (alpha < 0.0f) alpha = 0.0f;
-    else if (alpha > 1.0f) alpha = 1.0f;
+    RL_FREE(data->gif.out);
+    RL_FREE(data->gif.background);
+    RL_FREE(data->gif.history);
 
-    return (Color){color.r, color.g, color.b, (unsigned char)(255.0f*alpha)};
+    memset(&data->gif, 0, sizeof(stbi__gif));
+    stbi__start_mem(&data->context, data->fileData, (int)data->fileSize);
+    data->decodedFrames = 0;
 }
 
-// Returns hexadecimal value for a Color
-int ColorToInt(Color color)
+// Decode image stream frame into output pixels (RGBA), decoder restarts if frame is behind decoder position
+// NOTE: Disposal method "restore to previous" requires the frame two back, last two frames are kept
+static bool DecodeImageStreamFrame(ImageStreamData *data, int frame, unsigned char *output)
 {
-    return (((int)color.r << 24) | ((int)color.g << 16) | ((int)color.b << 8) | (int)color.a);
-}
+    int size = data->width*data->height*4;
 
-// Returns color normalized as float [0..1]
-Vector4 ColorNormalize(Color color)
-{
-    Vector4 result;
+    if (frame < (data->decodedFrames - 1)) ResetImageStreamDecoder(data);
 
-    result.x = (float)color.r/255.0f;
-    result.y = (float)color.g/255.0f;
-    result.z = (float)color.b/255.0f;
-    result.w = (float)color.a/255.0f;
+    while (data->decodedFrames <= frame)
+    {
+        int comp = 0;
+        unsigned char *twoBack = (data->decodedFrames >= 2)? data->history[data->decodedFrames%2] : NULL;
+        unsigned char *pixels = stbi__gif_load_next(&data->context, &data->gif, &comp, 4, twoBack);
 
-    return result;
+        if ((pixels == NULL) || (pixels == (unsigned char *)&data->context)) return false;     // Error or end of file
+
+        memcpy(data->history[data->decodedFrames%2], pixels, size);
+        data->decodedFrames++;
+    }
+
+    memcpy(output, data->history[frame%2], size);
+
+    return true;
 }
 
-// Returns color from normalized values [0..1]
-Color ColorFromNormalized(Vector4 normalized)
+// Launch image stream next frame decoding, if not decoding and decoded frames buffer not full
+static void DecodeImageStreamNext(ImageStreamData *data)
 {
-    Color result;
+    if (data->decoding || data->failed || (data->count >= IMAGE_STREAM_BUFFER_FRAMES)) return;
 
-    result.r = (unsigned char)(normalized.x*255.0f);
-    result.g = (unsigned char)(normalized.y*255.0f);
-    result.b = (unsigned char)(normalized.z*255.0f);
-    result.a = (unsigned char)(normalized.w*255.0f);
+    if (data->nextFrame >= data->frameCount)
+    {
+        if (data->looping) data->nextFrame = 0;
+        else return;
+    }
 
-    return result;
+    data->decoding = true;
+    data->decodeFrame = data->nextFrame;
+    data->decodeSlot = (data->first + data->count)%IMAGE_STREAM_BUFFER_FRAMES;
+    data->decodeGeneration = data->generation;
+
+    RunAsyncJob(DecodeImageStreamJob, DecodeImageStreamFinish, DecodeImageStreamCancel, data);
 }
 
-// Returns HSV values for a Color
-// NOTE: Hue is returned as degrees [0..360]
-Vector3 ColorToHSV(Color color)
+// Image stream job: decode frame (worker thread)
+static void DecodeImageStreamJob(void *arg)
 {
-    Vector3 hsv = { 0 };
-    Vector3 rgb = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-    float min, max, delta;
+    ImageStreamData *data = (ImageStreamData *)arg;
 
-    min = rgb.x < rgb.y? rgb.x : rgb.y;
-    min = min  < rgb.z? min  : rgb.z;
+    data->decodeSuccess = DecodeImageStreamFrame(data, data->decodeFrame, data->frames[data->decodeSlot]);
+}
 
-    max = rgb.x > rgb.y? rgb.x : rgb.y;
-    max = max  > rgb.z? max  : rgb.z;
+// Image stream job finished: frame added to decoded frames, next frame decoding launched
+static void DecodeImageStreamFinish(void *arg)
+{
+    ImageStreamData *data = (ImageStreamData *)arg;
 
-    hsv.z = max;            // Value
-    delta = max - min;
+    data->decoding = false;
 
-    if (delta < 0.00001f)
+    if (data->unloaded)
     {
-        hsv.y = 0.0f;
-        hsv.x = 0.0f;       // Undefined, maybe NAN?
-        return hsv;
+        UnloadImageStreamData(data);
+        return;
     }
 
-    if (max > 0.0f)
-    {
-        // NOTE: If max is 0, this divide would cause a crash
-        hsv.y = (delta/max);    // Saturation
-    }
-    else
+    if (data->decodeGeneration == data->generation)     // Frame not discarded by a seek
     {
-        // NOTE: If max is 0, then r = g = b = 0, s = 0, h is undefined
-        hsv.y = 0.0f;
-        hsv.x = NAN;        // Undefined
-        return hsv;
-    }
+        if (!data->decodeSuccess)
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Failed to decode image stream frame %i", data->decodeFrame);
+            data->failed = true;
+            return;
+        }
 
-    // NOTE: Comparing float values could not work properly
-    if (rgb.x >= max) hsv.x = (rgb.y - rgb.z)/delta;    // Between yellow & magenta
-    else
-    {
-        if (rgb.y >= max) hsv.x = 2.0f + (rgb.z - rgb.x)/delta;  // Between cyan & yellow
-        else hsv.x = 4.0f + (rgb.x - rgb.y)/delta;      // Between magenta & cyan
+        data->frameIndex[data->decodeSlot] = data->decodeFrame;
+        data->count++;
+        data->nextFrame = data->decodeFrame + 1;
     }
 
-    hsv.x *= 60.0f;     // Convert to degrees
+    DecodeImageStreamNext(data);
+}
 
-    if (hsv.x < 0.0f) hsv.x += 360.0f;
+// Image stream job cancelled: decoding stopped, data released if stream was unloaded while decoding
+static void DecodeImageStreamCancel(void *arg)
+{
+    ImageStreamData *data = (ImageStreamData *)arg;
 
-    return hsv;
+    data->decoding = false;
+
+    if (data->unloaded) UnloadImageStreamData(data);
 }
 
-// Returns a Color from HSV values
-// Implementation reference: https://en.wikipedia.org/wiki/HSL_and_HSV#Alternative_HSV_conversion
-// NOTE: Color->HSV->Color conversion will not yield exactly the same color due to rounding errors
-// Hue is provided in degrees: [0..360]
-// Saturation/Value are provided normalized: [0.0f..1.0f]
-Color ColorFromHSV(float hue, float saturation, float value)
+// Unload image stream data (decoder state and frames buffers)
+static void UnloadImageStreamData(ImageStreamData *data)
 {
-    Color color = { 0, 0, 0, 255 };
-
-    // Red channel
-    float k = fmodf((5.0f + hue/60.0f), 6);
-    float t = 4.0f - k;
-    k = (t < k)? t : k;
-    k = (k < 1)? k : 1;
-    k = (k > 0)? k : 0;
-    color.r = (unsigned char)((value - value*saturation*k)*255.0f);
+    RL_FREE(data->gif.out);
+    RL_FREE(data->gif.background);
+    RL_FREE(data->gif.history);
 
-    // Green channel
-    k = fmodf((3.0f + hue/60.0f), 6);
-    t = 4.0f - k;
-    k = (t < k)? t : k;
-    k = (k < 1)? k : 1;
-    k = (k > 0)? k : 0;
-    color.g = (unsigned char)((value - value*saturation*k)*255.0f);
+    for (int i = 0; i < 2; i++) RL_FREE(data->history[i]);
+    for (int i = 0; i < IMAGE_STREAM_BUFFER_FRAMES; i++) RL_FREE(data->frames[i]);
 
-    // Blue channel
-    k = fmodf((1.0f + hue/60.0f), 6);
-    t = 4.0f - k;
-    k = (t < k)? t : k;
-    k = (k < 1)? k : 1;
-    k = (k > 0)? k : 0;
-    color.b = (unsigned char)((value - value*saturation*k)*255.0f);
+    RL_FREE(data->delays);
+    RL_FREE(data->fileData);
+    RL_FREE(data);
+}
+#endif  // SUPPORT_FILEFORMAT_GIF
 
-    return color;
+// Get color quantizer histogram bin (RGB 5 bits, alpha 3 bits)
+static int GetQuantizeBin(int r, int g, int b, int a)
+{
+    return ((r >> 3) << 13) | ((g >> 3) << 8) | ((b >> 3) << 3) | (a >> 5);
 }
 
-// Returns color with alpha applied, alpha goes from 0.0f to 1.0f
-Color ColorAlpha(Color color, float alpha)
+// Load image colors histogram, pixels accumulated in reduced precision bins
+// NOTE: Fully transparent pixels are ignored, colors are bins mean colors
+static QuantizeColor *LoadQuantizeColors(const Color *pixels, int count, int *colorsCount)
 {
-    if (alpha < 0.0f) alpha = 0.0f;
-    else if (alpha > 1.0f) alpha = 1.0f;
+    unsigned int *binCounts = (unsigned int *)RL_CALLOC(QUANTIZE_BINS, sizeof(unsigned int));
+    unsigned long long *binSums = (unsigned long long *)RL_CALLOC(QUANTIZE_BINS*4, sizeof(unsigned long long));
+    int binsUsed = 0;
 
-    return (Color){color.r, color.g, color.b, (unsigned char)(255.0f*alpha)};
+    for (int i = 0; i < count; i++)
+    {
+        if (pixels[i].a == 0) continue;
+
+        int bin = GetQuantizeBin(pixels[i].r, pixels[i].g, pixels[i].b, pixels[i].a);
+
+        if (binCounts[bin] == 0) binsUsed++;
+        binCounts[bin]++;
+        binSums[bin*4] += pixels[i].r;
+        binSums[bin*4 + 1] += pixels[i].g;
+        binSums[bin*4 + 2] += pixels[i].b;
+        binSums[bin*4 + 3] += pixels[i].a;
+    }
+
+    QuantizeColor *colors = (QuantizeColor *)RL_MALLOC((binsUsed > 0)? binsUsed*sizeof(QuantizeColor) : sizeof(QuantizeColor));
+
+    for (int bin = 0, k = 0; bin < QUANTIZE_BINS; bin++)
+    {
+        if (binCounts[bin] == 0) continue;
+
+        for (int c = 0; c < 4; c++) colors[k].color[c] = (float)binSums[bin*4 + c]/binCounts[bin];
+        colors[k].count = binCounts[bin];
+        k++;
+    }
+
+    RL_FREE(binCounts);
+    RL_FREE(binSums);
+
+    *colorsCount = binsUsed;
+    return colors;
 }
 
-// Returns src alpha-blended into dst color with tint
-Color ColorAlphaBlend(Color dst, Color src, Color tint)
+// Quantize colors histogram to a palette, returns palette colors count
+// NOTE: Median-cut boxes split on the widest weighted axis at pixels median,
+// palette is refined with some k-means steps over histogram colors
+static int QuantizePalette(QuantizeColor *colors, int count, Color *palette, int paletteSize)
 {
-    Color out = WHITE;
+    if (count == 0) return 0;
+    if (paletteSize > 256) paletteSize = 256;
 
-    // Apply color tint to source color
-    src.r = (unsigned char)(((unsigned int)src.r*(unsigned int)tint.r) >> 8);
-    src.g = (unsigned char)(((unsigned int)src.g*(unsigned int)tint.g) >> 8);
-    src.b = (unsigned char)(((unsigned int)src.b*(unsigned int)tint.b) >> 8);
-    src.a = (unsigned char)(((unsigned int)src.a*(unsigned int)tint.a) >> 8);
+    int (*compare[4])(const void *, const void *) = { CompareQuantizeColorR, CompareQuantizeColorG, CompareQuantizeColorB, CompareQuantizeColorA };
 
-//#define COLORALPHABLEND_FLOAT
-#define COLORALPHABLEND_INTEGERS
-#if defined(COLORALPHABLEND_INTEGERS)
-    if (src.a == 0) out = dst;
-    else if (src.a == 255) out = src;
-    else
+    QuantizeBox boxes[256] = { 0 };
+    int boxCount = 1;
+
+    boxes[0].count = count;
+    ComputeQuantizeBox(&boxes[0], colors);
+
+    while (boxCount < paletteSize)
     {
-        unsigned int alpha = (unsigned int)src.a + 1;     // We are shifting by 8 (dividing by 256), so we need to take that excess into account
-        out.a = (unsigned char)(((unsigned int)alpha*256 + (unsigned int)dst.a*(256 - alpha)) >> 8);
+        // Select box to split: widest weighted range by pixels count
+        int selected = -1;
+        float priority = 0.0f;
 
-        if (out.a > 0)
+        for (int i = 0; i < boxCount; i++)
         {
-            out.r = (unsigned char)((((unsigned int)src.r*alpha*256 + (unsigned int)dst.r*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
-            out.g = (unsigned char)((((unsigned int)src.g*alpha*256 + (unsigned int)dst.g*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
-            out.b = (unsigned char)((((unsigned int)src.b*alpha*256 + (unsigned int)dst.b*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+            if ((boxes[i].count > 1) && ((boxes[i].range*boxes[i].pixels) > priority))
+            {
+                priority = boxes[i].range*boxes[i].pixels;
+                selected = i;
+            }
+        }
+
+        if (selected < 0) break;    // All boxes contain a single color
+
+        QuantizeBox *box = &boxes[selected];
+        qsort(colors + box->first, box->count, sizeof(QuantizeColor), compare[box->axis]);
+
+        // Split at pixels median, both boxes keep at least one color
+        unsigned long long half = box->pixels/2;
+        unsigned long long accum = 0;
+        int split = 1;
+
+        for (int i = 0; i < (box->count - 1); i++)
+        {
+            accum += colors[box->first + i].count;
+            split = i + 1;
+            if (accum >= half) break;
         }
+
+        boxes[boxCount].first = box->first + split;
+        boxes[boxCount].count = box->count - split;
+        box->count = split;
+
+        ComputeQuantizeBox(box, colors);
+        ComputeQuantizeBox(&boxes[boxCount], colors);
+        boxCount++;
     }
-#endif
-#if defined(COLORALPHABLEND_FLOAT)
-    if (src.a == 0) out = dst;
-    else if (src.a == 255) out = src;
-    else
-    {
-        Vector4 fdst = ColorNormalize(dst);
-        Vector4 fsrc = ColorNormalize(src);
-        Vector4 ftint = ColorNormalize(tint);
-        Vector4 fout = { 0 };
 
-        fout.w = fsrc.w + fdst.w*(1.0f - fsrc.w);
+    float centroids[256][4] = { 0 };
 
-        if (fout.w > 0.0f)
+    for (int i = 0; i < boxCount; i++)
+    {
+        double sum[4] = { 0 };
+
+        for (int k = boxes[i].first; k < (boxes[i].first + boxes[i].count); k++)
         {
-            fout.x = (fsrc.x*fsrc.w + fdst.x*fdst.w*(1 - fsrc.w))/fout.w;
-            fout.y = (fsrc.y*fsrc.w + fdst.y*fdst.w*(1 - fsrc.w))/fout.w;
-            fout.z = (fsrc.z*fsrc.w + fdst.z*fdst.w*(1 - fsrc.w))/fout.w;
+            for (int c = 0; c < 4; c++) sum[c] += (double)colors[k].color[c]*colors[k].count;
         }
 
-        out = (Color){ (unsigned char)(fout.x*255.0f), (unsigned char)(fout.y*255.0f), (unsigned char)(fout.z*255.0f), (unsigned char)(fout.w*255.0f) };
+        for (int c = 0; c < 4; c++) centroids[i][c] = (float)(sum[c]/boxes[i].pixels);
     }
-#endif
 
-    return out;
-}
+    // K-means refinement, colors moved to nearest centroid
+    for (int step = 0; step < QUANTIZE_KMEANS_STEPS; step++)
+    {
+        double sums[256][4] = { 0 };
+        double counts[256] = { 0 };
 
-// Returns a Color struct from hexadecimal value
-Color GetColor(int hexValue)
-{
-    Color color;
+        for (int i = 0; i < boxCount; i++) palette[i] = (Color){ (unsigned char)(centroids[i][0] + 0.5f), (unsigned char)(centroids[i][1] + 0.5f), (unsigned char)(centroids[i][2] + 0.5f), (unsigned char)(centroids[i][3] + 0.5f) };
 
-    color.r = (unsigned char)(hexValue >> 24) & 0xFF;
-    color.g = (unsigned char)(hexValue >> 16) & 0xFF;
-    color.b = (unsigned char)(hexValue >> 8) & 0xFF;
-    color.a = (unsigned char)hexValue & 0xFF;
+        for (int k = 0; k < count; k++)
+        {
+            int nearest = GetPaletteNearest(palette, boxCount, colors[k].color);
 
-    return color;
+            for (int c = 0; c < 4; c++) sums[nearest][c] += (double)colors[k].color[c]*colors[k].count;
+            counts[nearest] += colors[k].count;
+        }
+
+        for (int i = 0; i < boxCount; i++)
+        {
+            if (counts[i] > 0) for (int c = 0; c < 4; c++) centroids[i][c] = (float)(sums[i][c]/counts[i]);
+        }
+    }
+
+    for (int i = 0; i < boxCount; i++) palette[i] = (Color){ (unsigned char)(centroids[i][0] + 0.5f), (unsigned char)(centroids[i][1] + 0.5f), (unsigned char)(centroids[i][2] + 0.5f), (unsigned char)(centroids[i][3] + 0.5f) };
+
+    return boxCount;
 }
 
-// Get color from a pixel from certain format
-Color GetPixelColor(void *srcPtr, int format)
+// Compute quantizer box pixels count and widest weighted axis
+static void ComputeQuantizeBox(QuantizeBox *box, const QuantizeColor *colors)
 {
-    Color col = { 0 };
+    float min[4] = { 255.0f, 255.0f, 255.0f, 255.0f };
+    float max[4] = { 0 };
 
-    switch (format)
+    box->pixels = 0;
+
+    for (int k = box->first; k < (box->first + box->count); k++)
     {
-        case UNCOMPRESSED_GRAYSCALE: col = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], 255 }; break;
-        case UNCOMPRESSED_GRAY_ALPHA: col = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1] }; break;
-        case UNCOMPRESSED_R5G6B5:
+        for (int c = 0; c < 4; c++)
         {
-            col.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
-            col.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 5) & 0b0000000000111111)*255/63);
-            col.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
-            col.a = 255;
+            if (colors[k].color[c] < min[c]) min[c] = colors[k].color[c];
+            if (colors[k].color[c] > max[c]) max[c] = colors[k].color[c];
+        }
 
-        } break;
-        case UNCOMPRESSED_R5G5B5A1:
-        {
-            col.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
-            col.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 6) & 0b0000000000011111)*255/31);
-            col.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
-            col.a = (((unsigned short *)srcPtr)[0] & 0b0000000000000001)? 255 : 0;
+        box->pixels += colors[k].count;
+    }
 
-        } break;
-        case UNCOMPRESSED_R4G4B4A4:
-        {
-            col.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 12)*255/15);
-            col.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 8) & 0b0000000000001111)*255/15);
-            col.b = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 4) & 0b0000000000001111)*255/15);
-            col.a = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000001111)*255/15);
+    box->axis = 0;
+    box->range = 0.0f;
 
-        } break;
-        case UNCOMPRESSED_R8G8B8A8: col = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], ((unsigned char *)srcPtr)[3] }; break;
-        case UNCOMPRESSED_R8G8B8: col = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], 255 }; break;
-        // TODO: case UNCOMPRESSED_R32: break;
-        // TODO: case UNCOMPRESSED_R32G32B32: break;
-        // TODO: case UNCOMPRESSED_R32G32B32A32: break;
-        default: break;
-    }
+    for (int c = 0; c < 4; c++)
+    {
+        float range = (max[c] - min[c])*(max[c] - min[c])*quantizeWeights[c];
 
-    return col;
+        if (range > box->range)
+        {
+            box->range = range;
+            box->axis = c;
+        }
+    }
 }
 
-// Set pixel color formatted into destination pointer
-void SetPixelColor(void *dstPtr, Color color, int format)
+// Compare quantizer colors by one channel (qsort)
+static int CompareQuantizeColorR(const void *a, const void *b) { float d = ((const QuantizeColor *)a)->color[0] - ((const QuantizeColor *)b)->color[0]; return (d > 0) - (d < 0); }
+static int CompareQuantizeColorG(const void *a, const void *b) { float d = ((const QuantizeColor *)a)->color[1] - ((const QuantizeColor *)b)->color[1]; return (d > 0) - (d < 0); }
+static int CompareQuantizeColorB(const void *a, const void *b) { float d = ((const QuantizeColor *)a)->color[2] - ((const QuantizeColor *)b)->color[2]; return (d > 0) - (d < 0); }
+static int CompareQuantizeColorA(const void *a, const void *b) { float d = ((const QuantizeColor *)a)->color[3] - ((const QuantizeColor *)b)->color[3]; return (d > 0) - (d < 0); }
+
+// Get palette color nearest to provided color (RGBA float), using weighted distance
+static int GetPaletteNearest(const Color *palette, int count, const float *color)
 {
-    switch (format)
+    int nearest = 0;
+    float minDistance = 0.0f;
+
+    for (int i = 0; i < count; i++)
     {
-        case UNCOMPRESSED_GRAYSCALE:
+        float dr = color[0] - palette[i].r;
+        float dg = color[1] - palette[i].g;
+        float db = color[2] - palette[i].b;
+        float da = color[3] - palette[i].a;
+        float distance = dr*dr*quantizeWeights[0] + dg*dg*quantizeWeights[1] + db*db*quantizeWeights[2] + da*da*quantizeWeights[3];
+
+        if ((i == 0) || (distance < minDistance))
         {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+            minDistance = distance;
+            nearest = i;
+        }
+    }
+
+    return nearest;
+}
+
+// Map pixels to palette colors indices, optionally Floyd-Steinberg dithered (RGB channels)
+// NOTE: Palette colors are matched exactly through an open-addressing hash table, for any other color
+// nearest palette color is cached by histogram bin, so mapping cost does not depend on palette size
+static void MapPaletteIndices(const Color *pixels, int width, int height, const Color *palette, int count, bool dither, unsigned char *indices)
+{
+    short *cache = (short *)RL_MALLOC(QUANTIZE_BINS*sizeof(short));
+    for (int i = 0; i < QUANTIZE_BINS; i++) cache[i] = -1;
+
+    // Hash table keys are packed colors, -1 index means empty slot (first palette index kept on duplicated colors)
+    int tableBits = 1;
+    while ((1 << tableBits) < count*2) tableBits++;
+    int tableSize = 1 << tableBits;
+
+    unsigned int *keys = (unsigned int *)RL_CALLOC(tableSize, sizeof(unsigned int));
+    short *keyIndices = (short *)RL_MALLOC(tableSize*sizeof(short));
+    for (int i = 0; i < tableSize; i++) keyIndices[i] = -1;
 
-            ((unsigned char *)dstPtr)[0] = gray;
+    for (int i = 0; i < count; i++)
+    {
+        unsigned int key = (unsigned int)palette[i].r | ((unsigned int)palette[i].g << 8) | ((unsigned int)palette[i].b << 16) | ((unsigned int)palette[i].a << 24);
+        unsigned int slot = (key*2654435761u) >> (32 - tableBits);     // Multiplicative hash
 
-        } break;
-        case UNCOMPRESSED_GRAY_ALPHA:
+        while ((keyIndices[slot] >= 0) && (keys[slot] != key)) slot = (slot + 1) & (tableSize - 1);
+
+        if (keyIndices[slot] < 0)
         {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+            keys[slot] = key;
+            keyIndices[slot] = (short)i;
+        }
+    }
 
-            ((unsigned char *)dstPtr)[0] = gray;
-            ((unsigned char *)dstPtr)[1] = color.a;
+    // Fully transparent pixels are mapped to first transparent palette color (if available)
+    int transparent = -1;
+    for (int i = 0; (i < count) && (transparent < 0); i++) if (palette[i].a == 0) transparent = i;
 
-        } break;
-        case UNCOMPRESSED_R5G6B5:
-        {
-            // NOTE: Calculate R5G6B5 equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+    // Dithering error rows (current and next), one pixel padding on both sides
+    float *errors = dither? (float *)RL_CALLOC((width + 2)*3*2, sizeof(float)) : NULL;
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*63.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+    for (int y = 0; y < height; y++)
+    {
+        float *current = (errors != NULL)? errors + ((y%2) == 0? 0 : (width + 2)*3) : NULL;
+        float *next = (errors != NULL)? errors + ((y%2) == 0? (width + 2)*3 : 0) : NULL;
 
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+        if (next != NULL) memset(next, 0, (width + 2)*3*sizeof(float));
 
-        } break;
-        case UNCOMPRESSED_R5G5B5A1:
+        for (int x = 0; x < width; x++)
         {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+            Color pixel = pixels[y*width + x];
+            int color[4] = { pixel.r, pixel.g, pixel.b, pixel.a };
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*31.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
-            unsigned char a = (coln.w > ((float)UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;;
+            if ((pixel.a == 0) && (transparent >= 0))
+            {
+                indices[y*width + x] = (unsigned char)transparent;
+                continue;
+            }
 
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+            if (current != NULL)
+            {
+                for (int c = 0; c < 3; c++)
+                {
+                    color[c] += (int)(current[(x + 1)*3 + c] + ((current[(x + 1)*3 + c] > 0)? 0.5f : -0.5f));
+                    if (color[c] < 0) color[c] = 0;
+                    else if (color[c] > 255) color[c] = 255;
+                }
+            }
 
-        } break;
-        case UNCOMPRESSED_R4G4B4A4:
-        {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+            // Exact palette color match, bin cache is only used for colors not on the palette
+            unsigned int key = (unsigned int)color[0] | ((unsigned int)color[1] << 8) | ((unsigned int)color[2] << 16) | ((unsigned int)color[3] << 24);
+            unsigned int slot = (key*2654435761u) >> (32 - tableBits);
 
-            unsigned char r = (unsigned char)(round(coln.x*15.0f));
-            unsigned char g = (unsigned char)(round(coln.y*15.0f));
-            unsigned char b = (unsigned char)(round(coln.z*15.0f));
-            unsigned char a = (unsigned char)(round(coln.w*15.0f));
+            while ((keyIndices[slot] >= 0) && (keys[slot] != key)) slot = (slot + 1) & (tableSize - 1);
 
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+            int index = keyIndices[slot];
 
-        } break;
-        case UNCOMPRESSED_R8G8B8:
-        {
-            ((unsigned char *)dstPtr)[0] = color.r;
-            ((unsigned char *)dstPtr)[1] = color.g;
-            ((unsigned char *)dstPtr)[2] = color.b;
+            if (index < 0)
+            {
+                int bin = GetQuantizeBin(color[0], color[1], color[2], color[3]);
 
-        } break;
-        case UNCOMPRESSED_R8G8B8A8:
-        {
-            ((unsigned char *)dstPtr)[0] = color.r;
-            ((unsigned char *)dstPtr)[1] = color.g;
-            ((unsigned char *)dstPtr)[2] = color.b;
-            ((unsigned char *)dstPtr)[3] = color.a;
+                if (cache[bin] < 0)
+                {
+                    // NOTE: Nearest color computed for bin center
+                    float center[4] = { (float)(((color[0] >> 3) << 3) + 4), (float)(((color[1] >> 3) << 3) + 4), (float)(((color[2] >> 3) << 3) + 4), (float)(((color[3] >> 5) << 5) + 16) };
+                    cache[bin] = (short)GetPaletteNearest(palette, count, center);
+                }
 
-        } break;
-        default: break;
-    }
-}
+                index = cache[bin];
+            }
 
-// Get pixel data size in bytes for certain format
-// NOTE: Size can be requested for Image or Texture data
-int GetPixelDataSize(int width, int height, int format)
-{
-    int dataSize = 0;       // Size in bytes
-    int bpp = 0;            // Bits per pixel
+            indices[y*width + x] = (unsigned char)index;
 
-    switch (format)
-    {
-        case UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
-        case UNCOMPRESSED_GRAY_ALPHA:
-        case UNCOMPRESSED_R5G6B5:
-        case UNCOMPRESSED_R5G5B5A1:
-        case UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
-        case UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
-        case UNCOMPRESSED_R8G8B8: bpp = 24; break;
-        case UNCOMPRESSED_R32: bpp = 32; break;
-        case UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
-        case UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
-        case COMPRESSED_DXT1_RGB:
-        case COMPRESSED_DXT1_RGBA:
-        case COMPRESSED_ETC1_RGB:
-        case COMPRESSED_ETC2_RGB:
-        case COMPRESSED_PVRT_RGB:
-        case COMPRESSED_PVRT_RGBA: bpp = 4; break;
-        case COMPRESSED_DXT3_RGBA:
-        case COMPRESSED_DXT5_RGBA:
-        case COMPRESSED_ETC2_EAC_RGBA:
-        case COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
-        case COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
-        default: break;
-    }
+            if (current != NULL)
+            {
+                int mapped[3] = { palette[index].r, palette[index].g, palette[index].b };
 
-    dataSize = width*height*bpp/8;  // Total data size in bytes
+                for (int c = 0; c < 3; c++)
+                {
+                    float error = (float)(color[c] - mapped[c]);
 
-    // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
-    {
-        if ((format >= COMPRESSED_DXT1_RGB) && (format < COMPRESSED_DXT3_RGBA)) dataSize = 8;
-        else if ((format >= COMPRESSED_DXT3_RGBA) && (format < COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
+                    current[(x + 2)*3 + c] += error*7.0f/16.0f;
+                    next[x*3 + c] += error*3.0f/16.0f;
+                    next[(x + 1)*3 + c] += error*5.0f/16.0f;
+                    next[(x + 2)*3 + c] += error*1.0f/16.0f;
+                }
+            }
+        }
     }
 
-    return dataSize;
+    RL_FREE(errors);
+    RL_FREE(keyIndices);
+    RL_FREE(keys);
+    RL_FREE(cache);
 }
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
 #if defined(SUPPORT_FILEFORMAT_DDS)
 // Loading DDS image data (compressed or uncompressed)
 static Image LoadDDS(const unsigned char *fileData, unsigned int fileSize)
@@ -3979,16 +6688,6 @@ static Image LoadDDS(const unsigned char *fileData, unsigned int fileSize)
             }
             else if (((ddsHeader->ddspf.flags == 0x04) || (ddsHeader->ddspf.flags == 0x05)) && (ddsHeader->ddspf.fourCC > 0)) // Compressed
             {
-                int dataSize = 0;
-
-                // Calculate data size, including all mipmaps
-                if (ddsHeader->mipmapCount > 1) dataSize = ddsHeader->pitchOrLinearSize*2;
-                else dataSize = ddsHeader->pitchOrLinearSize;
-
-                image.data = (unsigned char *)RL_MALLOC(dataSize*sizeof(unsigned char));
-
-                memcpy(image.data, fileDataPtr, dataSize);
-
                 switch (ddsHeader->ddspf.fourCC)
                 {
                     case FOURCC_DXT1:
@@ -4000,12 +6699,164 @@ static Image LoadDDS(const unsigned char *fileData, unsigned int fileSize)
                     case FOURCC_DXT5: image.format = COMPRESSED_DXT5_RGBA; break;
                     default: break;
                 }
+
+                // Calculate data size, including all mipmaps
+                // NOTE: Only mipmaps levels available in file data are loaded
+                int dataSize = 0;
+                int availableSize = (int)fileSize - (int)(fileDataPtr - fileData);
+
+                for (int i = 0, width = image.width, height = image.height; i < image.mipmaps; i++)
+                {
+                    int mipSize = GetPixelDataSize(width, height, image.format);
+
+                    if ((dataSize + mipSize) > availableSize)
+                    {
+                        TRACELOG(LOG_WARNING, "IMAGE: DDS file data contains %i of %i mipmaps", i, image.mipmaps);
+                        image.mipmaps = i;
+                        break;
+                    }
+
+                    dataSize += mipSize;
+                    width = (width > 1)? width/2 : 1;
+                    height = (height > 1)? height/2 : 1;
+                }
+
+                // NOTE: Image data points to file data (zero-copy), LoadImageFromMemory() copies it if required
+                if (dataSize > 0) image.data = fileDataPtr;
             }
         }
     }
 
     return image;
 }
+
+// Save image data as DDS file
+// NOTE: Supported formats: DXT1, DXT3, DXT5 (including mipmaps) and R8G8B8A8
+static int SaveDDS(Image image, const char *fileName)
+{
+    #define FOURCC_DXT1 0x31545844  // Equivalent to "DXT1" in ASCII
+    #define FOURCC_DXT3 0x33545844  // Equivalent to "DXT3" in ASCII
+    #define FOURCC_DXT5 0x35545844  // Equivalent to "DXT5" in ASCII
+
+    // DDS Pixel Format
+    typedef struct {
+        unsigned int size;
+        unsigned int flags;
+        unsigned int fourCC;
+        unsigned int rgbBitCount;
+        unsigned int rBitMask;
+        unsigned int gBitMask;
+        unsigned int bBitMask;
+        unsigned int aBitMask;
+    } DDSPixelFormat;
+
+    // DDS Header (124 bytes)
+    typedef struct {
+        unsigned int size;
+        unsigned int flags;
+        unsigned int height;
+        unsigned int width;
+        unsigned int pitchOrLinearSize;
+        unsigned int depth;
+        unsigned int mipmapCount;
+        unsigned int reserved1[11];
+        DDSPixelFormat ddspf;
+        unsigned int caps;
+        unsigned int caps2;
+        unsigned int caps3;
+        unsigned int caps4;
+        unsigned int reserved2;
+    } DDSHeader;
+
+    DDSHeader ddsHeader = { 0 };
+
+    ddsHeader.size = sizeof(DDSHeader);
+    ddsHeader.flags = 0x1007;               // DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT
+    ddsHeader.height = image.height;
+    ddsHeader.width = image.width;
+    ddsHeader.mipmapCount = image.mipmaps;
+    ddsHeader.ddspf.size = sizeof(DDSPixelFormat);
+    ddsHeader.caps = 0x1000;                // DDSCAPS_TEXTURE
+
+    switch (image.format)
+    {
+        case COMPRESSED_DXT1_RGB: ddsHeader.ddspf.flags = 0x04; ddsHeader.ddspf.fourCC = FOURCC_DXT1; break;
+        case COMPRESSED_DXT1_RGBA: ddsHeader.ddspf.flags = 0x05; ddsHeader.ddspf.fourCC = FOURCC_DXT1; break;
+        case COMPRESSED_DXT3_RGBA: ddsHeader.ddspf.flags = 0x04; ddsHeader.ddspf.fourCC = FOURCC_DXT3; break;
+        case COMPRESSED_DXT5_RGBA: ddsHeader.ddspf.flags = 0x04; ddsHeader.ddspf.fourCC = FOURCC_DXT5; break;
+        case UNCOMPRESSED_R8G8B8A8:
+        {
+            ddsHeader.ddspf.flags = 0x41;   // DDPF_RGB | DDPF_ALPHAPIXELS
+            ddsHeader.ddspf.rgbBitCount = 32;
+            ddsHeader.ddspf.rBitMask = 0x00ff0000;
+            ddsHeader.ddspf.gBitMask = 0x0000ff00;
+            ddsHeader.ddspf.bBitMask = 0x000000ff;
+            ddsHeader.ddspf.aBitMask = 0xff000000;
+        } break;
+        default:
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Pixel format not supported for DDS export (%i)", image.format);
+            return 0;
+        }
+    }
+
+    if (image.format >= COMPRESSED_DXT1_RGB)
+    {
+        ddsHeader.flags |= 0x80000;         // DDSD_LINEARSIZE
+        ddsHeader.pitchOrLinearSize = GetPixelDataSize(image.width, image.height, image.format);
+    }
+    else
+    {
+        ddsHeader.flags |= 0x08;            // DDSD_PITCH
+        ddsHeader.pitchOrLinearSize = image.width*4;
+    }
+
+    if (image.mipmaps > 1)
+    {
+        ddsHeader.flags |= 0x20000;         // DDSD_MIPMAPCOUNT
+        ddsHeader.caps |= (0x08 | 0x400000);    // DDSCAPS_COMPLEX | DDSCAPS_MIPMAP
+    }
+
+    // Calculate file dataSize required
+    int dataSize = 4 + sizeof(DDSHeader);
+    int imageSize = 0;
+
+    for (int i = 0, width = image.width, height = image.height; i < image.mipmaps; i++)
+    {
+        imageSize += GetPixelDataSize(width, height, image.format);
+
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    dataSize += imageSize;
+
+    unsigned char *fileData = RL_CALLOC(dataSize, 1);
+
+    memcpy(fileData, "DDS ", 4);
+    memcpy(fileData + 4, &ddsHeader, sizeof(DDSHeader));
+    memcpy(fileData + 4 + sizeof(DDSHeader), image.data, imageSize);
+
+    // NOTE: DirectX expects B8G8R8A8 byte order for uncompressed 32bit data (see LoadDDS())
+    if (image.format == UNCOMPRESSED_R8G8B8A8)
+    {
+        unsigned char *pixels = fileData + 4 + sizeof(DDSHeader);
+
+        for (int i = 0; i < imageSize; i += 4)
+        {
+            unsigned char red = pixels[i];
+            pixels[i] = pixels[i + 2];
+            pixels[i + 2] = red;
+        }
+    }
+
+    int success = SaveFileData(fileName, fileData, dataSize);
+
+    RL_FREE(fileData);    // Free file data buffer
+
+    // If all data has been written correctly to file, success = 1
+    return success;
+}
 #endif
 
 #if defined(SUPPORT_FILEFORMAT_PKM)
@@ -4091,7 +6942,7 @@ static Image LoadPKM(const unsigned char *fileData, unsigned int fileSize)
 #endif
 
 #if defined(SUPPORT_FILEFORMAT_KTX)
-// Load KTX compressed image data (ETC1/ETC2 compression)
+// Load KTX compressed image data (ETC1/ETC2/DXT compression)
 static Image LoadKTX(const unsigned char *fileData, unsigned int fileSize)
 {
     unsigned char *fileDataPtr = (unsigned char *)fileData;
@@ -4099,11 +6950,16 @@ static Image LoadKTX(const unsigned char *fileData, unsigned int fileSize)
     // Required extensions:
     // GL_OES_compressed_ETC1_RGB8_texture  (ETC1)
     // GL_ARB_ES3_compatibility  (ETC2/EAC)
+    // GL_EXT_texture_compression_s3tc  (DXT)
 
     // Supported tokens (defined by extensions)
     // GL_ETC1_RGB8_OES                 0x8D64
     // GL_COMPRESSED_RGB8_ETC2          0x9274
     // GL_COMPRESSED_RGBA8_ETC2_EAC     0x9278
+    // GL_COMPRESSED_RGB_S3TC_DXT1_EXT      0x83F0
+    // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT     0x83F1
+    // GL_COMPRESSED_RGBA_S3TC_DXT3_EXT     0x83F2
+    // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT     0x83F3
 
     // KTX file Header (64 bytes)
     // v1.1 - https://www.khronos.org/opengles/sdk/tools/KTX/file_format_spec/
@@ -4147,7 +7003,7 @@ static Image LoadKTX(const unsigned char *fileData, unsigned int fileSize)
 
             image.width = ktxHeader->width;
             image.height = ktxHeader->height;
-            image.mipmaps = ktxHeader->mipmapLevels;
+            image.mipmaps = (ktxHeader->mipmapLevels > 0)? ktxHeader->mipmapLevels : 1;
 
             TRACELOGD("IMAGE: KTX file data info:");
             TRACELOGD("    > Image width:  %i", ktxHeader->width);
@@ -4156,16 +7012,53 @@ static Image LoadKTX(const unsigned char *fileData, unsigned int fileSize)
 
             fileDataPtr += ktxHeader->keyValueDataSize; // Skip value data size
 
-            int dataSize = ((int *)fileDataPtr)[0];
-            fileDataPtr += sizeof(int);
+            // Calculate data size, including all mipmaps
+            // NOTE: Only mipmaps levels available in file data are loaded
+            int dataSize = 0;
+            unsigned char *levelDataPtr = fileDataPtr;
 
-            image.data = (unsigned char *)RL_MALLOC(dataSize*sizeof(unsigned char));
+            for (int i = 0; i < image.mipmaps; i++)
+            {
+                unsigned int levelSize = 0;
 
-            memcpy(image.data, fileDataPtr, dataSize);
+                if ((levelDataPtr + sizeof(unsigned int)) <= (fileData + fileSize)) memcpy(&levelSize, levelDataPtr, sizeof(unsigned int));
+
+                if ((levelSize == 0) || ((levelDataPtr + sizeof(unsigned int) + levelSize) > (fileData + fileSize)))
+                {
+                    TRACELOG(LOG_WARNING, "IMAGE: KTX file data contains %i of %i mipmaps", i, image.mipmaps);
+                    image.mipmaps = i;
+                    break;
+                }
+
+                dataSize += levelSize;
+                levelDataPtr += (sizeof(unsigned int) + levelSize);
+            }
+
+            // NOTE: Single level image data points to file data (zero-copy), LoadImageFromMemory() copies it if required
+            if (image.mipmaps == 1) image.data = fileDataPtr + sizeof(unsigned int);
+            else if (dataSize > 0)
+            {
+                image.data = (unsigned char *)RL_MALLOC(dataSize*sizeof(unsigned char));
+
+                // Copy mipmaps data, skipping every level data size
+                for (int i = 0, offset = 0; i < image.mipmaps; i++)
+                {
+                    unsigned int levelSize = 0;
+                    memcpy(&levelSize, fileDataPtr, sizeof(unsigned int));
+                    memcpy((unsigned char *)image.data + offset, fileDataPtr + sizeof(unsigned int), levelSize);
+
+                    fileDataPtr += (sizeof(unsigned int) + levelSize);
+                    offset += levelSize;
+                }
+            }
 
             if (ktxHeader->glInternalFormat == 0x8D64) image.format = COMPRESSED_ETC1_RGB;
             else if (ktxHeader->glInternalFormat == 0x9274) image.format = COMPRESSED_ETC2_RGB;
             else if (ktxHeader->glInternalFormat == 0x9278) image.format = COMPRESSED_ETC2_EAC_RGBA;
+            else if (ktxHeader->glInternalFormat == 0x83F0) image.format = COMPRESSED_DXT1_RGB;
+            else if (ktxHeader->glInternalFormat == 0x83F1) image.format = COMPRESSED_DXT1_RGBA;
+            else if (ktxHeader->glInternalFormat == 0x83F2) image.format = COMPRESSED_DXT3_RGBA;
+            else if (ktxHeader->glInternalFormat == 0x83F3) image.format = COMPRESSED_DXT5_RGBA;
         }
     }
 
@@ -4199,12 +7092,15 @@ static int SaveKTX(Image image, const char *fileName)
     } KTXHeader;
 
     // Calculate file dataSize required
+    // NOTE: Every mipmap level data is preceded by its size (unsigned int)
     int dataSize = sizeof(KTXHeader);
 
     for (int i = 0, width = image.width, height = image.height; i < image.mipmaps; i++)
     {
-        dataSize += GetPixelDataSize(width, height, image.format);
-        width /= 2; height /= 2;
+        dataSize += (sizeof(unsigned int) + GetPixelDataSize(width, height, image.format));
+
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
     }
 
     unsigned char *fileData = RL_CALLOC(dataSize, 1);
@@ -4220,7 +7116,7 @@ static int SaveKTX(Image image, const char *fileName)
 
     // Get the image header
     memcpy(ktxHeader.id, ktxIdentifier, 12);  // KTX 1.1 signature
-    ktxHeader.endianness = 0;
+    ktxHeader.endianness = 0x04030201;       // Written as 0x01 0x02 0x03 0x04 (little-endian)
     ktxHeader.glType = 0;                     // Obtained from image.format
     ktxHeader.glTypeSize = 1;
     ktxHeader.glFormat = 0;                   // Obtained from image.format
@@ -4234,10 +7130,27 @@ static int SaveKTX(Image image, const char *fileName)
     ktxHeader.mipmapLevels = image.mipmaps;   // If it was 0, it means mipmaps should be generated on loading (not for compressed formats)
     ktxHeader.keyValueDataSize = 0;           // No extra data after the header
 
-    rlGetGlTextureFormats(image.format, &ktxHeader.glInternalFormat, &ktxHeader.glFormat, &ktxHeader.glType);   // rlgl module function
-    ktxHeader.glBaseInternalFormat = ktxHeader.glFormat;    // KTX 1.1 only
-
-    // NOTE: We can save into a .ktx all PixelFormats supported by raylib, including compressed formats like DXT, ETC or ASTC
+    // NOTE: We can save into a .ktx all PixelFormats supported by raylib, including compressed formats like DXT, ETC or ASTC,
+    // compressed formats tokens are set directly, not depending on current OpenGL context extensions support
+    switch (image.format)
+    {
+        case COMPRESSED_DXT1_RGB: ktxHeader.glInternalFormat = 0x83F0; ktxHeader.glBaseInternalFormat = 0x1907; break;  // GL_RGB
+        case COMPRESSED_DXT1_RGBA: ktxHeader.glInternalFormat = 0x83F1; ktxHeader.glBaseInternalFormat = 0x1908; break; // GL_RGBA
+        case COMPRESSED_DXT3_RGBA: ktxHeader.glInternalFormat = 0x83F2; ktxHeader.glBaseInternalFormat = 0x1908; break;
+        case COMPRESSED_DXT5_RGBA: ktxHeader.glInternalFormat = 0x83F3; ktxHeader.glBaseInternalFormat = 0x1908; break;
+        case COMPRESSED_ETC1_RGB: ktxHeader.glInternalFormat = 0x8D64; ktxHeader.glBaseInternalFormat = 0x1907; break;
+        case COMPRESSED_ETC2_RGB: ktxHeader.glInternalFormat = 0x9274; ktxHeader.glBaseInternalFormat = 0x1907; break;
+        case COMPRESSED_ETC2_EAC_RGBA: ktxHeader.glInternalFormat = 0x9278; ktxHeader.glBaseInternalFormat = 0x1908; break;
+        case COMPRESSED_PVRT_RGB: ktxHeader.glInternalFormat = 0x8C00; ktxHeader.glBaseInternalFormat = 0x1907; break;
+        case COMPRESSED_PVRT_RGBA: ktxHeader.glInternalFormat = 0x8C02; ktxHeader.glBaseInternalFormat = 0x1908; break;
+        case COMPRESSED_ASTC_4x4_RGBA: ktxHeader.glInternalFormat = 0x93B0; ktxHeader.glBaseInternalFormat = 0x1908; break;
+        case COMPRESSED_ASTC_8x8_RGBA: ktxHeader.glInternalFormat = 0x93B7; ktxHeader.glBaseInternalFormat = 0x1908; break;
+        default:
+        {
+            rlGetGlTextureFormats(image.format, &ktxHeader.glInternalFormat, &ktxHeader.glFormat, &ktxHeader.glType);   // rlgl module function
+            ktxHeader.glBaseInternalFormat = ktxHeader.glFormat;    // KTX 1.1 only
+        } break;
+    }
 
     if (ktxHeader.glFormat == -1) TRACELOG(LOG_WARNING, "IMAGE: GL format not supported for KTX export (%i)", ktxHeader.glFormat);
     else
@@ -4257,8 +7170,8 @@ static int SaveKTX(Image image, const char *fileName)
             memcpy(fileDataPtr, &dataSize, sizeof(unsigned int));
             memcpy(fileDataPtr + 4, (unsigned char *)image.data + dataOffset, dataSize);
 
-            width /= 2;
-            height /= 2;
+            width = (width > 1)? width/2 : 1;
+            height = (height > 1)? height/2 : 1;
             dataOffset += dataSize;
             fileDataPtr += (4 + dataSize);
         }
@@ -4380,26 +7293,31 @@ static Image LoadPVR(const unsigned char *fileData, unsigned int fileSize)
 
                 fileDataPtr += pvrHeader->metaDataSize;    // Skip meta data header
 
-                // Calculate data size (depends on format)
-                int bpp = 0;
-                switch (image.format)
+                // Calculate data size (depends on format), including all mipmaps
+                // NOTE: Only mipmaps levels available in file data are loaded
+                int dataSize = 0;
+                int availableSize = (int)fileSize - (int)(fileDataPtr - fileData);
+
+                if (image.mipmaps < 1) image.mipmaps = 1;
+
+                for (int i = 0, width = image.width, height = image.height; i < image.mipmaps; i++)
                 {
-                    case UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
-                    case UNCOMPRESSED_GRAY_ALPHA:
-                    case UNCOMPRESSED_R5G5B5A1:
-                    case UNCOMPRESSED_R5G6B5:
-                    case UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
-                    case UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
-                    case UNCOMPRESSED_R8G8B8: bpp = 24; break;
-                    case COMPRESSED_PVRT_RGB:
-                    case COMPRESSED_PVRT_RGBA: bpp = 4; break;
-                    default: break;
-                }
+                    int mipSize = GetPixelDataSize(width, height, image.format);
 
-                int dataSize = image.width*image.height*bpp/8;  // Total data size in bytes
-                image.data = (unsigned char *)RL_MALLOC(dataSize*sizeof(unsigned char));
+                    if ((dataSize + mipSize) > availableSize)
+                    {
+                        TRACELOG(LOG_WARNING, "IMAGE: PVR file data contains %i of %i mipmaps", i, image.mipmaps);
+                        image.mipmaps = i;
+                        break;
+                    }
 
-                memcpy(image.data, fileDataPtr, dataSize);
+                    dataSize += mipSize;
+                    width = (width > 1)? width/2 : 1;
+                    height = (height > 1)? height/2 : 1;
+                }
+
+                // NOTE: Image data points to file data (zero-copy), LoadImageFromMemory() copies it if required
+                if (dataSize > 0) image.data = fileDataPtr;
             }
         }
         else if (pvrVersion == 52) TRACELOG(LOG_INFO, "IMAGE: PVRv2 format not supported, update your files to PVRv3");
@@ -4465,14 +7383,14 @@ static Image LoadASTC(const unsigned char *fileData, unsigned int fileSize)
             // NOTE: Currently we only support 2 blocks configurations: 4x4 and 8x8
             if ((bpp == 8) || (bpp == 2))
             {
-                int dataSize = image.width*image.height*bpp/8;  // Data size in bytes
-
-                image.data = (unsigned char *)RL_MALLOC(dataSize*sizeof(unsigned char));
-
-                memcpy(image.data, fileDataPtr, dataSize);
-
                 if (bpp == 8) image.format = COMPRESSED_ASTC_4x4_RGBA;
                 else if (bpp == 2) image.format = COMPRESSED_ASTC_8x8_RGBA;
+
+                int dataSize = GetPixelDataSize(image.width, image.height, image.format);  // Data size in bytes
+
+                // NOTE: Image data points to file data (zero-copy), LoadImageFromMemory() copies it if required
+                if ((fileDataPtr + dataSize) <= (fileData + fileSize)) image.data = fileDataPtr;
+                else TRACELOG(LOG_WARNING, "IMAGE: ASTC file data not complete");
             }
             else TRACELOG(LOG_WARNING, "IMAGE: ASTC block size configuration not supported");
         }
@@ -8,6 +8,14 @@
 *       Show TraceLog() output messages
 *       NOTE: By default LOG_DEBUG traces not shown
 *
+*   #define SUPPORT_THREADS
+*       Support multi-threading utilities (parallel jobs, async jobs workers, jobs queues), if not defined jobs run on calling thread
+*       NOTE: Uses Win32 threads on Windows and POSIX threads on other platforms
+*
+*   #define SUPPORT_FILE_MAPPING
+*       Support read-only memory mapped file data (LoadFileDataMapped()), if not defined file data is loaded
+*       NOTE: Not available on Android, Web and UWP platforms
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -50,6 +58,52 @@
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
 
+#if defined(PLATFORM_WEB) && !defined(__EMSCRIPTEN_PTHREADS__)
+    #undef SUPPORT_THREADS              // Threads not available without emscripten pthreads support
+#endif
+
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_WEB) || defined(PLATFORM_UWP)
+    #undef SUPPORT_FILE_MAPPING         // Memory mapped files not available, file data is loaded instead
+#endif
+
+#if defined(SUPPORT_THREADS)
+    #if defined(_WIN32)
+        #include <process.h>            // Required for: _beginthreadex()
+
+        // NOTE: We include required Win32 functions signatures here to avoid windows.h inclusion
+        // SRWLOCK and CONDITION_VARIABLE are pointer-sized structures, zero initialized
+        unsigned long __stdcall WaitForSingleObject(void *hHandle, unsigned long dwMilliseconds);
+        int __stdcall CloseHandle(void *hObject);
+        void __stdcall AcquireSRWLockExclusive(void **SRWLock);
+        void __stdcall ReleaseSRWLockExclusive(void **SRWLock);
+        int __stdcall SleepConditionVariableSRW(void **ConditionVariable, void **SRWLock, unsigned long dwMilliseconds, unsigned long Flags);
+        void __stdcall WakeConditionVariable(void **ConditionVariable);
+        void __stdcall WakeAllConditionVariable(void **ConditionVariable);
+    #else
+        #include <pthread.h>            // Required for: pthread_create(), pthread_join(), pthread_mutex_lock(), pthread_cond_wait()
+    #endif
+#endif
+
+#if defined(SUPPORT_FILE_MAPPING)
+    #if defined(_WIN32)
+        // NOTE: We include required Win32 functions signatures here to avoid windows.h inclusion
+        void *__stdcall CreateFileA(const char *lpFileName, unsigned long dwDesiredAccess, unsigned long dwShareMode, void *lpSecurityAttributes,
+                                    unsigned long dwCreationDisposition, unsigned long dwFlagsAndAttributes, void *hTemplateFile);
+        unsigned long __stdcall GetFileSize(void *hFile, unsigned long *lpFileSizeHigh);
+        void *__stdcall CreateFileMappingA(void *hFile, void *lpFileMappingAttributes, unsigned long flProtect,
+                                           unsigned long dwMaximumSizeHigh, unsigned long dwMaximumSizeLow, const char *lpName);
+        void *__stdcall MapViewOfFile(void *hFileMappingObject, unsigned long dwDesiredAccess, unsigned long dwFileOffsetHigh,
+                                      unsigned long dwFileOffsetLow, size_t dwNumberOfBytesToMap);
+        int __stdcall UnmapViewOfFile(const void *lpBaseAddress);
+        int __stdcall CloseHandle(void *hObject);
+    #else
+        #include <sys/mman.h>           // Required for: mmap(), munmap()
+        #include <sys/stat.h>           // Required for: fstat()
+        #include <fcntl.h>              // Required for: open()
+        #include <unistd.h>             // Required for: close()
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -59,6 +113,63 @@
 #ifndef MAX_UWP_MESSAGES
     #define MAX_UWP_MESSAGES            512     // Max UWP messages to process
 #endif
+#ifndef MAX_PARALLEL_THREADS
+    #define MAX_PARALLEL_THREADS         32     // Max threads used to run a parallel job
+#endif
+#ifndef ASYNC_JOB_THREADS
+    #define ASYNC_JOB_THREADS             2     // Worker threads used to run async jobs
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Parallel job, elements range split in contiguous bands processed by pool threads and calling thread
+typedef struct ParallelJob {
+    ParallelJobFunc job;        // Job function (NULL if no job running)
+    void *data;                 // Job data (shared by all bands)
+    int count;                  // Elements count
+    int bands;                  // Bands count
+    int next;                   // Next band to be processed
+    int pending;                // Bands not processed yet
+} ParallelJob;
+
+// Mapped file data, memory mapping or loaded file data (if mapping not available)
+typedef struct MappedFile {
+    unsigned char *data;        // File data pointer
+    unsigned int size;          // File data size in bytes
+    bool mapped;                // File data is memory mapped (loaded with LoadFileData() otherwise)
+} MappedFile;
+
+// Async job, processed by worker threads, finish function called on UpdateAsyncJobs()
+typedef struct AsyncJob {
+    AsyncJobFunc job;           // Job function (worker thread)
+    AsyncJobFunc finish;        // Finish function (calling thread), could be NULL
+    AsyncJobFunc cancel;        // Cancel function (calling thread), called instead of job and finish if job is cancelled, could be NULL
+    void *data;                 // Job data
+    struct AsyncJob *next;      // Next job in list
+} AsyncJob;
+
+// Jobs queue, bounded ring of jobs processed in order by a dedicated worker thread
+struct JobsQueue {
+    AsyncJobFunc *jobs;         // Queued jobs functions (ring buffer)
+    void **data;                // Queued jobs data (ring buffer)
+    int capacity;               // Max jobs queued
+    int first;                  // First queued job index
+    int count;                  // Jobs queued
+    bool close;                 // Worker thread should exit once queue is empty
+#if defined(SUPPORT_THREADS)
+    bool running;               // Worker thread running (jobs processed on calling thread otherwise)
+#if defined(_WIN32)
+    void *lock;                 // Queue lock (SRWLOCK)
+    void *condition;            // Queue changed condition (CONDITION_VARIABLE)
+    void *thread;               // Worker thread
+#else
+    pthread_mutex_t lock;       // Queue lock
+    pthread_cond_t condition;   // Queue changed condition
+    pthread_t thread;           // Worker thread
+#endif
+#endif
+};
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -69,6 +180,46 @@ static int logTypeLevel = LOG_INFO;                     // Minimum log type leve
 static int logTypeExit = LOG_ERROR;                     // Log type that exits
 static TraceLogCallback logCallback = NULL;             // Log callback function pointer
 
+static MappedFile *mappedFiles = NULL;                  // Mapped files data currently loaded
+static int mappedFilesCount = 0;                        // Mapped files data count
+
+static ParallelJob parallelJob = { 0 };                 // Parallel job currently running
+
+static AsyncJob *asyncJobsFirst = NULL;                 // Async jobs pending to be processed
+static AsyncJob *asyncJobsLast = NULL;
+static AsyncJob *asyncFinishedFirst = NULL;             // Async jobs processed, pending to call finish function
+static AsyncJob *asyncFinishedLast = NULL;
+
+#if defined(SUPPORT_THREADS)
+#if defined(_WIN32)
+static void *asyncLock = NULL;                          // Async jobs lists lock (SRWLOCK)
+static void *mappedFilesLock = NULL;                    // Mapped files list lock (SRWLOCK)
+static void *asyncCondition = NULL;                     // Async jobs available condition (CONDITION_VARIABLE)
+static void *asyncFinishedCondition = NULL;             // Async jobs processed condition (CONDITION_VARIABLE)
+static void *asyncWorkers[ASYNC_JOB_THREADS] = { 0 };   // Async jobs worker threads
+static void *parallelLock = NULL;                       // Parallel job lock (SRWLOCK)
+static void *parallelCondition = NULL;                  // Parallel job bands available condition (CONDITION_VARIABLE)
+static void *parallelFinished = NULL;                   // Parallel job bands processed condition (CONDITION_VARIABLE)
+static void *parallelWorkers[MAX_PARALLEL_THREADS] = { 0 };     // Parallel job pool threads
+#else
+static pthread_mutex_t asyncLock = PTHREAD_MUTEX_INITIALIZER;       // Async jobs lists lock
+static pthread_mutex_t mappedFilesLock = PTHREAD_MUTEX_INITIALIZER; // Mapped files list lock
+static pthread_cond_t asyncCondition = PTHREAD_COND_INITIALIZER;    // Async jobs available condition
+static pthread_cond_t asyncFinishedCondition = PTHREAD_COND_INITIALIZER;    // Async jobs processed condition
+static pthread_t asyncWorkers[ASYNC_JOB_THREADS];                   // Async jobs worker threads
+static pthread_mutex_t parallelLock = PTHREAD_MUTEX_INITIALIZER;    // Parallel job lock
+static pthread_cond_t parallelCondition = PTHREAD_COND_INITIALIZER; // Parallel job bands available condition
+static pthread_cond_t parallelFinished = PTHREAD_COND_INITIALIZER;  // Parallel job bands processed condition
+static pthread_t parallelWorkers[MAX_PARALLEL_THREADS];             // Parallel job pool threads
+#endif
+static int asyncWorkersCount = 0;                       // Async jobs worker threads running
+static int asyncJobsProcessing = 0;                     // Async jobs being processed by worker threads
+static bool asyncWorkersClose = false;                  // Async jobs worker threads should exit (pending jobs are not processed)
+static bool asyncJobsClosing = false;                   // Async jobs closing, new jobs are cancelled
+static int parallelWorkersCount = 0;                    // Parallel job pool threads running
+static bool parallelWorkersClose = false;               // Parallel job pool threads should exit
+#endif
+
 #if defined(PLATFORM_ANDROID)
 static AAssetManager *assetManager = NULL;              // Android assets manager pointer
 static const char *internalDataPath = NULL;             // Android internal data path
@@ -86,6 +237,27 @@ static int android_write(void *cookie, const char *buf, int size);
 static fpos_t android_seek(void *cookie, fpos_t offset, int whence);
 static int android_close(void *cookie);
 #endif
+#if defined(SUPPORT_THREADS)
+#if defined(_WIN32)
+static unsigned int __stdcall ParallelJobsThread(void *arg);    // Parallel job pool thread
+static unsigned int __stdcall AsyncJobsThread(void *arg);       // Async jobs worker thread
+#else
+static void *ParallelJobsThread(void *arg);                     // Parallel job pool thread
+static void *AsyncJobsThread(void *arg);                        // Async jobs worker thread
+#endif
+#if defined(_WIN32)
+static unsigned int __stdcall JobsQueueThread(void *arg);       // Jobs queue worker thread
+#else
+static void *JobsQueueThread(void *arg);                        // Jobs queue worker thread
+#endif
+static void ProcessParallelBands(void);                         // Process parallel job bands until none available (parallel lock held)
+#endif
+static void LockAsyncJobs(void);                                // Lock async jobs lists (no-op without threads support)
+static void UnlockAsyncJobs(void);                              // Unlock async jobs lists (no-op without threads support)
+static void LockMappedFiles(void);                              // Lock mapped files list (no-op without threads support)
+static void UnlockMappedFiles(void);                            // Unlock mapped files list (no-op without threads support)
+static void LockParallelJobs(void);                             // Lock parallel job (no-op without threads support)
+static void UnlockParallelJobs(void);                           // Unlock parallel job (no-op without threads support)
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utilities
@@ -215,6 +387,135 @@ void UnloadFileData(unsigned char *data)
     RL_FREE(data);
 }
 
+// Load file data as a read-only memory mapping (copy-on-write, changes never reach the file)
+// NOTE: If memory mapping is not available, file data is loaded with LoadFileData(),
+// data must be unloaded with UnloadFileDataMapped(), mapped files list is guarded for async jobs usage
+unsigned char *LoadFileDataMapped(const char *fileName, unsigned int *bytesRead)
+{
+    unsigned char *data = NULL;
+    bool mapped = false;
+    *bytesRead = 0;
+
+#if defined(SUPPORT_FILE_MAPPING)
+    if (fileName != NULL)
+    {
+    #if defined(_WIN32)
+        void *file = CreateFileA(fileName, 0x80000000, 0x01, NULL, 3, 0x80, NULL);  // GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL
+
+        if (file != (void *)-1)     // INVALID_HANDLE_VALUE
+        {
+            unsigned long size = GetFileSize(file, NULL);
+
+            if ((size > 0) && (size != 0xFFFFFFFF))
+            {
+                void *mapping = CreateFileMappingA(file, NULL, 0x08, 0, 0, NULL);       // PAGE_WRITECOPY
+
+                if (mapping != NULL)
+                {
+                    data = (unsigned char *)MapViewOfFile(mapping, 0x01, 0, 0, 0);      // FILE_MAP_COPY
+                    CloseHandle(mapping);   // NOTE: View keeps the mapping alive until unmapped
+                }
+
+                if (data != NULL) *bytesRead = (unsigned int)size;
+            }
+
+            CloseHandle(file);
+        }
+    #else
+        int file = open(fileName, O_RDONLY);
+
+        if (file >= 0)
+        {
+            struct stat fileStat = { 0 };
+
+            if ((fstat(file, &fileStat) == 0) && (fileStat.st_size > 0))
+            {
+                void *mapping = mmap(NULL, (size_t)fileStat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+
+                if (mapping != MAP_FAILED)
+                {
+                    data = (unsigned char *)mapping;
+                    *bytesRead = (unsigned int)fileStat.st_size;
+                }
+            }
+
+            close(file);    // NOTE: Mapping is kept until unmapped
+        }
+    #endif
+        if (data != NULL)
+        {
+            mapped = true;
+            TRACELOG(LOG_INFO, "FILEIO: [%s] File mapped successfully", fileName);
+        }
+    }
+#endif
+
+    // Fallback: load file data
+    if (data == NULL) data = LoadFileData(fileName, bytesRead);
+
+    if (data != NULL)
+    {
+        LockMappedFiles();
+        mappedFiles = (MappedFile *)RL_REALLOC(mappedFiles, (mappedFilesCount + 1)*sizeof(MappedFile));
+        mappedFiles[mappedFilesCount].data = data;
+        mappedFiles[mappedFilesCount].size = *bytesRead;
+        mappedFiles[mappedFilesCount].mapped = mapped;
+        mappedFilesCount++;
+        UnlockMappedFiles();
+    }
+
+    return data;
+}
+
+// Unload file data loaded by LoadFileDataMapped(), any pointer inside file data can be provided
+// NOTE: Returns false if pointer does not belong to any mapped file data
+bool UnloadFileDataMapped(const void *data)
+{
+    MappedFile file = { 0 };
+    bool found = false;
+
+    // NOTE: File is removed from list while locked but unmapped out of the lock
+    LockMappedFiles();
+    for (int i = 0; i < mappedFilesCount; i++)
+    {
+        if (((const unsigned char *)data >= mappedFiles[i].data) && ((const unsigned char *)data < (mappedFiles[i].data + mappedFiles[i].size)))
+        {
+            file = mappedFiles[i];
+            found = true;
+
+            // Remove from list, last file data moved to current position
+            mappedFiles[i] = mappedFiles[mappedFilesCount - 1];
+            mappedFilesCount--;
+
+            if (mappedFilesCount == 0)
+            {
+                RL_FREE(mappedFiles);
+                mappedFiles = NULL;
+            }
+
+            break;
+        }
+    }
+    UnlockMappedFiles();
+
+    if (found)
+    {
+        if (file.mapped)
+        {
+        #if defined(SUPPORT_FILE_MAPPING)
+            #if defined(_WIN32)
+            UnmapViewOfFile(file.data);
+            #else
+            munmap(file.data, file.size);
+            #endif
+        #endif
+        }
+        else UnloadFileData(file.data);
+    }
+
+    return found;
+}
+
 // Save data to file from buffer
 bool SaveFileData(const char *fileName, void *data, unsigned int bytesToWrite)
 {
@@ -318,6 +619,383 @@ bool SaveFileText(const char *fileName, char *text)
     return success;
 }
 
+// Run job over elements range [0, count), split in contiguous bands across threads
+// NOTE: Bands are processed by a persistent threads pool (launched on demand) and the calling thread,
+// bands are independent so results do not depend on threads count
+void RunParallelJob(ParallelJobFunc job, void *data, int count, int threads)
+{
+    if (threads > count) threads = count;
+    if (threads > MAX_PARALLEL_THREADS) threads = MAX_PARALLEL_THREADS;
+
+#if defined(SUPPORT_THREADS)
+    if (threads > 1)
+    {
+        LockParallelJobs();
+
+        // NOTE: Only one parallel job runs on the pool at a time, concurrent jobs are processed on calling thread
+        if (parallelJob.job == NULL)
+        {
+            // Launch missing pool threads, bands are processed by available threads if launching fails
+            int launched = parallelWorkersCount;
+
+            while (parallelWorkersCount < (threads - 1))
+            {
+            #if defined(_WIN32)
+                parallelWorkers[parallelWorkersCount] = (void *)_beginthreadex(NULL, 0, ParallelJobsThread, NULL, 0, NULL);
+                if (parallelWorkers[parallelWorkersCount] == NULL) break;
+            #else
+                if (pthread_create(&parallelWorkers[parallelWorkersCount], NULL, ParallelJobsThread, NULL) != 0) break;
+            #endif
+                parallelWorkersCount++;
+            }
+
+            if (parallelWorkersCount > launched) TRACELOG(LOG_DEBUG, "THREADS: Parallel jobs pool grown to %i threads", parallelWorkersCount);
+
+            parallelJob.job = job;
+            parallelJob.data = data;
+            parallelJob.count = count;
+            parallelJob.bands = threads;
+            parallelJob.next = 0;
+            parallelJob.pending = threads;
+
+        #if defined(_WIN32)
+            WakeAllConditionVariable(&parallelCondition);
+        #else
+            pthread_cond_broadcast(&parallelCondition);
+        #endif
+
+            ProcessParallelBands();
+
+            // Wait for bands processed by pool threads
+            while (parallelJob.pending > 0)
+            {
+            #if defined(_WIN32)
+                SleepConditionVariableSRW(&parallelFinished, &parallelLock, 0xFFFFFFFF, 0);    // INFINITE
+            #else
+                pthread_cond_wait(&parallelFinished, &parallelLock);
+            #endif
+            }
+
+            parallelJob.job = NULL;
+
+            UnlockParallelJobs();
+            return;
+        }
+
+        UnlockParallelJobs();
+    }
+#endif
+
+    if (count > 0) job(data, 0, count);
+}
+
+// Close parallel job pool threads
+// NOTE: No parallel job could be running (it's called on CloseWindow(), after CloseAsyncJobs())
+void CloseParallelJobs(void)
+{
+#if defined(SUPPORT_THREADS)
+    if (parallelWorkersCount > 0)
+    {
+        LockParallelJobs();
+        parallelWorkersClose = true;
+    #if defined(_WIN32)
+        WakeAllConditionVariable(&parallelCondition);
+    #else
+        pthread_cond_broadcast(&parallelCondition);
+    #endif
+        UnlockParallelJobs();
+
+        for (int i = 0; i < parallelWorkersCount; i++)
+        {
+        #if defined(_WIN32)
+            WaitForSingleObject(parallelWorkers[i], 0xFFFFFFFF);    // INFINITE
+            CloseHandle(parallelWorkers[i]);
+        #else
+            pthread_join(parallelWorkers[i], NULL);
+        #endif
+        }
+
+        parallelWorkersCount = 0;
+        parallelWorkersClose = false;
+    }
+#endif
+}
+
+// Run job on async jobs worker threads, finish function is called from UpdateAsyncJobs() once job is processed
+// NOTE: Worker threads are launched on first job, if not available job is processed on calling thread,
+// cancel function is called instead if job is cancelled by CloseAsyncJobs() (it could own job data)
+void RunAsyncJob(AsyncJobFunc job, AsyncJobFunc finish, AsyncJobFunc cancel, void *data)
+{
+#if defined(SUPPORT_THREADS)
+    // Jobs launched by finish functions while closing are cancelled
+    if (asyncJobsClosing)
+    {
+        if (cancel != NULL) cancel(data);
+        return;
+    }
+#endif
+
+    AsyncJob *asyncJob = (AsyncJob *)RL_CALLOC(1, sizeof(AsyncJob));
+
+    asyncJob->job = job;
+    asyncJob->finish = finish;
+    asyncJob->cancel = cancel;
+    asyncJob->data = data;
+
+#if defined(SUPPORT_THREADS)
+    if (asyncWorkersCount == 0)
+    {
+        for (int i = 0; i < ASYNC_JOB_THREADS; i++)
+        {
+        #if defined(_WIN32)
+            asyncWorkers[asyncWorkersCount] = (void *)_beginthreadex(NULL, 0, AsyncJobsThread, NULL, 0, NULL);
+            if (asyncWorkers[asyncWorkersCount] != NULL) asyncWorkersCount++;
+        #else
+            if (pthread_create(&asyncWorkers[asyncWorkersCount], NULL, AsyncJobsThread, NULL) == 0) asyncWorkersCount++;
+        #endif
+        }
+
+        if (asyncWorkersCount > 0) TRACELOG(LOG_INFO, "THREADS: Async jobs workers launched successfully (%i threads)", asyncWorkersCount);
+        else TRACELOG(LOG_WARNING, "THREADS: Failed to launch async jobs workers, jobs processed on calling thread");
+    }
+
+    if (asyncWorkersCount > 0)
+    {
+        LockAsyncJobs();
+
+        if (asyncJobsLast != NULL) asyncJobsLast->next = asyncJob;
+        else asyncJobsFirst = asyncJob;
+        asyncJobsLast = asyncJob;
+
+    #if defined(_WIN32)
+        WakeConditionVariable(&asyncCondition);
+    #else
+        pthread_cond_signal(&asyncCondition);
+    #endif
+
+        UnlockAsyncJobs();
+        return;
+    }
+#endif
+
+    job(data);
+
+    if (asyncFinishedLast != NULL) asyncFinishedLast->next = asyncJob;
+    else asyncFinishedFirst = asyncJob;
+    asyncFinishedLast = asyncJob;
+}
+
+// Call finish function of processed async jobs, in processing order
+// NOTE: Must be called from the thread launching the jobs, it's called on BeginDrawing()
+void UpdateAsyncJobs(void)
+{
+    LockAsyncJobs();
+    AsyncJob *asyncJob = asyncFinishedFirst;
+    asyncFinishedFirst = NULL;
+    asyncFinishedLast = NULL;
+    UnlockAsyncJobs();
+
+    while (asyncJob != NULL)
+    {
+        AsyncJob *next = asyncJob->next;
+
+        if (asyncJob->finish != NULL) asyncJob->finish(asyncJob->data);
+        RL_FREE(asyncJob);
+
+        asyncJob = next;
+    }
+}
+
+// Wait until some async job is processed, finish functions are called with UpdateAsyncJobs()
+// NOTE: Returns immediately if processed jobs are available or no jobs are pending
+void WaitAsyncJobs(void)
+{
+#if defined(SUPPORT_THREADS)
+    LockAsyncJobs();
+
+    while ((asyncFinishedFirst == NULL) && ((asyncJobsFirst != NULL) || (asyncJobsProcessing > 0)) && (asyncWorkersCount > 0))
+    {
+    #if defined(_WIN32)
+        SleepConditionVariableSRW(&asyncFinishedCondition, &asyncLock, 0xFFFFFFFF, 0);    // INFINITE
+    #else
+        pthread_cond_wait(&asyncFinishedCondition, &asyncLock);
+    #endif
+    }
+
+    UnlockAsyncJobs();
+#endif
+}
+
+// Close async jobs worker threads, waiting only for jobs being processed
+// NOTE: Finish functions of processed jobs are called, jobs not started yet (and jobs launched
+// by finish functions while closing) are cancelled, their cancel functions are called instead
+void CloseAsyncJobs(void)
+{
+#if defined(SUPPORT_THREADS)
+    AsyncJob *cancelled = NULL;
+
+    asyncJobsClosing = true;
+
+    if (asyncWorkersCount > 0)
+    {
+        LockAsyncJobs();
+        asyncWorkersClose = true;
+    #if defined(_WIN32)
+        WakeAllConditionVariable(&asyncCondition);
+    #else
+        pthread_cond_broadcast(&asyncCondition);
+    #endif
+        UnlockAsyncJobs();
+
+        for (int i = 0; i < asyncWorkersCount; i++)
+        {
+        #if defined(_WIN32)
+            WaitForSingleObject(asyncWorkers[i], 0xFFFFFFFF);   // INFINITE
+            CloseHandle(asyncWorkers[i]);
+        #else
+            pthread_join(asyncWorkers[i], NULL);
+        #endif
+        }
+
+        asyncWorkersCount = 0;
+        asyncWorkersClose = false;
+
+        cancelled = asyncJobsFirst;
+        asyncJobsFirst = NULL;
+        asyncJobsLast = NULL;
+    }
+#endif
+
+    while (asyncFinishedFirst != NULL) UpdateAsyncJobs();
+
+#if defined(SUPPORT_THREADS)
+    while (cancelled != NULL)
+    {
+        AsyncJob *next = cancelled->next;
+
+        if (cancelled->cancel != NULL) cancelled->cancel(cancelled->data);
+        RL_FREE(cancelled);
+
+        cancelled = next;
+    }
+
+    asyncJobsClosing = false;
+#endif
+}
+
+// Load jobs queue, jobs are processed in push order by a dedicated worker thread
+// NOTE: If worker thread is not available, jobs are processed on calling thread when pushed
+JobsQueue *LoadJobsQueue(int capacity)
+{
+    if (capacity < 1) capacity = 1;
+
+    JobsQueue *queue = (JobsQueue *)RL_CALLOC(1, sizeof(JobsQueue));
+
+    queue->jobs = (AsyncJobFunc *)RL_CALLOC(capacity, sizeof(AsyncJobFunc));
+    queue->data = (void **)RL_CALLOC(capacity, sizeof(void *));
+    queue->capacity = capacity;
+
+#if defined(SUPPORT_THREADS)
+    #if defined(_WIN32)
+    queue->thread = (void *)_beginthreadex(NULL, 0, JobsQueueThread, queue, 0, NULL);
+    queue->running = (queue->thread != NULL);
+    #else
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_cond_init(&queue->condition, NULL);
+    queue->running = (pthread_create(&queue->thread, NULL, JobsQueueThread, queue) == 0);
+    #endif
+
+    if (!queue->running) TRACELOG(LOG_WARNING, "THREADS: Failed to launch jobs queue worker, jobs processed on calling thread");
+#endif
+
+    return queue;
+}
+
+// Push job to queue, returns false if queue is full (job not queued)
+// NOTE: Calling thread never waits for the worker thread, it's up to the caller to drop or retry the job
+bool PushJobsQueue(JobsQueue *queue, AsyncJobFunc job, void *data)
+{
+    if (queue == NULL) return false;
+
+#if defined(SUPPORT_THREADS)
+    if (queue->running)
+    {
+        bool queued = false;
+
+    #if defined(_WIN32)
+        AcquireSRWLockExclusive(&queue->lock);
+    #else
+        pthread_mutex_lock(&queue->lock);
+    #endif
+
+        if (queue->count < queue->capacity)
+        {
+            int index = (queue->first + queue->count)%queue->capacity;
+
+            queue->jobs[index] = job;
+            queue->data[index] = data;
+            queue->count++;
+            queued = true;
+
+        #if defined(_WIN32)
+            WakeConditionVariable(&queue->condition);
+        #else
+            pthread_cond_signal(&queue->condition);
+        #endif
+        }
+
+    #if defined(_WIN32)
+        ReleaseSRWLockExclusive(&queue->lock);
+    #else
+        pthread_mutex_unlock(&queue->lock);
+    #endif
+
+        return queued;
+    }
+#endif
+
+    job(data);
+
+    return true;
+}
+
+// Unload jobs queue, waiting for queued jobs to be processed
+void UnloadJobsQueue(JobsQueue *queue)
+{
+    if (queue == NULL) return;
+
+#if defined(SUPPORT_THREADS)
+    if (queue->running)
+    {
+    #if defined(_WIN32)
+        AcquireSRWLockExclusive(&queue->lock);
+        queue->close = true;
+        WakeConditionVariable(&queue->condition);
+        ReleaseSRWLockExclusive(&queue->lock);
+
+        WaitForSingleObject(queue->thread, 0xFFFFFFFF);     // INFINITE
+        CloseHandle(queue->thread);
+    #else
+        pthread_mutex_lock(&queue->lock);
+        queue->close = true;
+        pthread_cond_signal(&queue->condition);
+        pthread_mutex_unlock(&queue->lock);
+
+        pthread_join(queue->thread, NULL);
+    #endif
+    }
+
+    #if !defined(_WIN32)
+    pthread_mutex_destroy(&queue->lock);
+    pthread_cond_destroy(&queue->condition);
+    #endif
+#endif
+
+    RL_FREE(queue->jobs);
+    RL_FREE(queue->data);
+    RL_FREE(queue);
+}
+
 #if defined(PLATFORM_ANDROID)
 // Initialize asset manager from android app
 void InitAssetManager(AAssetManager *manager, const char *dataPath)
@@ -388,3 +1066,234 @@ static int android_close(void *cookie)
     return 0;
 }
 #endif  // PLATFORM_ANDROID
+
+#if defined(SUPPORT_THREADS)
+// Parallel job pool thread, processes running job bands until closed
+#if defined(_WIN32)
+static unsigned int __stdcall ParallelJobsThread(void *arg)
+#else
+static void *ParallelJobsThread(void *arg)
+#endif
+{
+    LockParallelJobs();
+
+    while (!parallelWorkersClose)
+    {
+        if ((parallelJob.job != NULL) && (parallelJob.next < parallelJob.bands)) ProcessParallelBands();
+        else
+        {
+        #if defined(_WIN32)
+            SleepConditionVariableSRW(&parallelCondition, &parallelLock, 0xFFFFFFFF, 0);   // INFINITE
+        #else
+            pthread_cond_wait(&parallelCondition, &parallelLock);
+        #endif
+        }
+    }
+
+    UnlockParallelJobs();
+
+    return 0;
+}
+
+// Process running parallel job bands until none available, parallel lock must be held
+// NOTE: Lock is released while processing a band, finished condition is signaled on last band processed
+static void ProcessParallelBands(void)
+{
+    while (parallelJob.next < parallelJob.bands)
+    {
+        int band = parallelJob.next++;
+        ParallelJobFunc job = parallelJob.job;
+        void *data = parallelJob.data;
+        int start = (int)((long long)parallelJob.count*band/parallelJob.bands);
+        int end = (int)((long long)parallelJob.count*(band + 1)/parallelJob.bands);
+
+        UnlockParallelJobs();
+        job(data, start, end);
+        LockParallelJobs();
+
+        parallelJob.pending--;
+
+    #if defined(_WIN32)
+        if (parallelJob.pending == 0) WakeAllConditionVariable(&parallelFinished);
+    #else
+        if (parallelJob.pending == 0) pthread_cond_broadcast(&parallelFinished);
+    #endif
+    }
+}
+
+// Async jobs worker thread, processes pending jobs until closed
+#if defined(_WIN32)
+static unsigned int __stdcall AsyncJobsThread(void *arg)
+#else
+static void *AsyncJobsThread(void *arg)
+#endif
+{
+    while (true)
+    {
+        LockAsyncJobs();
+
+        while ((asyncJobsFirst == NULL) && !asyncWorkersClose)
+        {
+        #if defined(_WIN32)
+            SleepConditionVariableSRW(&asyncCondition, &asyncLock, 0xFFFFFFFF, 0);     // INFINITE
+        #else
+            pthread_cond_wait(&asyncCondition, &asyncLock);
+        #endif
+        }
+
+        // NOTE: Pending jobs are not processed on exit, they are cancelled on CloseAsyncJobs()
+        if (asyncWorkersClose)
+        {
+            UnlockAsyncJobs();
+            break;
+        }
+
+        AsyncJob *asyncJob = asyncJobsFirst;
+        asyncJobsFirst = asyncJob->next;
+        if (asyncJobsFirst == NULL) asyncJobsLast = NULL;
+        asyncJob->next = NULL;
+        asyncJobsProcessing++;
+
+        UnlockAsyncJobs();
+
+        asyncJob->job(asyncJob->data);
+
+        LockAsyncJobs();
+
+        if (asyncFinishedLast != NULL) asyncFinishedLast->next = asyncJob;
+        else asyncFinishedFirst = asyncJob;
+        asyncFinishedLast = asyncJob;
+        asyncJobsProcessing--;
+
+    #if defined(_WIN32)
+        WakeAllConditionVariable(&asyncFinishedCondition);
+    #else
+        pthread_cond_broadcast(&asyncFinishedCondition);
+    #endif
+
+        UnlockAsyncJobs();
+    }
+
+    return 0;
+}
+
+// Jobs queue worker thread, processes queued jobs in order until closed and empty
+#if defined(_WIN32)
+static unsigned int __stdcall JobsQueueThread(void *arg)
+#else
+static void *JobsQueueThread(void *arg)
+#endif
+{
+    JobsQueue *queue = (JobsQueue *)arg;
+
+    while (true)
+    {
+    #if defined(_WIN32)
+        AcquireSRWLockExclusive(&queue->lock);
+        while ((queue->count == 0) && !queue->close) SleepConditionVariableSRW(&queue->condition, &queue->lock, 0xFFFFFFFF, 0);     // INFINITE
+    #else
+        pthread_mutex_lock(&queue->lock);
+        while ((queue->count == 0) && !queue->close) pthread_cond_wait(&queue->condition, &queue->lock);
+    #endif
+
+        if (queue->count == 0)
+        {
+        #if defined(_WIN32)
+            ReleaseSRWLockExclusive(&queue->lock);
+        #else
+            pthread_mutex_unlock(&queue->lock);
+        #endif
+            break;
+        }
+
+        AsyncJobFunc job = queue->jobs[queue->first];
+        void *data = queue->data[queue->first];
+
+        // NOTE: Job slot is released before processing, so up to capacity jobs can wait while one is processed
+        queue->first = (queue->first + 1)%queue->capacity;
+        queue->count--;
+
+    #if defined(_WIN32)
+        ReleaseSRWLockExclusive(&queue->lock);
+    #else
+        pthread_mutex_unlock(&queue->lock);
+    #endif
+
+        job(data);
+    }
+
+    return 0;
+}
+#endif  // SUPPORT_THREADS
+
+// Lock async jobs lists
+static void LockAsyncJobs(void)
+{
+#if defined(SUPPORT_THREADS)
+    #if defined(_WIN32)
+    AcquireSRWLockExclusive(&asyncLock);
+    #else
+    pthread_mutex_lock(&asyncLock);
+    #endif
+#endif
+}
+
+// Unlock async jobs lists
+static void UnlockAsyncJobs(void)
+{
+#if defined(SUPPORT_THREADS)
+    #if defined(_WIN32)
+    ReleaseSRWLockExclusive(&asyncLock);
+    #else
+    pthread_mutex_unlock(&asyncLock);
+    #endif
+#endif
+}
+
+// Lock mapped files list
+static void LockMappedFiles(void)
+{
+#if defined(SUPPORT_THREADS)
+    #if defined(_WIN32)
+    AcquireSRWLockExclusive(&mappedFilesLock);
+    #else
+    pthread_mutex_lock(&mappedFilesLock);
+    #endif
+#endif
+}
+
+// Unlock mapped files list
+static void UnlockMappedFiles(void)
+{
+#if defined(SUPPORT_THREADS)
+    #if defined(_WIN32)
+    ReleaseSRWLockExclusive(&mappedFilesLock);
+    #else
+    pthread_mutex_unlock(&mappedFilesLock);
+    #endif
+#endif
+}
+
+// Lock parallel job
+static void LockParallelJobs(void)
+{
+#if defined(SUPPORT_THREADS)
+    #if defined(_WIN32)
+    AcquireSRWLockExclusive(&parallelLock);
+    #else
+    pthread_mutex_lock(&parallelLock);
+    #endif
+#endif
+}
+
+// Unlock parallel job
+static void UnlockParallelJobs(void)
+{
+#if defined(SUPPORT_THREADS)
+    #if defined(_WIN32)
+    ReleaseSRWLockExclusive(&parallelLock);
+    #else
+    pthread_mutex_unlock(&parallelLock);
+    #endif
+#endif
+}
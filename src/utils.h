@@ -59,6 +59,15 @@
 extern "C" {            // Prevents name mangling of functions
 #endif
 
+// Parallel job function, processes elements in range [start, end)
+typedef void (*ParallelJobFunc)(void *data, int start, int end);
+
+// Async job function, processes job data
+typedef void (*AsyncJobFunc)(void *data);
+
+// Jobs queue, jobs processed in order by a dedicated worker thread
+typedef struct JobsQueue JobsQueue;
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -67,6 +76,20 @@ extern "C" {            // Prevents name mangling of functions
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
 //----------------------------------------------------------------------------------
+void RunParallelJob(ParallelJobFunc job, void *data, int count, int threads);   // Run job over [0, count) split in bands across threads
+void CloseParallelJobs(void);                                                   // Close parallel job pool threads
+void RunAsyncJob(AsyncJobFunc job, AsyncJobFunc finish, AsyncJobFunc cancel, void *data);  // Run job on async workers, finish called on UpdateAsyncJobs()
+void UpdateAsyncJobs(void);                                                     // Call finish function of processed async jobs
+void WaitAsyncJobs(void);                                                       // Wait until some async job is processed (no busy waiting)
+void CloseAsyncJobs(void);                                                      // Close async jobs workers (not started jobs cancelled)
+
+JobsQueue *LoadJobsQueue(int capacity);                                         // Load jobs queue with its worker thread, up to capacity jobs queued
+bool PushJobsQueue(JobsQueue *queue, AsyncJobFunc job, void *data);             // Push job to queue, returns false if queue is full
+void UnloadJobsQueue(JobsQueue *queue);                                         // Unload jobs queue, waiting for queued jobs to be processed
+
+unsigned char *LoadFileDataMapped(const char *fileName, unsigned int *bytesRead);  // Load file data as read-only memory mapping (loaded if not available)
+bool UnloadFileDataMapped(const void *data);                                       // Unload file data mapping containing provided data pointer
+
 #if defined(PLATFORM_ANDROID)
 void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initialize asset manager from android app
 FILE *android_fopen(const char *fileName, const char *mode);            // Replacement for fopen() -> Read-only!